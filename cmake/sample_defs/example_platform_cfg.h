@@ -520,6 +520,20 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_CDS_REG_DUMP_FILE "/ram/cfe_cds_reg.log"
 
+/**
+**  \cfeescfg Default Memory Pool Block Map Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       block map of all memory pools. This filename is used only when no filename is
+**       specified in the command to write the memory pool block map.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_MEMPOOL_MAP_FILE "/ram/cfe_es_poolmap.dat"
+
 /**
 **  \cfeescfg Define Default System Log Mode following Power On Reset
 **
@@ -767,6 +781,33 @@
 */
 #define CFE_PLATFORM_ES_MAX_MEMORY_POOLS 10
 
+/** \cfeescfg Maximum number of tasks with a block cache in a memory pool
+**
+**  \par Description:
+**      Pools created with #CFE_ES_POOLOPTS_TASK_CACHE give each task that
+**      uses them a private cache of free blocks.  This sets how many tasks
+**      can hold a cache in a single pool at once; any further tasks use the
+**      shared pool directly.  The caches are taken from the pool memory, so
+**      larger values leave less room for blocks.
+**
+**  \par Limits:
+**       Must be at least one.  No specific upper limit.
+*/
+#define CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS 4
+
+/** \cfeescfg Number of free blocks held by a memory pool task cache
+**
+**  \par Description:
+**      The number of free blocks of each block size that a task cache of a
+**      pool created with #CFE_ES_POOLOPTS_TASK_CACHE can hold.  An empty
+**      cache is refilled, and a full cache is flushed, half this many blocks
+**      at a time.
+**
+**  \par Limits:
+**       Must be at least 2.  No specific upper limit.
+*/
+#define CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH 8
+
 /**
 **  \cfeescfg Define Default ES Memory Pool Block Sizes
 **
@@ -1096,6 +1137,81 @@
 */
 #define CFE_PLATFORM_SB_MAX_DEST_PER_PKT 16
 
+/**
+**  \cfesbcfg Maximum Number of buffers returned by a single batched receive
+**
+**  \par Description:
+**       Dictates the maximum number of message buffers that a single call to
+**       #CFE_SB_ReceiveBufferBatch can return.  Larger requests are truncated
+**       to this value.  Every pipe descriptor reserves room to hold a reference
+**       to this many buffers, so this directly affects the size of the pipe table.
+**
+**  \par Limits
+**       This parameter has a lower limit of 2 and an upper limit of 65535.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_RECEIVE_BATCH 16
+
+/**
+**  \cfesbcfg Maximum Number of mask subscriptions
+**
+**  \par Description:
+**       Dictates the maximum number of mask subscriptions, made with
+**       #CFE_SB_SubscribeMask, that can be in use at the same time across
+**       all pipes.  Every route that is created is checked against each of
+**       them, so this should be kept small.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_MASK_SUBS 16
+
+/**
+**  \cfesbcfg Maximum Number of pipes in a pipe set
+**
+**  \par Description:
+**       Dictates the maximum number of pipes that a single call to
+**       #CFE_SB_ReceiveBufferFromSet can wait on.  The receive transaction
+**       holds the state of each pipe on the stack of the caller.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of
+**       #CFE_PLATFORM_SB_MAX_PIPES.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_PIPES_PER_SET 8
+
+/**
+**  \cfesbcfg Maximum Number of tasks waiting on pipe sets
+**
+**  \par Description:
+**       Dictates the maximum number of tasks that can be blocked in
+**       #CFE_SB_ReceiveBufferFromSet at the same time.  Each one uses an
+**       OSAL binary semaphore, which is created the first time it is needed
+**       and kept for later waits.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS 4
+
+/**
+**  \cfesbcfg Maximum Number of producer buffer pools
+**
+**  \par Description:
+**       Dictates the maximum number of producer buffer pools that can exist
+**       at the same time, see #CFE_SB_CreateBufferPool.  The buffers of the
+**       pools are allocated from the SB memory pool, so
+**       #CFE_PLATFORM_SB_BUF_MEMORY_BYTES must also leave room for them.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_BUFFER_POOLS 8
+
 /**
 **  \cfesbcfg Default Subscription Message Limit
 **
@@ -1133,6 +1249,55 @@
 */
 #define CFE_PLATFORM_SB_BUF_MEMORY_BYTES 524288
 
+/**
+**  \cfesbcfg Number of free message buffers kept per pool block size
+**
+**  \par Description:
+**       Message buffers released by the SB are kept on a free list for their
+**       memory pool block size, up to this many per block size, so that the next
+**       message of a similar size can reuse them without going back to the memory
+**       pool.  Buffers on these lists are not counted in the memory in use
+**       statistics, but are not available for other uses of the SB memory pool.
+**       Setting this to 0 disables the free lists.
+**
+**  \par Limits
+**       This parameter has a lower limit of 0 and an upper limit of 65535.
+**
+*/
+#define CFE_PLATFORM_SB_BUF_CACHE_DEPTH 8
+
+/**
+**  \cfesbcfg Number of message buffers allocated when refilling a free list
+**
+**  \par Description:
+**       When the free list for a block size is empty, this many buffers of that
+**       size are obtained from the SB memory pool at once.  Fewer are obtained
+**       for large block sizes, see #CFE_PLATFORM_SB_BUF_CACHE_BYTES.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and cannot be greater than
+**       #CFE_PLATFORM_SB_BUF_CACHE_DEPTH, unless the free lists are disabled.
+**
+*/
+#define CFE_PLATFORM_SB_BUF_CACHE_REFILL 4
+
+/**
+**  \cfesbcfg Number of bytes of message buffers kept per pool block size
+**
+**  \par Description:
+**       Limits the free list of each block size to as many buffers as fit in
+**       this many bytes, and never more than #CFE_PLATFORM_SB_BUF_CACHE_DEPTH.
+**       A refill also stays within this limit, but always obtains at least the
+**       one buffer being requested.  Block sizes larger than this limit are not
+**       kept on a free list at all, so that a few large messages cannot hold
+**       on to a large part of the SB memory pool.
+**
+**  \par Limits
+**       This parameter has a lower limit of 0.
+**
+*/
+#define CFE_PLATFORM_SB_BUF_CACHE_BYTES 16384
+
 /**
 **  \cfesbcfg Highest Valid Message Id
 **
@@ -1186,6 +1351,20 @@
 */
 #define CFE_PLATFORM_SB_DEFAULT_PIPE_FILENAME "/ram/cfe_sb_pipe.dat"
 
+/**
+**  \cfesbcfg Default Pipe Latency Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the software
+**       bus pipe latency histograms. This filename is used only when no filename is
+**       specified in the command.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_SB_DEFAULT_PIPE_LATENCY_FILENAME "/ram/cfe_sb_pipelat.dat"
+
 /**
 **  \cfesbcfg Default Message Map Filename
 **
@@ -79,6 +79,7 @@ void CFE_TestMain(void)
     SBSendRecvTestSetup();
     SBSubscriptionTestSetup();
     SBPerformanceTestSetup();
+    SBBenchmarkTestSetup();
     TBLContentAccessTestSetup();
     TBLContentMangTestSetup();
     TBLInformationTestSetup();
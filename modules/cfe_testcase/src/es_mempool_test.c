@@ -199,6 +199,42 @@ void TestMemPoolDelete(void)
     UtAssert_INT32_EQ(CFE_ES_PoolDelete(CFE_ES_MEMHANDLE_UNDEFINED), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 }
 
+void TestMemPoolReset(void)
+{
+    CFE_ES_MemHandle_t    PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
+    CFE_ES_MemPoolBuf_t   addressp1;
+    CFE_ES_MemPoolBuf_t   addressp2;
+    CFE_ES_MemPoolStats_t Stats;
+
+    UtPrintf("Testing: CFE_ES_PoolReset");
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateWithOpts(&PoolID, CFE_FT_PoolMemBlock, sizeof(CFE_FT_PoolMemBlock_t), 0, NULL,
+                                                CFE_ES_POOLOPTS_MUTEX | CFE_ES_POOLOPTS_ARENA),
+                      CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 100), 100);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID, 200), 200);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID, sizeof(CFE_FT_PoolMemBlock_t)), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp1), CFE_ES_BAD_ARGUMENT);
+
+    UtAssert_INT32_EQ(CFE_ES_GetMemPoolStats(&Stats, PoolID), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.NumBlocksRequested, 2);
+    UtAssert_UINT32_LTEQ(CFE_ES_MEMOFFSET_TO_SIZET(Stats.NumFreeBytes), sizeof(CFE_FT_PoolMemBlock_t) - 300);
+
+    UtAssert_INT32_EQ(CFE_ES_PoolReset(PoolID), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_GetMemPoolStats(&Stats, PoolID), CFE_SUCCESS);
+    UtAssert_EQ(size_t, CFE_ES_MEMOFFSET_TO_SIZET(Stats.NumFreeBytes), sizeof(CFE_FT_PoolMemBlock_t));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID, 100), 100);
+    UtAssert_ADDRESS_EQ(addressp2, addressp1);
+
+    UtAssert_INT32_EQ(CFE_ES_PoolReset(CFE_ES_MEMHANDLE_UNDEFINED), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolID), CFE_SUCCESS);
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreate(&PoolID, CFE_FT_PoolMemBlock, sizeof(CFE_FT_PoolMemBlock_t)), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_ES_PoolReset(PoolID), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(PoolID), CFE_SUCCESS);
+}
+
 void ESMemPoolTestSetup(void)
 {
     UtTest_Add(TestMemPoolCreate, NULL, NULL, "Test Mem Pool Create");
@@ -207,4 +243,5 @@ void ESMemPoolTestSetup(void)
     UtTest_Add(TestMemPoolBufInfo, NULL, NULL, "Test Mem Pool Buf Info");
     UtTest_Add(TestMemPoolPutBuf, NULL, NULL, "Test Mem Pool Put Buf");
     UtTest_Add(TestMemPoolDelete, NULL, NULL, "Test Mem Pool Delete");
+    UtTest_Add(TestMemPoolReset, NULL, NULL, "Test Mem Pool Reset");
 }
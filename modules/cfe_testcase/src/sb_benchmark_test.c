@@ -0,0 +1,517 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Parameterized SB throughput/latency benchmark
+ *
+ * Runs the same publish/subscribe scenario over a matrix of producer counts,
+ * subscriber counts, message sizes, pipe depths and transmit paths (copy via
+ * CFE_SB_TransmitMsg and zero copy via CFE_SB_TransmitBuffer).  All producers
+ * publish on a single MID and every subscriber has its own pipe, so each
+ * message sent is delivered once to every subscriber.
+ *
+ * Each case produces a single result line starting with "SBBENCH" made of
+ * comma separated key=value pairs, so results can be extracted from the test
+ * log and compared between builds by a script.  Latency is measured from just
+ * before the transmit call to just after the receive call returns.
+ */
+
+#include "cfe_test.h"
+#include "cfe_msgids.h"
+#include "cfe_test_msgids.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Upper limits of the matrix, these size the worker tasks and result storage */
+#define UT_BENCH_MAX_PRODUCERS   4
+#define UT_BENCH_MAX_SUBSCRIBERS 4
+
+/* Number of messages published in each case, split evenly across the producers */
+#define UT_BENCH_MSGS_PER_CASE 2048
+
+/* Caps the bytes outstanding per pipe so large messages do not exhaust the SB buffer pool */
+#define UT_BENCH_MAX_INFLIGHT_BYTES 131072
+
+/* Timeout in milliseconds for any single wait inside a case, so a failure cannot hang the test */
+#define UT_BENCH_TIMEOUT 5000
+
+#define UT_BENCH_WORKER_STACK_SIZE   32768
+#define UT_BENCH_PRODUCER_PRIORITY   150
+#define UT_BENCH_SUBSCRIBER_PRIORITY 100
+
+#define UT_BENCH_NUM_ENTRIES(x) (sizeof(x) / sizeof((x)[0]))
+
+static const uint32 UT_BenchProducerCounts[]   = {1, 2, 4};
+static const uint32 UT_BenchSubscriberCounts[] = {1, 2, 4};
+static const size_t UT_BenchMsgSizes[]         = {16, 256, 4096, 65536};
+static const uint16 UT_BenchPipeDepths[]       = {4, 32};
+
+/* Message published by the benchmark, padded out to the size of the case */
+typedef struct UT_BenchMsg
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    OS_time_t                 SendTime;
+    uint32                    ProducerNum;
+    uint32                    Sequence;
+} UT_BenchMsg_t;
+
+/* Transmit buffer used by each producer in copy mode */
+typedef union UT_BenchTxBuf
+{
+    CFE_SB_Buffer_t SBBuf;
+    uint8           Bytes[CFE_MISSION_SB_MAX_SB_MSG_SIZE];
+} UT_BenchTxBuf_t;
+
+/* State shared between the main test task and the worker tasks */
+typedef struct UT_BenchState
+{
+    /* Parameters of the current case, set up by the main task before starting the workers */
+    bool            ZeroCopy;
+    uint32          NumProducers;
+    uint32          NumSubscribers;
+    uint32          MsgsPerProducer;
+    size_t          MsgSize;
+    CFE_SB_PipeId_t PipeId[UT_BENCH_MAX_SUBSCRIBERS];
+    osal_id_t       CreditSem[UT_BENCH_MAX_SUBSCRIBERS];
+
+    /* Worker task control */
+    volatile bool Shutdown;
+    uint32        NextWorkerNum;
+    osal_id_t     StartSem;
+    osal_id_t     DoneSem;
+    osal_id_t     ProducerGoSem[UT_BENCH_MAX_PRODUCERS];
+    osal_id_t     SubscriberGoSem[UT_BENCH_MAX_SUBSCRIBERS];
+
+    /* Results of the current case */
+    uint32    SendCount[UT_BENCH_MAX_PRODUCERS];
+    uint32    RecvCount[UT_BENCH_MAX_SUBSCRIBERS];
+    OS_time_t EndTime[UT_BENCH_MAX_SUBSCRIBERS];
+    uint32    LatencyNs[UT_BENCH_MAX_SUBSCRIBERS][UT_BENCH_MSGS_PER_CASE];
+} UT_BenchState_t;
+
+static UT_BenchState_t UT_Bench;
+static UT_BenchTxBuf_t UT_BenchTxBuf[UT_BENCH_MAX_PRODUCERS];
+static uint32          UT_BenchSortedLatency[UT_BENCH_MAX_SUBSCRIBERS * UT_BENCH_MSGS_PER_CASE];
+
+/*
+ * This test procedure should be agnostic to specific MID values, but it should
+ * not overlap/interfere with real MIDs used by other apps.
+ */
+static CFE_SB_MsgId_t CFE_FT_BENCH_MSGID;
+
+void UT_BenchProducerTask(void)
+{
+    uint32           WorkerNum;
+    uint32           i;
+    uint32           j;
+    CFE_SB_Buffer_t *BufPtr;
+    UT_BenchMsg_t *  MsgPtr;
+
+    WorkerNum = UT_Bench.NextWorkerNum;
+    OS_BinSemGive(UT_Bench.StartSem);
+
+    while (OS_CountSemTake(UT_Bench.ProducerGoSem[WorkerNum]) == OS_SUCCESS && !UT_Bench.Shutdown)
+    {
+        for (i = 0; i < UT_Bench.MsgsPerProducer; ++i)
+        {
+            /* Wait for room in every subscriber pipe, always taken in the same order to avoid deadlock */
+            for (j = 0; j < UT_Bench.NumSubscribers; ++j)
+            {
+                CFE_Assert_STATUS_STORE(OS_CountSemTimedWait(UT_Bench.CreditSem[j], UT_BENCH_TIMEOUT));
+                if (!CFE_Assert_STATUS_SILENTCHECK(OS_SUCCESS))
+                {
+                    CFE_Assert_STATUS_MUST_BE(OS_SUCCESS);
+                    break;
+                }
+            }
+
+            if (j < UT_Bench.NumSubscribers)
+            {
+                break;
+            }
+
+            if (UT_Bench.ZeroCopy)
+            {
+                BufPtr = CFE_SB_AllocateMessageBuffer(UT_Bench.MsgSize);
+                if (BufPtr == NULL)
+                {
+                    UtAssert_NOT_NULL(BufPtr);
+                    break;
+                }
+
+                /* A zero copy buffer has to be initialized for every message, which is part of its cost */
+                MsgPtr = (void *)&BufPtr->Msg;
+                CFE_MSG_Init(CFE_MSG_PTR(MsgPtr->TelemetryHeader), CFE_FT_BENCH_MSGID, UT_Bench.MsgSize);
+            }
+            else
+            {
+                BufPtr = &UT_BenchTxBuf[WorkerNum].SBBuf;
+                MsgPtr = (void *)&BufPtr->Msg;
+            }
+
+            MsgPtr->ProducerNum = WorkerNum;
+            MsgPtr->Sequence    = i;
+            CFE_PSP_GetTime(&MsgPtr->SendTime);
+
+            if (UT_Bench.ZeroCopy)
+            {
+                CFE_Assert_STATUS_STORE(CFE_SB_TransmitBuffer(BufPtr, true));
+            }
+            else
+            {
+                CFE_Assert_STATUS_STORE(CFE_SB_TransmitMsg(CFE_MSG_PTR(MsgPtr->TelemetryHeader), true));
+            }
+
+            if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+            {
+                CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+                break;
+            }
+
+            ++UT_Bench.SendCount[WorkerNum];
+        }
+
+        OS_CountSemGive(UT_Bench.DoneSem);
+    }
+}
+
+void UT_BenchSubscriberTask(void)
+{
+    uint32               WorkerNum;
+    uint32               ExpectedCount;
+    CFE_SB_Buffer_t *    MsgBuf;
+    const UT_BenchMsg_t *MsgPtr;
+    OS_time_t            RecvTime;
+    int64                Latency;
+
+    WorkerNum = UT_Bench.NextWorkerNum;
+    OS_BinSemGive(UT_Bench.StartSem);
+
+    while (OS_CountSemTake(UT_Bench.SubscriberGoSem[WorkerNum]) == OS_SUCCESS && !UT_Bench.Shutdown)
+    {
+        ExpectedCount = UT_Bench.NumProducers * UT_Bench.MsgsPerProducer;
+
+        while (UT_Bench.RecvCount[WorkerNum] < ExpectedCount)
+        {
+            CFE_Assert_STATUS_STORE(CFE_SB_ReceiveBuffer(&MsgBuf, UT_Bench.PipeId[WorkerNum], UT_BENCH_TIMEOUT));
+            if (!CFE_Assert_STATUS_SILENTCHECK(CFE_SUCCESS))
+            {
+                CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS);
+                break;
+            }
+
+            CFE_PSP_GetTime(&RecvTime);
+
+            MsgPtr  = (const void *)MsgBuf;
+            Latency = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(RecvTime, MsgPtr->SendTime));
+            if (Latency < 0)
+            {
+                Latency = 0;
+            }
+            else if (Latency > 0xFFFFFFFF)
+            {
+                Latency = 0xFFFFFFFF;
+            }
+
+            UT_Bench.LatencyNs[WorkerNum][UT_Bench.RecvCount[WorkerNum]] = (uint32)Latency;
+            ++UT_Bench.RecvCount[WorkerNum];
+
+            OS_CountSemGive(UT_Bench.CreditSem[WorkerNum]);
+        }
+
+        CFE_PSP_GetTime(&UT_Bench.EndTime[WorkerNum]);
+        OS_CountSemGive(UT_Bench.DoneSem);
+    }
+}
+
+int UT_BenchCompareLatency(const void *Lhs, const void *Rhs)
+{
+    uint32 LhsValue = *((const uint32 *)Lhs);
+    uint32 RhsValue = *((const uint32 *)Rhs);
+
+    return (LhsValue > RhsValue) - (LhsValue < RhsValue);
+}
+
+/* Returns a percentile of the sorted latencies, PerMille is in tenths of a percent (990 = p99) */
+uint32 UT_BenchPercentile(uint32 NumSamples, uint32 PerMille)
+{
+    uint32 Index;
+
+    if (NumSamples == 0)
+    {
+        return 0;
+    }
+
+    Index = (uint32)(((uint64)NumSamples * PerMille) / 1000);
+    if (Index >= NumSamples)
+    {
+        Index = NumSamples - 1;
+    }
+
+    return UT_BenchSortedLatency[Index];
+}
+
+bool UT_BenchStartWorker(CFE_ES_ChildTaskMainFuncPtr_t Function, const char *Prefix, uint32 WorkerNum,
+                         uint16 Priority)
+{
+    CFE_ES_TaskId_t TaskId;
+    char            TaskName[OS_MAX_API_NAME];
+
+    snprintf(TaskName, sizeof(TaskName), "%s%u", Prefix, (unsigned int)WorkerNum);
+
+    /* The worker claims NextWorkerNum and then gives StartSem, so only one can be starting at a time */
+    UT_Bench.NextWorkerNum = WorkerNum;
+
+    CFE_Assert_STATUS_STORE(
+        CFE_ES_CreateChildTask(&TaskId, TaskName, Function, NULL, UT_BENCH_WORKER_STACK_SIZE, Priority, 0));
+    if (!CFE_Assert_STATUS_MUST_BE(CFE_SUCCESS))
+    {
+        return false;
+    }
+
+    return UtAssert_INT32_EQ(OS_BinSemTimedWait(UT_Bench.StartSem, UT_BENCH_TIMEOUT), OS_SUCCESS);
+}
+
+void UT_BenchRunCase(bool ZeroCopy, uint32 NumProducers, uint32 NumSubscribers, size_t MsgSize, uint16 PipeDepth)
+{
+    uint32    i;
+    uint32    Credits;
+    uint32    NumSamples;
+    uint32    TotalSent;
+    uint32    TotalRecv;
+    char      Name[OS_MAX_API_NAME];
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    int64     ElapsedNs;
+    uint64    MsgRate;
+
+    /* The smallest sizes cannot hold the benchmark header, so round them up and report the real size */
+    if (MsgSize < sizeof(UT_BenchMsg_t))
+    {
+        MsgSize = sizeof(UT_BenchMsg_t);
+    }
+
+    Credits = PipeDepth;
+    if (MsgSize * Credits > UT_BENCH_MAX_INFLIGHT_BYTES)
+    {
+        Credits = UT_BENCH_MAX_INFLIGHT_BYTES / MsgSize;
+    }
+    if (Credits == 0)
+    {
+        Credits = 1;
+    }
+
+    memset(UT_Bench.SendCount, 0, sizeof(UT_Bench.SendCount));
+    memset(UT_Bench.RecvCount, 0, sizeof(UT_Bench.RecvCount));
+
+    UT_Bench.ZeroCopy        = ZeroCopy;
+    UT_Bench.NumProducers    = NumProducers;
+    UT_Bench.NumSubscribers  = NumSubscribers;
+    UT_Bench.MsgsPerProducer = UT_BENCH_MSGS_PER_CASE / NumProducers;
+    UT_Bench.MsgSize         = MsgSize;
+
+    for (i = 0; i < NumSubscribers; ++i)
+    {
+        snprintf(Name, sizeof(Name), "SBBenchPipe%u", (unsigned int)i);
+        UtAssert_INT32_EQ(CFE_SB_CreatePipe(&UT_Bench.PipeId[i], PipeDepth, Name), CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_SB_SubscribeEx(CFE_FT_BENCH_MSGID, UT_Bench.PipeId[i], CFE_SB_DEFAULT_QOS, PipeDepth),
+                          CFE_SUCCESS);
+
+        snprintf(Name, sizeof(Name), "SBBenchCred%u", (unsigned int)i);
+        UtAssert_INT32_EQ(OS_CountSemCreate(&UT_Bench.CreditSem[i], Name, Credits, 0), OS_SUCCESS);
+    }
+
+    if (!ZeroCopy)
+    {
+        for (i = 0; i < NumProducers; ++i)
+        {
+            CFE_MSG_Init(CFE_MSG_PTR(((UT_BenchMsg_t *)&UT_BenchTxBuf[i])->TelemetryHeader), CFE_FT_BENCH_MSGID,
+                         MsgSize);
+        }
+    }
+
+    CFE_PSP_GetTime(&StartTime);
+
+    for (i = 0; i < NumSubscribers; ++i)
+    {
+        OS_CountSemGive(UT_Bench.SubscriberGoSem[i]);
+    }
+    for (i = 0; i < NumProducers; ++i)
+    {
+        OS_CountSemGive(UT_Bench.ProducerGoSem[i]);
+    }
+
+    /* Every wait inside the workers is bounded, so they always report back */
+    for (i = 0; i < NumProducers + NumSubscribers; ++i)
+    {
+        OS_CountSemTake(UT_Bench.DoneSem);
+    }
+
+    /* Subscribers finish after the last message is delivered, the latest one closes the measurement */
+    EndTime    = StartTime;
+    TotalSent  = 0;
+    TotalRecv  = 0;
+    NumSamples = 0;
+
+    for (i = 0; i < NumProducers; ++i)
+    {
+        TotalSent += UT_Bench.SendCount[i];
+    }
+
+    for (i = 0; i < NumSubscribers; ++i)
+    {
+        if (OS_TimeGetTotalNanoseconds(OS_TimeSubtract(UT_Bench.EndTime[i], EndTime)) > 0)
+        {
+            EndTime = UT_Bench.EndTime[i];
+        }
+
+        memcpy(&UT_BenchSortedLatency[NumSamples], UT_Bench.LatencyNs[i],
+               UT_Bench.RecvCount[i] * sizeof(UT_Bench.LatencyNs[i][0]));
+        NumSamples += UT_Bench.RecvCount[i];
+        TotalRecv += UT_Bench.RecvCount[i];
+    }
+
+    UtAssert_UINT32_EQ(TotalSent, NumProducers * UT_Bench.MsgsPerProducer);
+    UtAssert_UINT32_EQ(TotalRecv, TotalSent * NumSubscribers);
+
+    qsort(UT_BenchSortedLatency, NumSamples, sizeof(UT_BenchSortedLatency[0]), UT_BenchCompareLatency);
+
+    ElapsedNs = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(EndTime, StartTime));
+    MsgRate   = 0;
+    if (ElapsedNs > 0)
+    {
+        MsgRate = ((uint64)TotalSent * 1000000000) / (uint64)ElapsedNs;
+    }
+
+    UtAssert_MIR("SBBENCH,mode=%s,producers=%lu,subscribers=%lu,size=%lu,depth=%u,sent=%lu,delivered=%lu,"
+                 "elapsed_us=%lu,msgs_per_sec=%lu,p50_ns=%lu,p99_ns=%lu,p999_ns=%lu",
+                 ZeroCopy ? "zerocopy" : "copy", (unsigned long)NumProducers, (unsigned long)NumSubscribers,
+                 (unsigned long)MsgSize, (unsigned int)PipeDepth, (unsigned long)TotalSent,
+                 (unsigned long)TotalRecv, (unsigned long)(ElapsedNs / 1000), (unsigned long)MsgRate,
+                 (unsigned long)UT_BenchPercentile(NumSamples, 500),
+                 (unsigned long)UT_BenchPercentile(NumSamples, 990),
+                 (unsigned long)UT_BenchPercentile(NumSamples, 999));
+
+    for (i = 0; i < NumSubscribers; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_SB_DeletePipe(UT_Bench.PipeId[i]), CFE_SUCCESS);
+        UtAssert_INT32_EQ(OS_CountSemDelete(UT_Bench.CreditSem[i]), OS_SUCCESS);
+    }
+}
+
+void TestSBBenchmarkMatrix(void)
+{
+    uint32 i;
+    uint32 Mode;
+    uint32 ProdIdx;
+    uint32 SubIdx;
+    uint32 SizeIdx;
+    uint32 DepthIdx;
+    bool   WorkersReady;
+    char   Name[OS_MAX_API_NAME];
+
+    UtPrintf("Testing: SB benchmark matrix, results are reported on SBBENCH lines");
+
+    memset(&UT_Bench, 0, sizeof(UT_Bench));
+
+    UtAssert_INT32_EQ(OS_BinSemCreate(&UT_Bench.StartSem, "SBBenchStart", 0, 0), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_CountSemCreate(&UT_Bench.DoneSem, "SBBenchDone", 0, 0), OS_SUCCESS);
+
+    for (i = 0; i < UT_BENCH_MAX_PRODUCERS; ++i)
+    {
+        snprintf(Name, sizeof(Name), "SBBenchPGo%u", (unsigned int)i);
+        UtAssert_INT32_EQ(OS_CountSemCreate(&UT_Bench.ProducerGoSem[i], Name, 0, 0), OS_SUCCESS);
+    }
+    for (i = 0; i < UT_BENCH_MAX_SUBSCRIBERS; ++i)
+    {
+        snprintf(Name, sizeof(Name), "SBBenchSGo%u", (unsigned int)i);
+        UtAssert_INT32_EQ(OS_CountSemCreate(&UT_Bench.SubscriberGoSem[i], Name, 0, 0), OS_SUCCESS);
+    }
+
+    /* The workers are started once and reused by every case, they only exit when told to shut down */
+    WorkersReady = true;
+    for (i = 0; WorkersReady && i < UT_BENCH_MAX_PRODUCERS; ++i)
+    {
+        WorkersReady = UT_BenchStartWorker(UT_BenchProducerTask, "SBBenchP", i, UT_BENCH_PRODUCER_PRIORITY);
+    }
+    for (i = 0; WorkersReady && i < UT_BENCH_MAX_SUBSCRIBERS; ++i)
+    {
+        WorkersReady = UT_BenchStartWorker(UT_BenchSubscriberTask, "SBBenchS", i, UT_BENCH_SUBSCRIBER_PRIORITY);
+    }
+
+    for (Mode = 0; WorkersReady && Mode < 2; ++Mode)
+    {
+        for (ProdIdx = 0; ProdIdx < UT_BENCH_NUM_ENTRIES(UT_BenchProducerCounts); ++ProdIdx)
+        {
+            for (SubIdx = 0; SubIdx < UT_BENCH_NUM_ENTRIES(UT_BenchSubscriberCounts); ++SubIdx)
+            {
+                for (SizeIdx = 0; SizeIdx < UT_BENCH_NUM_ENTRIES(UT_BenchMsgSizes); ++SizeIdx)
+                {
+                    if (UT_BenchMsgSizes[SizeIdx] > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+                    {
+                        UtPrintf("Skipping size %lu, larger than CFE_MISSION_SB_MAX_SB_MSG_SIZE",
+                                 (unsigned long)UT_BenchMsgSizes[SizeIdx]);
+                        continue;
+                    }
+
+                    for (DepthIdx = 0; DepthIdx < UT_BENCH_NUM_ENTRIES(UT_BenchPipeDepths); ++DepthIdx)
+                    {
+                        UT_BenchRunCase(Mode != 0, UT_BenchProducerCounts[ProdIdx], UT_BenchSubscriberCounts[SubIdx],
+                                        UT_BenchMsgSizes[SizeIdx], UT_BenchPipeDepths[DepthIdx]);
+                    }
+                }
+            }
+        }
+    }
+
+    /* Wake every worker with the shutdown flag set so they self-exit */
+    UT_Bench.Shutdown = true;
+    for (i = 0; i < UT_BENCH_MAX_PRODUCERS; ++i)
+    {
+        OS_CountSemGive(UT_Bench.ProducerGoSem[i]);
+    }
+    for (i = 0; i < UT_BENCH_MAX_SUBSCRIBERS; ++i)
+    {
+        OS_CountSemGive(UT_Bench.SubscriberGoSem[i]);
+    }
+
+    /* Let the workers exit before their semaphores go away */
+    OS_TaskDelay(500);
+
+    for (i = 0; i < UT_BENCH_MAX_PRODUCERS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_CountSemDelete(UT_Bench.ProducerGoSem[i]), OS_SUCCESS);
+    }
+    for (i = 0; i < UT_BENCH_MAX_SUBSCRIBERS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_CountSemDelete(UT_Bench.SubscriberGoSem[i]), OS_SUCCESS);
+    }
+
+    UtAssert_INT32_EQ(OS_CountSemDelete(UT_Bench.DoneSem), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_BinSemDelete(UT_Bench.StartSem), OS_SUCCESS);
+}
+
+void SBBenchmarkTestSetup(void)
+{
+    CFE_FT_BENCH_MSGID = CFE_SB_ValueToMsgId(CFE_TEST_HK_TLM_MID);
+
+    UtTest_Add(TestSBBenchmarkMatrix, NULL, NULL, "SB Benchmark Matrix");
+}
@@ -858,6 +858,36 @@ char *CFE_ES_StatusToString(CFE_Status_t status, CFE_StatusString_t *status_stri
  */
 #define CFE_SB_BUFFER_INVALID ((CFE_Status_t)0xca00000e)
 
+/**
+ * @brief Max Mask Subscriptions Met
+ *
+ *  Will be returned when calling #CFE_SB_SubscribeMask if the number of
+ *  mask subscriptions in use meets the platform configuration parameter
+ *  #CFE_PLATFORM_SB_MAX_MASK_SUBS.
+ *
+ */
+#define CFE_SB_MAX_MASK_SUBS_MET ((CFE_Status_t)0xca00000f)
+
+/**
+ * @brief Pipe Set Busy
+ *
+ *  Will be returned when calling #CFE_SB_ReceiveBufferFromSet with a timeout
+ *  if one of the pipes is already being waited on by another task, or if
+ *  #CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS tasks are already waiting on sets.
+ *
+ */
+#define CFE_SB_PIPE_SET_BUSY ((CFE_Status_t)0xca000010)
+
+/**
+ * @brief Max Buffer Pools Met
+ *
+ *  Will be returned when calling #CFE_SB_CreateBufferPool if the number of
+ *  producer buffer pools in use meets the platform configuration parameter
+ *  #CFE_PLATFORM_SB_MAX_BUFFER_POOLS.
+ *
+ */
+#define CFE_SB_MAX_BUFFER_POOLS_MET ((CFE_Status_t)0xca000011)
+
 /**
  * @brief Not Implemented
  *
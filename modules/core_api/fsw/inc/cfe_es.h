@@ -1308,6 +1308,62 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
 CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
                                  const size_t *BlockSizes, bool UseMutex);
 
+/*****************************************************************************/
+/**
+** \brief Initializes a memory pool created by an application with application specified block sizes and options.
+**
+** \par Description
+**        This routine initializes a pool of memory supplied by the calling application, in the same way as
+**        #CFE_ES_PoolCreateEx.  Options that change how the pool works may be selected as well.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The size of the pool must be an integral number of 32-bit words
+**        -# The start address of the pool must be 32-bit aligned
+**        -# 168 bytes are used for internal bookkeeping, therefore, they will not be available for allocation.
+**        -# With #CFE_ES_POOLOPTS_TASK_CACHE, the per-task caches are taken from the start of the pool memory.
+**           Up to #CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS tasks get a cache holding at most
+**           #CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH free blocks of each size; other tasks use the shared pool.
+**           Blocks held in a cache are only available to the task holding them, and are returned to the
+**           pool when ES deletes that task.
+**        -# With #CFE_ES_POOLOPTS_ARENA, the \c NumBlockSizes and \c BlockSizes arguments are not used.  Any
+**           size that fits in the remaining pool memory may be requested, and buffers are only released by
+**           #CFE_ES_PoolReset.
+**
+** \param[out]   PoolID        A pointer to the variable the caller wishes to have the memory pool handle kept in
+**                             @nonnull.  PoolID is the memory pool handle.
+**
+** \param[in]   MemPtr         A Pointer to the pool of memory created by the calling application @nonnull.  This
+**                             address must be aligned suitably for the processor architecture.  The
+**                             #CFE_ES_STATIC_POOL_TYPE macro may be used to assist in creating properly aligned
+**                             memory pools.
+**
+** \param[in]   Size           The size of the pool of memory @nonzero.  Note that this must be an integral multiple
+**                             of the memory alignment of the processor architecture.
+**
+** \param[in]   NumBlockSizes  The number of different block sizes specified in the \c BlockSizes array. If set
+**                             larger than #CFE_PLATFORM_ES_POOL_MAX_BUCKETS, #CFE_ES_BAD_ARGUMENT will be returned.
+**                             If BlockSizes is null and NumBlockSizes is 0, NubBlockSizes will be set to
+**                             #CFE_PLATFORM_ES_POOL_MAX_BUCKETS.
+**
+** \param[in]   BlockSizes     Pointer to an array of sizes to be used instead of the default block sizes specified by
+**                             #CFE_PLATFORM_ES_MEM_BLOCK_SIZE_01 through #CFE_PLATFORM_ES_MAX_BLOCK_SIZE.  If the
+**                             pointer is equal to NULL, the default block sizes are used.
+**
+** \param[in]   PoolOpts       Options for the new memory pool, a combination of #CFE_ES_POOLOPTS_MUTEX and either
+**                             #CFE_ES_POOLOPTS_TASK_CACHE or #CFE_ES_POOLOPTS_ARENA, or 0 for none of them.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE  \copybrief CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL \covtest \copybrief CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+** \sa #CFE_ES_PoolCreateEx, #CFE_ES_PoolReset, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf, #CFE_ES_GetMemPoolStats
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_PoolCreateWithOpts(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                       const size_t *BlockSizes, uint32 PoolOpts);
+
 /*****************************************************************************/
 /**
 ** \brief Deletes a memory pool that was previously created
@@ -1368,7 +1424,8 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
 **        This routine gets info on a buffer in the memory pool.
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        Buffers from a pool created with #CFE_ES_POOLOPTS_ARENA carry no size information;
+**        #CFE_ES_BAD_ARGUMENT is returned for such pools.
 **
 ** \param[in]   Handle  The handle to the memory pool as returned by #CFE_ES_PoolCreate or #CFE_ES_PoolCreateNoSem.
 **
@@ -1393,7 +1450,8 @@ CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_
 **        This routine releases a buffer back into the memory pool.
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        Buffers from a pool created with #CFE_ES_POOLOPTS_ARENA cannot be released individually;
+**        #CFE_ES_BAD_ARGUMENT is returned for such pools.
 **
 ** \param[in]   Handle The handle to the memory pool as returned by #CFE_ES_PoolCreate or #CFE_ES_PoolCreateNoSem.
 **
@@ -1411,6 +1469,30 @@ CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_
 ******************************************************************************/
 int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr);
 
+/*****************************************************************************/
+/**
+** \brief Releases all buffers in a memory pool created with #CFE_ES_POOLOPTS_ARENA
+**
+** \par Description
+**        This routine returns an arena memory pool to its initial, empty state, so
+**        the entire pool is available again to #CFE_ES_GetPoolBuf.
+**
+** \par Assumptions, External Events, and Notes:
+**        All buffers previously obtained from the pool become invalid after this call.
+**        The count of requested blocks reported by #CFE_ES_GetMemPoolStats is not reset.
+**
+** \param[in]   Handle The handle to the memory pool as returned by #CFE_ES_PoolCreateWithOpts.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                     \copybrief CFE_SUCCESS
+** \retval #CFE_ES_ERR_RESOURCEID_NOT_VALID \copybrief CFE_ES_ERR_RESOURCEID_NOT_VALID
+** \retval #CFE_ES_BAD_ARGUMENT             \copybrief CFE_ES_BAD_ARGUMENT
+**
+** \sa #CFE_ES_PoolCreateWithOpts, #CFE_ES_GetPoolBuf, #CFE_ES_GetMemPoolStats
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_PoolReset(CFE_ES_MemHandle_t Handle);
+
 /*****************************************************************************/
 /**
 ** \brief Extracts the statistics maintained by the memory pool software
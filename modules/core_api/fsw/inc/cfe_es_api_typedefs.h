@@ -240,4 +240,36 @@ typedef void *CFE_ES_MemPoolBuf_t;
 #define CFE_ES_NO_MUTEX  false /**< \brief Indicates that the memory pool selection will not use a semaphore */
 #define CFE_ES_USE_MUTEX true  /**< \brief Indicates that the memory pool selection will use a semaphore */
 
+/** \name Memory Pool Options for CFE_ES_PoolCreateWithOpts() */
+/** \{ */
+
+/**
+ * \brief Serialize the operations on the memory pool with a mutex
+ *
+ * Same as passing #CFE_ES_USE_MUTEX to CFE_ES_PoolCreateEx().
+ */
+#define CFE_ES_POOLOPTS_MUTEX 0x01
+
+/**
+ * \brief Give each task a private cache of free blocks in the memory pool
+ *
+ * Blocks released by a task are kept in a small per-task, per-block-size
+ * stack and handed back to the same task without searching the shared
+ * free lists.  Only refilling or flushing a cache touches the shared pool.
+ * The size of a block is then reported as the size of its block size class.
+ * This option implies #CFE_ES_POOLOPTS_MUTEX.
+ */
+#define CFE_ES_POOLOPTS_TASK_CACHE 0x02
+
+/**
+ * \brief Create the memory pool as an arena for short-lived scratch buffers
+ *
+ * May be combined with #CFE_ES_POOLOPTS_MUTEX, but not with #CFE_ES_POOLOPTS_TASK_CACHE.
+ * Buffers are carved sequentially from the pool with no per-block descriptor,
+ * and cannot be released individually.  Instead, all buffers are released at
+ * once by calling CFE_ES_PoolReset(), typically at the end of a processing cycle.
+ */
+#define CFE_ES_POOLOPTS_ARENA 0x04
+/** \} */
+
 #endif /* CFE_ES_API_TYPEDEFS_H */
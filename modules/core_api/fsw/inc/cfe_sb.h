@@ -88,6 +88,57 @@
 **/
 CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName);
 
+/*****************************************************************************/
+/**
+** \brief Creates a new software bus pipe with options.
+**
+** \par Description
+**          This routine is the same as #CFE_SB_CreatePipe, but also sets the
+**          initial pipe options.  Some options, such as #CFE_SB_PIPEOPTS_RING,
+**          change how the pipe is built and can only be selected here.
+**
+** \par Assumptions, External Events, and Notes:
+**          A pipe created with #CFE_SB_PIPEOPTS_RING passes messages through a
+**          lock-free ring buffer in the SB memory pool instead of an OSAL queue,
+**          and only wakes the receiving task when it is actually waiting.  The
+**          ring holds Depth rounded up to the next power of 2 messages.  As
+**          with any pipe, only one task may receive from it.
+**
+**          A pipe created with #CFE_SB_PIPEOPTS_PRIORITY has a second, urgent
+**          lane next to the normal one.  Messages of subscriptions made through
+**          #CFE_SB_SubscribeEx with a Quality priority of #CFE_SB_QosPriority_HIGH
+**          go to the urgent lane, and receiving always drains the urgent lane
+**          before the normal one.  Messages keep their order within each lane.
+**          Both lanes are ring buffers, so this option implies
+**          #CFE_SB_PIPEOPTS_RING, and each lane holds as many messages as the
+**          ring of a pipe with only one lane.
+**
+** \param[out]  PipeIdPtr   A pointer to a variable of type #CFE_SB_PipeId_t @nonnull,
+**                          which will be filled in with the pipe ID information
+**                          by the #CFE_SB_CreatePipeEx routine. *PipeIdPtr is the identifier for the created pipe.
+**
+** \param[in]  Depth        The maximum number of messages that will be allowed on
+**                          this pipe at one time.
+**
+** \param[in]  PipeName     A string @nonnull to be used to identify this pipe in error messages
+**                          and routing information telemetry.  The string must be no
+**                          longer than #OS_MAX_API_NAME (including terminator).
+**                          Longer strings will be truncated.
+**
+** \param[in]  Opts         A bit field of options: \ref CFESBPipeOptions
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MAX_PIPES_MET \copybrief CFE_SB_MAX_PIPES_MET
+** \retval #CFE_SB_PIPE_CR_ERR   \copybrief CFE_SB_PIPE_CR_ERR
+** \retval #CFE_SB_BUF_ALOC_ERR  \copybrief CFE_SB_BUF_ALOC_ERR
+**
+** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_GetPipeOpts #CFE_SB_SetPipeOpts #CFE_SB_PIPEOPTS_RING
+**     #CFE_SB_PIPEOPTS_PRIORITY
+**/
+CFE_Status_t CFE_SB_CreatePipeEx(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName, uint8 Opts);
+
 /*****************************************************************************/
 /**
 ** \brief Delete a software bus pipe.
@@ -148,7 +199,9 @@ CFE_Status_t CFE_SB_PipeId_ToIndex(CFE_SB_PipeId_t PipeID, uint32 *Idx);
 **
 ** \par Description
 **          This routine sets (or clears) options to alter the pipe's behavior.
-**          Options are (re)set every call to this routine.
+**          Options are (re)set every call to this routine, except for
+**          #CFE_SB_PIPEOPTS_RING and #CFE_SB_PIPEOPTS_PRIORITY which are fixed
+**          when the pipe is created.
 **
 ** \param[in]  PipeId       The pipe ID of the pipe to set options on.
 **
@@ -181,6 +234,45 @@ CFE_Status_t CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts);
 **/
 CFE_Status_t CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptsPtr);
 
+/*****************************************************************************/
+/**
+** \brief Set the wakeup threshold of a pipe.
+**
+** \par Description
+**          This routine lets a high rate subscriber be woken once per group of
+**          messages instead of once per message.  While the task reading the
+**          pipe waits in #CFE_SB_ReceiveBuffer, it is only woken once MsgCount
+**          messages have arrived, or MaxDelayUsec microseconds have passed,
+**          whichever comes first.  Messages are still written to the pipe right
+**          away, so a reader polling with #CFE_SB_POLL sees them immediately.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Only pipes created with #CFE_SB_PIPEOPTS_RING support a wakeup
+**            threshold, an OSAL queue wakes its reader on every write.
+**          - Only the application that created the pipe may set its threshold.
+**          - A MsgCount of 0 or 1 wakes the reader on every message, which is
+**            the default.  Otherwise MaxDelayUsec must not be 0.
+**          - The delay is rounded up to whole milliseconds, and starts with the
+**            first message that is held back.  That message briefly wakes the
+**            reader so it can time the delay, a reader of an idle pipe is not
+**            woken until its own timeout.
+**          - Messages for the urgent lane of a #CFE_SB_PIPEOPTS_PRIORITY pipe
+**            always wake the reader.
+**
+** \param[in]  PipeId       The pipe ID of the pipe to set the threshold on.
+**
+** \param[in]  MsgCount     Number of messages that wake the reader.
+**
+** \param[in]  MaxDelayUsec Longest time a message may wait for the reader to be woken, in microseconds.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_CreatePipeEx #CFE_SB_ReceiveBuffer #CFE_SB_PIPEOPTS_RING
+**/
+CFE_Status_t CFE_SB_SetPipeWakeup(CFE_SB_PipeId_t PipeId, uint16 MsgCount, uint32 MaxDelayUsec);
+
 /*****************************************************************************/
 /**
 ** \brief Get the pipe name for a given id.
@@ -250,7 +342,10 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
 **
 ** \param[in]  Quality      The requested Quality of Service (QoS) required of
 **                          the messages. Most callers will use #CFE_SB_DEFAULT_QOS
-**                          for this parameter.
+**                          for this parameter.  A priority of #CFE_SB_QosPriority_HIGH
+**                          puts the messages on the urgent lane of a pipe created
+**                          with #CFE_SB_PIPEOPTS_PRIORITY, it has no effect on other
+**                          pipes.  Subscribing again does not change the lane.
 **
 ** \param[in]  MsgLim       The maximum number of messages with this Message ID to
 **                          allow in this pipe at the same time.
@@ -386,6 +481,125 @@ CFE_Status_t CFE_SB_Unsubscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId);
 ** \sa #CFE_SB_Subscribe, #CFE_SB_SubscribeEx, #CFE_SB_SubscribeLocal, #CFE_SB_Unsubscribe
 **/
 CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId);
+
+/*****************************************************************************/
+/**
+** \brief Subscribe to all messages matching a message ID mask
+**
+** \par Description
+**          This routine adds the specified pipe to the destination list of
+**          every message ID that is equal to MsgId in all the bits set in
+**          Mask, for example all the telemetry message IDs of one subsystem.
+**
+**          The match is resolved when the subscription is made rather than on
+**          each message.  Message IDs that already have a route get a
+**          destination for the pipe right away, and every other valid message
+**          ID that matches gets a route with a destination for the pipe, so
+**          each matching message ID takes one entry of the routing table.
+**
+** \par Assumptions, External Events, and Notes:
+**          - Destinations added through a mask subscription are local, they
+**            are not reported as subscriptions to peers.
+**          - A subscription to a single message ID on the same pipe takes over
+**            the destination, and #CFE_SB_Unsubscribe removes it even though
+**            the mask subscription remains.
+**          - Each destination counts against #CFE_PLATFORM_SB_MAX_DEST_PER_PKT,
+**            message IDs that are already at the limit are skipped.
+**          - If the routing table cannot hold a route for every matching
+**            message ID, the subscription fails and nothing is changed.  A
+**            narrow mask should be used to match only a few message IDs.
+**
+** \param[in]  MsgId        A message ID matching the subscription, the bits
+**                          not set in Mask are ignored.
+**
+** \param[in]  Mask         The bits of the message ID value that must match.
+**
+** \param[in]  PipeId       The pipe ID of the pipe the matching messages
+**                          should be sent to.
+**
+** \param[in]  MsgLim       The maximum number of messages with each matching
+**                          Message ID to allow in this pipe at the same time.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS              \copybrief CFE_SUCCESS
+** \retval #CFE_SB_MAX_MASK_SUBS_MET \copybrief CFE_SB_MAX_MASK_SUBS_MET
+** \retval #CFE_SB_MAX_MSGS_MET      \copybrief CFE_SB_MAX_MSGS_MET
+** \retval #CFE_SB_BAD_ARGUMENT      \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_SubscribeLocal, #CFE_SB_UnsubscribeMask
+**/
+CFE_Status_t CFE_SB_SubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId,
+                                  uint16 MsgLim);
+
+/*****************************************************************************/
+/**
+** \brief Remove a mask subscription
+**
+** \par Description
+**          This routine removes a subscription made with #CFE_SB_SubscribeMask,
+**          along with the destinations it added that no other mask subscription
+**          of the pipe still matches.
+**
+** \par Assumptions, External Events, and Notes:
+**          If the Pipe has no mask subscription with the same MsgId and Mask, the
+**          CFE_SB_UNSUB_NO_SUBS_EID event will be generated and #CFE_SUCCESS will
+**          be returned
+**
+** \param[in]  MsgId        The message ID given to #CFE_SB_SubscribeMask.
+**
+** \param[in]  Mask         The mask given to #CFE_SB_SubscribeMask.
+**
+** \param[in]  PipeId       The pipe ID of the pipe the matching messages
+**                          should no longer be sent to.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_SubscribeMask
+**/
+CFE_Status_t CFE_SB_UnsubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId);
+
+/*****************************************************************************/
+/**
+** \brief Limit the rate at which a subscription is delivered
+**
+** \par Description
+**          This routine lets a slow consumer, such as a bridge to a ground
+**          link, receive only part of a high rate message ID.  Messages that
+**          are not delivered are skipped when the destinations of the message
+**          are resolved, so they are never written to the pipe, never count
+**          against its limits, and never have to be received and discarded.
+**
+**          With a Decimation of N, one out of every N messages is delivered,
+**          starting with the next one.  With a MaxRateHz of X, messages are
+**          delivered at most X times per second, any message sent sooner than
+**          1/X seconds after the last one delivered is skipped.  If both are
+**          set, the rate limit applies to the messages left by the decimation.
+**
+** \par Assumptions, External Events, and Notes:
+**          - The pipe must already be subscribed to MsgId, and only the
+**            application that owns the pipe may change its delivery rate.
+**          - A Decimation of 0 or 1 and a MaxRateHz of 0 deliver every
+**            message, which is the default for a new subscription.
+**          - The rate limit uses the time of each transmit, so a late message
+**            may still be skipped even if it is the only one in a period.
+**
+** \param[in]  MsgId        The message ID of the subscription.
+**
+** \param[in]  PipeId       The pipe ID of the subscription.
+**
+** \param[in]  Decimation   Deliver one message out of this many.
+**
+** \param[in]  MaxRateHz    Most messages to deliver per second, 0 for no limit.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_Subscribe, #CFE_SB_SubscribeEx
+**/
+CFE_Status_t CFE_SB_SetDeliveryRate(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint16 Decimation, uint16 MaxRateHz);
 /**@}*/
 
 /** @defgroup CFEAPISBMessage cFE Send/Receive Message APIs
@@ -437,6 +651,39 @@ CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeI
 **/
 CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination);
 
+/*****************************************************************************/
+/**
+** \brief Transmit a message assembled from several fragments
+**
+** \par Description
+**          This routine works like #CFE_SB_TransmitMsg, except that the message
+**          is given as a list of fragments, such as a header followed by one or
+**          more payload parts.  The fragments are copied in order directly into
+**          a software bus buffer, so the caller does not need to assemble the
+**          message in a buffer of its own first.
+**
+**          Once the message is complete, its size is set to the total size of
+**          all fragments and, if IsOrigination is true, the message origination
+**          actions are applied as for #CFE_SB_TransmitMsg.
+**
+** \par Assumptions, External Events, and Notes:
+**          - The first fragment must hold at least the message header, with
+**            the message ID already set.  The size field in the header does
+**            not need to be set by the caller.
+**          - A fragment with a size of zero is skipped.
+**
+** \param[in]  FragArray     Array of message fragments @nonnull
+** \param[in]  FragCount     Number of entries in FragArray, at least one
+** \param[in]  IsOrigination Update the headers of the message
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+** \retval #CFE_SB_BUF_ALOC_ERR \covtest \copybrief CFE_SB_BUF_ALOC_ERR
+**/
+CFE_Status_t CFE_SB_TransmitMsgV(const CFE_SB_MsgFragment_t *FragArray, uint32 FragCount, bool IsOrigination);
+
 /*****************************************************************************/
 /**
 ** \brief Receive a message from a software bus pipe
@@ -478,6 +725,94 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
 **/
 CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut);
 
+/*****************************************************************************/
+/**
+** \brief Receive several messages from a software bus pipe
+**
+** \par Description
+**          This routine retrieves up to MaxCount messages from the specified pipe.
+**          If the pipe is empty, this routine will block until either a new
+**          message comes in or the timeout value is reached, exactly as
+**          #CFE_SB_ReceiveBuffer does.  Once the first message is received, any
+**          other messages already waiting on the pipe are returned as well, without
+**          waiting for more to arrive.
+**
+** \par Assumptions, External Events, and Notes:
+**          All returned buffers remain valid until the next call to #CFE_SB_ReceiveBuffer
+**          or #CFE_SB_ReceiveBufferBatch for the same pipe.  The number of buffers
+**          returned by a single call is limited to #CFE_PLATFORM_SB_MAX_RECEIVE_BATCH.
+**          If an error occurs in this API, the entries in BufArray are not valid.
+**
+** \param[in]  PipeId       The pipe ID of the pipe containing the messages to be obtained.
+**
+** \param[out] BufArray     Array to store pointers to the received software bus buffers @nonnull.
+**                          These should be used as read-only pointers.
+**
+** \param[in]  MaxCount     Number of entries in BufArray, must be at least 1.
+**
+** \param[in]  TimeOut      The number of milliseconds to wait for a new message if the
+**                          pipe is empty at the time of the call.  This can also be set
+**                          to #CFE_SB_POLL for a non-blocking receive or
+**                          #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \param[out] ReceivedCountPtr Number of buffers stored in BufArray @nonnull.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR  \covtest \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
+**/
+CFE_Status_t CFE_SB_ReceiveBufferBatch(CFE_SB_PipeId_t PipeId, CFE_SB_Buffer_t **BufArray, uint32 MaxCount,
+                                       int32 TimeOut, uint32 *ReceivedCountPtr);
+
+/*****************************************************************************/
+/**
+** \brief Receive a message from the first ready pipe of a set of pipes
+**
+** \par Description
+**          This routine retrieves the next message from any of the given pipes.
+**          The pipes are checked in the order given, so the first pipe in the list
+**          has the highest priority: a message waiting on an earlier pipe is always
+**          returned before one waiting on a later pipe.  If all the pipes are empty,
+**          this routine will block until a new message comes in on any of them or
+**          the timeout value is reached.  The calling task is woken by the transmit
+**          itself, it does not poll the pipes while waiting.
+**
+** \par Assumptions, External Events, and Notes:
+**          The returned buffer is valid until the next call to #CFE_SB_ReceiveBuffer,
+**          #CFE_SB_ReceiveBufferBatch or #CFE_SB_ReceiveBufferFromSet for the pipe it
+**          was received from.  Each call also releases the buffers from the previous
+**          call for every pipe in the list.  A pipe can only be waited on as part of
+**          one set at a time, and no more than #CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS
+**          tasks can be waiting on sets at once.
+**
+** \param[in, out] BufPtr   A pointer to the software bus buffer to receive to @nonnull.
+**                          This should be used as a read-only pointer.
+**
+** \param[in]  PipeIdList   The pipe IDs of the pipes to receive from, in priority order @nonnull.
+**
+** \param[in]  NumPipes     Number of entries in PipeIdList, from 1 to #CFE_PLATFORM_SB_MAX_PIPES_PER_SET.
+**
+** \param[in]  TimeOut      The number of milliseconds to wait for a new message if all the
+**                          pipes are empty at the time of the call.  This can also be set
+**                          to #CFE_SB_POLL for a non-blocking receive or
+**                          #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \param[out] ReadyPipeIdPtr Set to the pipe ID the message was received from, may be NULL.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS          \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT  \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT      \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR   \covtest \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE    \copybrief CFE_SB_NO_MESSAGE
+** \retval #CFE_SB_PIPE_SET_BUSY \copybrief CFE_SB_PIPE_SET_BUSY
+**/
+CFE_Status_t CFE_SB_ReceiveBufferFromSet(CFE_SB_Buffer_t **BufPtr, const CFE_SB_PipeId_t *PipeIdList, uint16 NumPipes,
+                                         int32 TimeOut, CFE_SB_PipeId_t *ReadyPipeIdPtr);
+
 /** @} */
 
 /** @defgroup CFEAPISBZeroCopy cFE Zero Copy APIs
@@ -590,6 +925,125 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr);
 **/
 CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IsOrigination);
 
+/*****************************************************************************/
+/**
+** \brief Transmit a set of buffers
+**
+** \par Description
+**          This routine sends several messages that have been created directly in
+**          internal SB message buffers (after calls to #CFE_SB_AllocateMessageBuffer).
+**          The result is the same as calling #CFE_SB_TransmitBuffer on each buffer in
+**          order, but the per-message software bus overhead is shared across the set,
+**          which improves performance for applications that send many messages at once.
+**
+**          Messages sent to the same pipe are written to it in the order they appear
+**          in the array.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The buffers are transmitted in order.  If a buffer fails validation (for
+**             instance it has an invalid message ID or size), the transmission stops
+**             at that buffer, and its error status is returned.
+**          -# The buffers before the one that failed are consumed, as by a successful call
+**             to #CFE_SB_TransmitBuffer.  The buffer that failed and all later buffers are
+**             still owned by the calling application.
+**          -# The number of buffers consumed is always stored in TransmitCountPtr, so that
+**             the application can determine which buffers it still owns.
+**          -# If the messages are sent but an error still occurs (for example the
+**             origination action fails), the status of the first such error is returned.
+**          -# Applications must not de-reference the consumed message pointers (for reading
+**             or writing) after this call.
+**
+** \param[in]  BufPtrArray       Array of pointers to the buffers to be sent @nonnull.
+** \param[in]  BufCount          Number of buffers in the array
+** \param[in]  IsOrigination     Update applicable header field(s) of newly constructed messages
+** \param[out] TransmitCountPtr  Number of buffers consumed by this call @nonnull
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+**/
+CFE_Status_t CFE_SB_TransmitBufferBatch(CFE_SB_Buffer_t *const *BufPtrArray, uint32 BufCount, bool IsOrigination,
+                                        uint32 *TransmitCountPtr);
+
+/*****************************************************************************/
+/**
+** \brief Create a pool of long-lived "zero copy" buffers owned by the caller.
+**
+** \par Description
+**          This routine allocates a set of software bus message buffers once, and
+**          keeps them for the calling application.  Buffers are then taken from the
+**          pool with #CFE_SB_AllocatePoolMessageBuffer and sent by reference with
+**          #CFE_SB_TransmitBuffer.  Once all recipients have finished reading a buffer,
+**          it goes straight back to the pool instead of the software bus memory pool,
+**          so a producer of large messages (image strips, science frames) sends them
+**          without copying the message and without allocating memory for each one.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The buffers are allocated from the software bus memory pool, and are counted
+**             as in use in the SB statistics for as long as the pool exists.
+**          -# All recipients share the same buffer, so they must not modify a received
+**             message.  A recipient that needs a modified copy must make its own.
+**          -# The pool is deleted with the application that created it.
+**
+** \param[out] PoolIdPtr   A pointer to a variable of type #CFE_SB_BufferPoolId_t @nonnull,
+**                         which will be initialized by this function.
+** \param[in]  MsgSize     The size of each message buffer (including the SB message header).
+** \param[in]  NumBuffers  The number of buffers in the pool, must be at least 1.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                 \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT         \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MAX_BUFFER_POOLS_MET \copybrief CFE_SB_MAX_BUFFER_POOLS_MET
+** \retval #CFE_SB_BUF_ALOC_ERR         \copybrief CFE_SB_BUF_ALOC_ERR
+**/
+CFE_Status_t CFE_SB_CreateBufferPool(CFE_SB_BufferPoolId_t *PoolIdPtr, size_t MsgSize, uint16 NumBuffers);
+
+/*****************************************************************************/
+/**
+** \brief Delete a pool of "zero copy" buffers.
+**
+** \par Description
+**          This routine deletes a pool created by #CFE_SB_CreateBufferPool.  The free
+**          buffers of the pool are given back to the software bus memory pool now, and
+**          each buffer that is still in use is given back when it is released.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Only the application that created the pool can delete it.
+**
+** \param[in]  PoolId  The pool ID of the pool to delete.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**/
+CFE_Status_t CFE_SB_DeleteBufferPool(CFE_SB_BufferPoolId_t PoolId);
+
+/*****************************************************************************/
+/**
+** \brief Get a "zero copy" buffer from a pool of the caller.
+**
+** \par Description
+**          This routine takes a free buffer from a pool created by
+**          #CFE_SB_CreateBufferPool.  The buffer is used exactly like a buffer from
+**          #CFE_SB_AllocateMessageBuffer: it is sent with #CFE_SB_TransmitBuffer or
+**          #CFE_SB_TransmitBufferBatch, or given back with #CFE_SB_ReleaseMessageBuffer.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Only the application that created the pool can take buffers from it.
+**          -# Unlike #CFE_SB_AllocateMessageBuffer, the buffer is not cleared.  It holds
+**             whatever the application last wrote into it, which allows message headers
+**             to be built only once per buffer.  The buffers are cleared when the pool
+**             is created.
+**
+** \param[in]  PoolId  The pool ID of the pool to take the buffer from.
+**
+** \return A pointer to a memory buffer that message data can be written to
+**         for use with CFE_SB_TransmitBuffer(), or NULL if the pool ID is not
+**         valid or all the buffers of the pool are in use.
+**/
+CFE_SB_Buffer_t *CFE_SB_AllocatePoolMessageBuffer(CFE_SB_BufferPoolId_t PoolId);
+
 /** @} */
 
 /** @defgroup CFEAPISBMessageCharacteristics cFE Message Characteristics APIs
@@ -124,12 +124,28 @@
  */
 #define CFE_SB_INVALID_PIPE CFE_SB_PIPEID_C(CFE_RESOURCEID_UNDEFINED)
 
+/**
+ * \brief Cast/Convert a generic CFE_ResourceId_t to a CFE_SB_BufferPoolId_t
+ */
+#define CFE_SB_BUFFERPOOLID_C(val) ((CFE_SB_BufferPoolId_t)CFE_RESOURCEID_WRAP(val))
+
+/**
+ * \brief  A CFE_SB_BufferPoolId_t value which is always invalid
+ *
+ * This may be used as a safe initializer for CFE_SB_BufferPoolId_t values
+ */
+#define CFE_SB_INVALID_BUFFER_POOL CFE_SB_BUFFERPOOLID_C(CFE_RESOURCEID_UNDEFINED)
+
 /**
  * @defgroup CFESBPipeOptions cFE SB Pipe options
  * @{
  */
 #define CFE_SB_PIPEOPTS_IGNOREMINE \
     0x00000001 /**< \brief Messages sent by the app that owns this pipe will not be sent to this pipe. */
+#define CFE_SB_PIPEOPTS_RING \
+    0x00000002 /**< \brief Pipe uses a lock-free ring buffer instead of an OSAL queue, see #CFE_SB_CreatePipeEx. */
+#define CFE_SB_PIPEOPTS_PRIORITY \
+    0x00000004 /**< \brief Pipe has an urgent lane for high priority subscriptions, see #CFE_SB_CreatePipeEx. */
 /**@}*/
 
 #define CFE_SB_DEFAULT_QOS ((CFE_SB_Qos_t) {0}) /**< \brief Default Qos macro */
@@ -146,4 +162,20 @@ typedef union CFE_SB_Msg
     long double       LongDouble; /**< \brief Align to support Long Double */
 } CFE_SB_Buffer_t;
 
+/**
+ * \brief One fragment of a message assembled by #CFE_SB_TransmitMsgV
+ */
+typedef struct CFE_SB_MsgFragment
+{
+    const void *DataPtr;  /**< \brief Start of the fragment content */
+    size_t      DataSize; /**< \brief Number of bytes in the fragment */
+} CFE_SB_MsgFragment_t;
+
+/**
+ * \brief Identifier of a producer buffer pool
+ *
+ * \sa CFE_SB_CreateBufferPool
+ */
+typedef CFE_RESOURCEID_BASE_TYPE CFE_SB_BufferPoolId_t;
+
 #endif /* CFE_SB_API_TYPEDEFS_H */
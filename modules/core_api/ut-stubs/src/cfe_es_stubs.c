@@ -711,6 +711,28 @@ CFE_Status_t CFE_ES_PoolCreateNoSem(CFE_ES_MemHandle_t *PoolID, void *MemPtr, si
     return UT_GenStub_GetReturnValue(CFE_ES_PoolCreateNoSem, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_PoolCreateWithOpts()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_PoolCreateWithOpts(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                       const size_t *BlockSizes, uint32 PoolOpts)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_PoolCreateWithOpts, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithOpts, CFE_ES_MemHandle_t *, PoolID);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithOpts, void *, MemPtr);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithOpts, size_t, Size);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithOpts, uint16, NumBlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithOpts, const size_t *, BlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateWithOpts, uint32, PoolOpts);
+
+    UT_GenStub_Execute(CFE_ES_PoolCreateWithOpts, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_PoolCreateWithOpts, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_PoolDelete()
@@ -727,6 +749,22 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
     return UT_GenStub_GetReturnValue(CFE_ES_PoolDelete, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_PoolReset()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_PoolReset(CFE_ES_MemHandle_t Handle)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_PoolReset, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_PoolReset, CFE_ES_MemHandle_t, Handle);
+
+    UT_GenStub_Execute(CFE_ES_PoolReset, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_PoolReset, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_ProcessAsyncEvent()
@@ -63,6 +63,22 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
     return UT_GenStub_GetReturnValue(CFE_SB_AllocateMessageBuffer, CFE_SB_Buffer_t *);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_AllocatePoolMessageBuffer()
+ * ----------------------------------------------------
+ */
+CFE_SB_Buffer_t *CFE_SB_AllocatePoolMessageBuffer(CFE_SB_BufferPoolId_t PoolId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_AllocatePoolMessageBuffer, CFE_SB_Buffer_t *);
+
+    UT_GenStub_AddParam(CFE_SB_AllocatePoolMessageBuffer, CFE_SB_BufferPoolId_t, PoolId);
+
+    UT_GenStub_Execute(CFE_SB_AllocatePoolMessageBuffer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_AllocatePoolMessageBuffer, CFE_SB_Buffer_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_CmdTopicIdToMsgId()
@@ -80,6 +96,24 @@ CFE_SB_MsgId_Atom_t CFE_SB_CmdTopicIdToMsgId(uint16 TopicId, uint16 InstanceNum)
     return UT_GenStub_GetReturnValue(CFE_SB_CmdTopicIdToMsgId, CFE_SB_MsgId_Atom_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_CreateBufferPool()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_CreateBufferPool(CFE_SB_BufferPoolId_t *PoolIdPtr, size_t MsgSize, uint16 NumBuffers)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_CreateBufferPool, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_CreateBufferPool, CFE_SB_BufferPoolId_t *, PoolIdPtr);
+    UT_GenStub_AddParam(CFE_SB_CreateBufferPool, size_t, MsgSize);
+    UT_GenStub_AddParam(CFE_SB_CreateBufferPool, uint16, NumBuffers);
+
+    UT_GenStub_Execute(CFE_SB_CreateBufferPool, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_CreateBufferPool, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_CreatePipe()
@@ -98,6 +132,41 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
     return UT_GenStub_GetReturnValue(CFE_SB_CreatePipe, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_CreatePipeEx()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_CreatePipeEx(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName, uint8 Opts)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_CreatePipeEx, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_CreatePipeEx, CFE_SB_PipeId_t *, PipeIdPtr);
+    UT_GenStub_AddParam(CFE_SB_CreatePipeEx, uint16, Depth);
+    UT_GenStub_AddParam(CFE_SB_CreatePipeEx, const char *, PipeName);
+    UT_GenStub_AddParam(CFE_SB_CreatePipeEx, uint8, Opts);
+
+    UT_GenStub_Execute(CFE_SB_CreatePipeEx, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_CreatePipeEx, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_DeleteBufferPool()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_DeleteBufferPool(CFE_SB_BufferPoolId_t PoolId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_DeleteBufferPool, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_DeleteBufferPool, CFE_SB_BufferPoolId_t, PoolId);
+
+    UT_GenStub_Execute(CFE_SB_DeleteBufferPool, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_DeleteBufferPool, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_DeletePipe()
@@ -354,6 +423,48 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReceiveBufferBatch()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReceiveBufferBatch(CFE_SB_PipeId_t PipeId, CFE_SB_Buffer_t **BufArray, uint32 MaxCount,
+                                       int32 TimeOut, uint32 *ReceivedCountPtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReceiveBufferBatch, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, CFE_SB_Buffer_t **, BufArray);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, uint32, MaxCount);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, int32, TimeOut);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferBatch, uint32 *, ReceivedCountPtr);
+
+    UT_GenStub_Execute(CFE_SB_ReceiveBufferBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBufferBatch, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReceiveBufferFromSet()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReceiveBufferFromSet(CFE_SB_Buffer_t **BufPtr, const CFE_SB_PipeId_t *PipeIdList, uint16 NumPipes,
+                                         int32 TimeOut, CFE_SB_PipeId_t *ReadyPipeIdPtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReceiveBufferFromSet, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferFromSet, CFE_SB_Buffer_t **, BufPtr);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferFromSet, const CFE_SB_PipeId_t *, PipeIdList);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferFromSet, uint16, NumPipes);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferFromSet, int32, TimeOut);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBufferFromSet, CFE_SB_PipeId_t *, ReadyPipeIdPtr);
+
+    UT_GenStub_Execute(CFE_SB_ReceiveBufferFromSet, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBufferFromSet, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_ReleaseMessageBuffer()
@@ -370,6 +481,25 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
     return UT_GenStub_GetReturnValue(CFE_SB_ReleaseMessageBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_SetDeliveryRate()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_SetDeliveryRate(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint16 Decimation, uint16 MaxRateHz)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_SetDeliveryRate, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_SetDeliveryRate, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(CFE_SB_SetDeliveryRate, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_SetDeliveryRate, uint16, Decimation);
+    UT_GenStub_AddParam(CFE_SB_SetDeliveryRate, uint16, MaxRateHz);
+
+    UT_GenStub_Execute(CFE_SB_SetDeliveryRate, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_SetDeliveryRate, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_SetPipeOpts()
@@ -387,6 +517,24 @@ CFE_Status_t CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts)
     return UT_GenStub_GetReturnValue(CFE_SB_SetPipeOpts, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_SetPipeWakeup()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_SetPipeWakeup(CFE_SB_PipeId_t PipeId, uint16 MsgCount, uint32 MaxDelayUsec)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_SetPipeWakeup, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_SetPipeWakeup, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_SetPipeWakeup, uint16, MsgCount);
+    UT_GenStub_AddParam(CFE_SB_SetPipeWakeup, uint32, MaxDelayUsec);
+
+    UT_GenStub_Execute(CFE_SB_SetPipeWakeup, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_SetPipeWakeup, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_SetUserDataLength()
@@ -454,6 +602,26 @@ CFE_Status_t CFE_SB_SubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId,
     return UT_GenStub_GetReturnValue(CFE_SB_SubscribeLocal, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_SubscribeMask()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_SubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId,
+                                  uint16 MsgLim)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_SubscribeMask, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_SubscribeMask, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(CFE_SB_SubscribeMask, CFE_SB_MsgId_Atom_t, Mask);
+    UT_GenStub_AddParam(CFE_SB_SubscribeMask, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_SubscribeMask, uint16, MsgLim);
+
+    UT_GenStub_Execute(CFE_SB_SubscribeMask, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_SubscribeMask, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_TimeStampMsg()
@@ -500,6 +668,26 @@ CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IsOrigination)
     return UT_GenStub_GetReturnValue(CFE_SB_TransmitBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitBufferBatch()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitBufferBatch(CFE_SB_Buffer_t *const *BufPtrArray, uint32 BufCount, bool IsOrigination,
+                                        uint32 *TransmitCountPtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitBufferBatch, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferBatch, CFE_SB_Buffer_t *const *, BufPtrArray);
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferBatch, uint32, BufCount);
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferBatch, bool, IsOrigination);
+    UT_GenStub_AddParam(CFE_SB_TransmitBufferBatch, uint32 *, TransmitCountPtr);
+
+    UT_GenStub_Execute(CFE_SB_TransmitBufferBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitBufferBatch, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_TransmitMsg()
@@ -517,6 +705,24 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
     return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsg, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitMsgV()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitMsgV(const CFE_SB_MsgFragment_t *FragArray, uint32 FragCount, bool IsOrigination)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitMsgV, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgV, const CFE_SB_MsgFragment_t *, FragArray);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgV, uint32, FragCount);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgV, bool, IsOrigination);
+
+    UT_GenStub_Execute(CFE_SB_TransmitMsgV, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsgV, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_Unsubscribe()
@@ -550,3 +756,21 @@ CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeI
 
     return UT_GenStub_GetReturnValue(CFE_SB_UnsubscribeLocal, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_UnsubscribeMask()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_UnsubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_UnsubscribeMask, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_UnsubscribeMask, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(CFE_SB_UnsubscribeMask, CFE_SB_MsgId_Atom_t, Mask);
+    UT_GenStub_AddParam(CFE_SB_UnsubscribeMask, CFE_SB_PipeId_t, PipeId);
+
+    UT_GenStub_Execute(CFE_SB_UnsubscribeMask, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_UnsubscribeMask, CFE_Status_t);
+}
@@ -0,0 +1,89 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Atomic access helpers for CFE core modules
+ *
+ * Most CFE core state is protected by a per-module shared data lock.  The few
+ * items that are deliberately accessed outside of that lock (for instance on
+ * the software bus transmit path) must use these macros so that every access
+ * to the item is atomic and ordered consistently.
+ *
+ * The core is built as C99, so C11 <stdatomic.h> cannot be relied upon.  These
+ * map onto the compiler atomic builtins instead, which are provided by all GCC
+ * and Clang based toolchains.  The macros are type generic and may be used on
+ * any naturally aligned integer or pointer object of up to pointer size.
+ *
+ * All operations are sequentially consistent.
+ */
+
+#ifndef CFE_CORE_ATOMIC_H
+#define CFE_CORE_ATOMIC_H
+
+#include "common_types.h"
+
+#ifndef __GNUC__
+#error "CFE core atomic helpers require a toolchain providing the __atomic builtins"
+#endif
+
+/**
+ * \brief Atomically read the object at Ptr
+ */
+#define CFE_ATOMIC_LOAD(Ptr) __atomic_load_n((Ptr), __ATOMIC_SEQ_CST)
+
+/**
+ * \brief Atomically write Val to the object at Ptr
+ */
+#define CFE_ATOMIC_STORE(Ptr, Val) __atomic_store_n((Ptr), (Val), __ATOMIC_SEQ_CST)
+
+/**
+ * \brief Atomically write Val to the object at Ptr, evaluating to the previous value
+ */
+#define CFE_ATOMIC_EXCHANGE(Ptr, Val) __atomic_exchange_n((Ptr), (Val), __ATOMIC_SEQ_CST)
+
+/**
+ * \brief Atomically add Val to the object at Ptr, evaluating to the updated value
+ */
+#define CFE_ATOMIC_ADD_FETCH(Ptr, Val) __atomic_add_fetch((Ptr), (Val), __ATOMIC_SEQ_CST)
+
+/**
+ * \brief Atomically subtract Val from the object at Ptr, evaluating to the updated value
+ */
+#define CFE_ATOMIC_SUB_FETCH(Ptr, Val) __atomic_sub_fetch((Ptr), (Val), __ATOMIC_SEQ_CST)
+
+/**
+ * \brief Atomically replace the object at Ptr with Desired if it still holds *ExpectedPtr
+ *
+ * Evaluates to true if the object was updated.  Otherwise the current value
+ * of the object is written to *ExpectedPtr and this evaluates to false, so
+ * the operation can be retried in a loop.
+ */
+#define CFE_ATOMIC_COMPARE_EXCHANGE(Ptr, ExpectedPtr, Desired) \
+    __atomic_compare_exchange_n((Ptr), (ExpectedPtr), (Desired), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+
+/**
+ * \brief Order all memory accesses before this against all memory accesses after it
+ *
+ * Needed where data that is not itself accessed atomically is guarded by an
+ * atomic item, such as a sequence count checked before and after reading it.
+ */
+#define CFE_ATOMIC_FENCE() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#endif /* CFE_CORE_ATOMIC_H */
@@ -44,7 +44,14 @@ typedef struct CFE_SB_DestinationD
     uint16                      BuffCount;
     uint16                      DestCnt;
     uint8                       Scope;
-    uint8                       Spare[3];
+    uint8                       IsMaskDest;
+    uint8                       IsUrgent;
+    uint8                       Spare;
+    uint32                      Decimation;
+    uint32                      DecimationCount;
+    uint32                      MinInterval;
+    uint32                      LastDelivery;
+    uint32                      LastDeliveryEpoch;
     struct CFE_SB_DestinationD *Prev;
     struct CFE_SB_DestinationD *Next;
 } CFE_SB_DestinationD_t;
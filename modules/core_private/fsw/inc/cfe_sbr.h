@@ -51,8 +51,9 @@ void CFE_SBR_Init(void);
  *  \brief Add a route for the given message id
  *
  *  Called for the first subscription to a message ID, uses up one
- *  element in the routing table.  Assumes check for existing
- *  route was already performed or routes could leak
+ *  element in the routing table, reusing a released route if there
+ *  is one.  Assumes check for existing route was already performed
+ *  or routes could leak
  *
  *  \param[in]  MsgId         Message ID of the route to add
  *  \param[out] CollisionsPtr Number of collisions (if not null)
@@ -61,6 +62,29 @@ void CFE_SBR_Init(void);
  */
 CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr);
 
+/**
+ *  \brief Remove a route
+ *
+ *  Called once the last destination of a route has been removed.  The
+ *  message ID no longer maps to the route, and the route is skipped by
+ *  CFE_SBR_ForEachRouteId().  A lookup running without the lock may
+ *  still be using the route ID, so the route is not reused until
+ *  CFE_SBR_ReleaseRemovedRoutes() has been called twice.
+ *
+ *  \param[in] RouteId Route ID of the route to remove
+ */
+void CFE_SBR_RemoveRoute(CFE_SBR_RouteId_t RouteId);
+
+/**
+ *  \brief Release the routes removed before the previous release
+ *
+ *  Routes are released one generation at a time: those removed before
+ *  the previous call become reusable, while those removed since are held
+ *  back until the next call.  Must only be called once no lookup that
+ *  started before the previous call can still be using a route ID.
+ */
+void CFE_SBR_ReleaseRemovedRoutes(void);
+
 /**
  *  \brief Obtain the route id given a message id
  *
@@ -100,9 +124,14 @@ void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t
 /**
  * \brief Increment the sequence counter associated with the supplied route ID
  *
+ * The update is atomic, so concurrent transmitters on the same route each
+ * obtain a distinct sequence value without holding the SB shared data lock.
+ *
  * \param[in] RouteId Route ID
+ *
+ * \returns the updated sequence counter, or 0 if the route ID is not valid
  */
-void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId);
+CFE_MSG_SequenceCount_t CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId);
 
 /**
  * \brief Get the sequence counter associated with the supplied route ID
@@ -116,7 +145,8 @@ CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId);
 /**
  * \brief Call the supplied callback function for all routes
  *
- * Invokes callback for each route in the table.  Message ID order
+ * Invokes callback for each route in use in the table, removed routes
+ * are skipped.  The callback may remove the route.  Message ID order
  * depends on the routing table implementation.  Possibilities include
  * in subscription order and in order if incrementing message ids.
  *
@@ -126,6 +156,16 @@ CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId);
  */
 void CFE_SBR_ForEachRouteId(CFE_SBR_CallbackPtr_t CallbackPtr, void *ArgPtr, CFE_SBR_Throttle_t *ThrottlePtr);
 
+/**
+ * \brief Get the probe length statistics of the message map
+ *
+ * Reports how many map entries are visited when looking up the message IDs
+ * currently in the map, which depends on the map implementation selected.
+ *
+ * \param[out] StatsPtr Buffer to store the statistics in
+ */
+void CFE_SBR_GetMapStats(CFE_SBR_MapStats_t *StatsPtr);
+
 /******************************************************************************
 ** Inline functions
 */
@@ -68,6 +68,19 @@ typedef struct
     uint32 NextIndex;  /**< /brief Next start index (output), 0 if completed */
 } CFE_SBR_Throttle_t;
 
+/** \brief Message map probe length statistics
+ *
+ * The probe length of a message ID is the number of map entries that must
+ * be skipped before the entry for that message ID is found.  It is always
+ * zero for the direct map.
+ */
+typedef struct
+{
+    uint32 NumEntries;       /**< \brief Number of message IDs in the map */
+    uint32 MaxProbeLength;   /**< \brief Longest probe length of any message ID in the map */
+    uint32 TotalProbeLength; /**< \brief Sum of the probe lengths of all message IDs in the map */
+} CFE_SBR_MapStats_t;
+
 /** \brief For each id callback function prototype */
 typedef void (*CFE_SBR_CallbackPtr_t)(CFE_SBR_RouteId_t RouteId, void *ArgPtr);
 
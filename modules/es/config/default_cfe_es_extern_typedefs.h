@@ -564,4 +564,28 @@ typedef struct CFE_ES_MemPoolStats
                                                                           \brief Contains stats on each block size */
 } CFE_ES_MemPoolStats_t;
 
+/**
+ * \brief Memory Pool Block Map Entry
+ *
+ * Structure that is used to provide information about one block of a memory
+ * pool.  It is used for the Write Memory Pool Map (#CFE_ES_WRITE_MEM_POOL_MAP_CC)
+ * command, which writes one entry for every block created in each pool.
+ *
+ * @note There is not currently a telemetry message directly containing this
+ * data structure, but it does define the format of the data file generated
+ * by the Write Memory Pool Map command.  Therefore it should be considered
+ * part of the overall telemetry interface.
+ */
+typedef struct CFE_ES_MemPoolMapEntry
+{
+    CFE_ES_MemHandle_t PoolHandle;  /**< \brief Handle of the memory pool containing the block */
+    CFE_ES_MemOffset_t Offset;      /**< \brief Offset of the block from the start of the pool memory */
+    CFE_ES_MemOffset_t BlockSize;   /**< \brief Block size of the bucket the block belongs to */
+    CFE_ES_MemOffset_t ActualSize;  /**< \brief Size requested when the block was last allocated */
+    CFE_ES_MemOffset_t WastedBytes; /**< \brief Bytes of an allocated block beyond ActualSize, 0 if free */
+    uint16             BucketId;    /**< \brief Bucket number, counting from 1 for the largest block size */
+    bool               Allocated;   /**< \brief Flag that indicates whether the block is currently allocated */
+    uint8              Spare;       /**< \brief Spare byte to ensure structure size is multiple of 4 bytes */
+} CFE_ES_MemPoolMapEntry_t;
+
 #endif /* CFE_ES_EXTERN_TYPEDEFS_H */
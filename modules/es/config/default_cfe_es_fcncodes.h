@@ -1031,6 +1031,56 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC 24
 
+/** \cfeescmd Write the Block Map of All Memory Pools to a File
+**
+**  \par Description
+**       This command writes an entry for every block that has been created in
+**       each memory pool to the specified file.  Each entry gives the offset of
+**       the block, the block size of its bucket, whether it is allocated, and
+**       the number of bytes of the block not used by the size last requested.
+**       The wasted bytes show the internal fragmentation of the pool, which
+**       may be used to tune the block sizes of the pool.  Pools created with
+**       #CFE_ES_POOLOPTS_ARENA do not have blocks and are not included.
+**
+**  \cfecmdmnemonic \ES_WRITEPOOLMAP2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WriteMemPoolMapCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment.
+**         NOTE: the command counter is incremented when the request is accepted,
+**         before writing the file, which is performed as a background task.
+**       - The #CFE_ES_MEMPOOL_MAP_EID debug event message will be
+**         generated when the file is complete, with the total of wasted bytes.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_MEMPOOL_MAP_FILE configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write the block map has not yet completed
+**       - The file name specified could not be parsed
+**       - An Error occurs while trying to write to the file
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_SEND_MEM_POOL_STATS_CC
+*/
+#define CFE_ES_WRITE_MEM_POOL_MAP_CC 25
+
 /** \} */
 
 #endif
@@ -464,6 +464,20 @@
 */
 #define CFE_PLATFORM_ES_DEFAULT_CDS_REG_DUMP_FILE "/ram/cfe_cds_reg.log"
 
+/**
+**  \cfeescfg Default Memory Pool Block Map Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       block map of all memory pools. This filename is used only when no filename is
+**       specified in the command to write the memory pool block map.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_MEMPOOL_MAP_FILE "/ram/cfe_es_poolmap.dat"
+
 /**
 **  \cfeescfg Define Default System Log Mode following Power On Reset
 **
@@ -711,6 +725,33 @@
 */
 #define CFE_PLATFORM_ES_MAX_MEMORY_POOLS 10
 
+/** \cfeescfg Maximum number of tasks with a block cache in a memory pool
+**
+**  \par Description:
+**      Pools created with #CFE_ES_POOLOPTS_TASK_CACHE give each task that
+**      uses them a private cache of free blocks.  This sets how many tasks
+**      can hold a cache in a single pool at once; any further tasks use the
+**      shared pool directly.  The caches are taken from the pool memory, so
+**      larger values leave less room for blocks.
+**
+**  \par Limits:
+**       Must be at least one.  No specific upper limit.
+*/
+#define CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS 4
+
+/** \cfeescfg Number of free blocks held by a memory pool task cache
+**
+**  \par Description:
+**      The number of free blocks of each block size that a task cache of a
+**      pool created with #CFE_ES_POOLOPTS_TASK_CACHE can hold.  An empty
+**      cache is refilled, and a full cache is flushed, half this many blocks
+**      at a time.
+**
+**  \par Limits:
+**       Must be at least 2.  No specific upper limit.
+*/
+#define CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH 8
+
 /**
 **  \cfeescfg Define Default ES Memory Pool Block Sizes
 **
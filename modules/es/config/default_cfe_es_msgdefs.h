@@ -52,7 +52,7 @@ typedef struct CFE_ES_RestartCmd_Payload
 **
 ** This format is shared by several executive services commands.
 ** For command details, see #CFE_ES_QUERY_ALL_CC, #CFE_ES_QUERY_ALL_TASKS_CC,
-** #CFE_ES_WRITE_SYS_LOG_CC, and #CFE_ES_WRITE_ER_LOG_CC
+** #CFE_ES_WRITE_SYS_LOG_CC, #CFE_ES_WRITE_ER_LOG_CC, and #CFE_ES_WRITE_MEM_POOL_MAP_CC
 **
 **/
 typedef struct CFE_ES_FileNameCmd_Payload
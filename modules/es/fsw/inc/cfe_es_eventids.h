@@ -1057,6 +1057,43 @@
  *  a write already being in progress.
  */
 #define CFE_ES_ERLOG_PENDING_ERR_EID 93
+
+/**
+ * \brief ES Write Memory Pool Block Map Complete Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_MEM_POOL_MAP_CC ES Write Memory Pool Block Map Command \endlink
+ *  successfully completed.  The event includes the number of blocks written and the
+ *  total of wasted bytes in the allocated blocks.
+ */
+#define CFE_ES_MEMPOOL_MAP_EID 94
+
+/**
+ * \brief ES Write Memory Pool Block Map Command Request or File Creation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_MEM_POOL_MAP_CC ES Write Memory Pool Block Map Command \endlink request failed or
+ *  file creation failed. OVERLOADED
+ */
+#define CFE_ES_MEMPOOL_MAP_ERR_EID 95
+
+/**
+ * \brief ES Write Memory Pool Block Map Command Already In Progress Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_MEM_POOL_MAP_CC ES Write Memory Pool Block Map Command \endlink failure due to
+ *  a write already being in progress.
+ */
+#define CFE_ES_MEMPOOL_MAP_PENDING_ERR_EID 96
 /**\}*/
 
 #endif /* CFE_ES_EVENTS_H */
@@ -1463,6 +1463,14 @@ CFE_Status_t CFE_ES_DeleteChildTask(CFE_ES_TaskId_t TaskId)
         }
 
         CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        /*
+        ** Return any memory pool blocks held in task caches
+        */
+        if (ReturnCode == CFE_SUCCESS)
+        {
+            CFE_ES_MemPoolFlushTaskCache(TaskId);
+        }
     }
     else
     {
@@ -1485,6 +1493,7 @@ void CFE_ES_ExitChildTask(void)
 {
     CFE_ES_AppRecord_t * AppRecPtr;
     CFE_ES_TaskRecord_t *TaskRecPtr;
+    CFE_ES_TaskId_t      TaskId;
 
     CFE_ES_LockSharedData(__func__, __LINE__);
 
@@ -1503,11 +1512,17 @@ void CFE_ES_ExitChildTask(void)
             /*
             ** Invalidate the task table entry
             */
+            TaskId = CFE_ES_TaskRecordGetID(TaskRecPtr);
             CFE_ES_TaskRecordSetFree(TaskRecPtr);
             CFE_ES_Global.RegisteredTasks--;
 
             CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+            /*
+            ** Return any memory pool blocks held in task caches
+            */
+            CFE_ES_MemPoolFlushTaskCache(TaskId);
+
             /*
             ** Call the OS AL routine
             */
@@ -1703,6 +1703,11 @@ int32 CFE_ES_CleanupTaskResources(CFE_ES_TaskId_t TaskId)
         Result = CFE_ES_TASK_DELETE_ERR;
     }
 
+    /*
+    ** Return any memory pool blocks held in task caches
+    */
+    CFE_ES_MemPoolFlushTaskCache(TaskId);
+
     return Result;
 }
 
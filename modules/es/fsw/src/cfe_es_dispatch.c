@@ -266,6 +266,13 @@ void CFE_ES_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
                     }
                     break;
 
+                case CFE_ES_WRITE_MEM_POOL_MAP_CC:
+                    if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteMemPoolMapCmd_t)))
+                    {
+                        CFE_ES_WriteMemPoolMapCmd((const CFE_ES_WriteMemPoolMapCmd_t *)SBBufPtr);
+                    }
+                    break;
+
                 default:
                     CFE_EVS_SendEvent(CFE_ES_CC1_ERR_EID, CFE_EVS_EventType_ERROR,
                                       "Invalid ground command code: ID = 0x%X, CC = %d",
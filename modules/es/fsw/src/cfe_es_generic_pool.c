@@ -43,6 +43,42 @@
 ** Functions
 */
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Compute the power-of-two size class of a block size
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_ES_GenPoolSizeClass(size_t ReqSize)
+{
+    size_t Value;
+    uint16 Shift;
+    uint16 SizeClass;
+
+    if (ReqSize <= 1)
+    {
+        return 0;
+    }
+
+    /*
+     * Find the position of the highest set bit of (ReqSize - 1) by
+     * successive halving, so the cost is fixed regardless of the value.
+     */
+    Value     = ReqSize - 1;
+    SizeClass = 1;
+    for (Shift = sizeof(size_t) * 4; Shift != 0; Shift >>= 1)
+    {
+        if ((Value >> Shift) != 0)
+        {
+            Value >>= Shift;
+            SizeClass += Shift;
+        }
+    }
+
+    return SizeClass;
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -54,13 +90,20 @@ uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSi
 {
     uint16 Index;
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    /*
+     * Start at the first bucket that could fit anything in this size class,
+     * then step over any smaller buckets within the same class.
+     */
+    Index = PoolRecPtr->SizeClassIndex[CFE_ES_GenPoolSizeClass(ReqSize)];
+    while (Index < PoolRecPtr->NumBuckets && ReqSize > PoolRecPtr->Buckets[Index].BlockSize)
+    {
+        ++Index;
+    }
+
+    if (Index >= PoolRecPtr->NumBuckets)
     {
-        if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
-        {
-            /* it fits - stop here */
-            break;
-        }
+        /* no bucket is large enough */
+        return 0;
     }
 
     /*
@@ -238,6 +281,7 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
     cpuaddr                 AlignMask;
     uint32                  i;
     uint32                  j;
+    size_t                  MinSize;
     CFE_ES_GenPoolBucket_t *BucketPtr;
 
     /*
@@ -316,6 +360,30 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    /*
+     * Build the size class table - for each class, record the first bucket
+     * that is at least as large as the smallest size in that class.
+     */
+    j = 0;
+    for (i = 0; i < CFE_ES_GENERIC_POOL_SIZE_CLASSES; ++i)
+    {
+        if (i == 0)
+        {
+            MinSize = 0;
+        }
+        else
+        {
+            MinSize = ((size_t)1 << (i - 1)) + 1;
+        }
+
+        while (j < NumBlockSizes && PoolRecPtr->Buckets[j].BlockSize < MinSize)
+        {
+            ++j;
+        }
+
+        PoolRecPtr->SizeClassIndex[i] = j;
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -423,6 +491,120 @@ int32 CFE_ES_GenPoolGetBlockSize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *Blo
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolGetBlockInfo(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Position,
+                                 CFE_ES_GenPoolBlockInfo_t *InfoPtr)
+{
+    size_t                  StartPosition;
+    size_t                  BlockOffset;
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    int32                   Status;
+    uint16                  BucketId;
+    bool                    IsAllocated;
+
+    StartPosition = PoolRecPtr->PoolMaxOffset - PoolRecPtr->PoolTotalSize;
+    if (Position < StartPosition)
+    {
+        Position = StartPosition;
+    }
+
+    /* Same alignment as applied when the block was created */
+    BlockOffset = Position + CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+    BlockOffset += PoolRecPtr->AlignMask;
+    BlockOffset &= ~PoolRecPtr->AlignMask;
+
+    if (BlockOffset >= PoolRecPtr->TailPosition)
+    {
+        /* no more blocks have been created beyond this position */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    BucketPtr   = NULL;
+    BucketId    = 0;
+    IsAllocated = false;
+
+    if (BdPtr->CheckBits == CFE_ES_CHECK_PATTERN)
+    {
+        BucketId  = BdPtr->Allocated - CFE_ES_MEMORY_DEALLOCATED;
+        BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+        if (BucketPtr == NULL)
+        {
+            BucketId    = BdPtr->Allocated - CFE_ES_MEMORY_ALLOCATED;
+            BucketPtr   = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+            IsAllocated = true;
+        }
+    }
+
+    if (BucketPtr == NULL || BucketPtr->BlockSize < BdPtr->ActualSize)
+    {
+        /* This does not appear to be a valid block, so the walk cannot continue */
+        return CFE_ES_POOL_BLOCK_INVALID;
+    }
+
+    InfoPtr->BlockOffset  = BlockOffset;
+    InfoPtr->NextPosition = BlockOffset + BucketPtr->BlockSize;
+    InfoPtr->BlockSize    = BucketPtr->BlockSize;
+    InfoPtr->ActualSize   = BdPtr->ActualSize;
+    InfoPtr->BucketId     = BucketId;
+    InfoPtr->IsAllocated  = IsAllocated;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolArenaGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOffsetPtr, size_t ReqSize)
+{
+    size_t BlockOffset;
+
+    BlockOffset = PoolRecPtr->TailPosition + PoolRecPtr->AlignMask;
+    BlockOffset &= ~PoolRecPtr->AlignMask;
+
+    /*
+     * Check if there is enough space remaining in the pool, written
+     * such that a very large request cannot overflow the calculation.
+     */
+    if (BlockOffset > PoolRecPtr->PoolMaxOffset || ReqSize > (PoolRecPtr->PoolMaxOffset - BlockOffset))
+    {
+        /* can't fit in remaining mem */
+        return CFE_ES_ERR_MEM_BLOCK_SIZE;
+    }
+
+    PoolRecPtr->TailPosition = BlockOffset + ReqSize;
+    ++PoolRecPtr->AllocationCount;
+
+    *BlockOffsetPtr = BlockOffset;
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GenPoolArenaReset(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    PoolRecPtr->TailPosition = PoolRecPtr->PoolMaxOffset - PoolRecPtr->PoolTotalSize;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -49,6 +49,12 @@
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
+/*
+ * Number of power-of-two size classes used for bucket lookup.
+ * Class 0 holds sizes of 0 or 1, and class N holds sizes in the range (2^(N-1), 2^N].
+ */
+#define CFE_ES_GENERIC_POOL_SIZE_CLASSES ((sizeof(size_t) * 8) + 1)
+
 /*
 ** Type Definitions
 */
@@ -70,6 +76,19 @@ typedef struct CFE_ES_GenPoolBucket
     uint32 RecycleCount;    /**< Total number of buffers that have been recycled (get after put) */
 } CFE_ES_GenPoolBucket_t;
 
+/**
+ * \brief Information about a single block in the pool, as found by walking the pool
+ */
+typedef struct CFE_ES_GenPoolBlockInfo
+{
+    size_t BlockOffset;  /**< Offset of the data block */
+    size_t NextPosition; /**< Position of the end of the block, where the next descriptor may start */
+    size_t BlockSize;    /**< Block size of the bucket the block belongs to */
+    size_t ActualSize;   /**< Size requested when the block was last allocated */
+    uint16 BucketId;     /**< Bucket the block belongs to */
+    bool   IsAllocated;  /**< Whether the block is currently allocated */
+} CFE_ES_GenPoolBlockInfo_t;
+
 /*
  * Forward struct typedef so it can be used in retrieve/commit prototype
  */
@@ -114,6 +133,13 @@ struct CFE_ES_GenPoolRecord
 
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    /**
+     * First entry in the (sorted) "Buckets" array that could hold a block of each
+     * size class, computed at initialization so bucket lookup does not need to
+     * scan the entire list.
+     */
+    uint16 SizeClassIndex[CFE_ES_GENERIC_POOL_SIZE_CLASSES];
 };
 
 /*****************************************************************************/
@@ -158,6 +184,76 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
  */
 int32 CFE_ES_GenPoolGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOffsetPtr, size_t ReqSize);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets a block from an arena pool
+ *
+ * Blocks are carved sequentially from the end of the last allocation,
+ * without a descriptor or bucket.  They cannot be returned individually,
+ * only all at once via CFE_ES_GenPoolArenaReset().
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[out]   BlockOffsetPtr  Location to output new block offset
+ * \param[in]    ReqSize        Size of block requested
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolArenaGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOffsetPtr, size_t ReqSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Releases all blocks in an arena pool
+ *
+ * Returns the pool to its initial, empty state.  The total allocation
+ * count is retained.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ */
+void CFE_ES_GenPoolArenaReset(CFE_ES_GenPoolRecord_t *PoolRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Compute the power-of-two size class of a block size
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * \param[in] ReqSize        Size of block requested
+ *
+ * \return Size class, the number of bits needed to represent (ReqSize - 1)
+ */
+uint16 CFE_ES_GenPoolSizeClass(size_t ReqSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the bucket that can hold a block of the given size
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * The bucket list does not change after the pool is initialized, so this
+ * does not need to be serialized with get/put operations.  The search starts
+ * at the first bucket of the size class of the request, so it only compares
+ * against block sizes within the same power of two.
+ *
+ * \param[in] PoolRecPtr     Pointer to pool structure
+ * \param[in] ReqSize        Size of block requested
+ *
+ * \return Bucket ID, or 0 if no bucket is large enough
+ */
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Obtain a pointer to the state structure associated with a given bucket ID
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * \param[in] PoolRecPtr     Pointer to pool structure
+ * \param[in] BucketId       Bucket ID
+ *
+ * \return Pointer to bucket state, or NULL if the bucket ID is not valid
+ */
+CFE_ES_GenPoolBucket_t *CFE_ES_GenPoolGetBucketState(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Create a new block of the given size.
@@ -242,6 +338,29 @@ int32 CFE_ES_GenPoolRebuild(CFE_ES_GenPoolRecord_t *PoolRecPtr);
  */
 int32 CFE_ES_GenPoolGetBlockSize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSizePtr, size_t BlockOffset);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get information about the next block in the pool
+ *
+ * Looks up the descriptor of the first block following the given position,
+ * which may be allocated or free.  To walk all blocks in the pool, start
+ * with a position of 0 and pass the NextPosition output of each call
+ * into the next call, until an error is returned.
+ *
+ * Blocks are not locked by this call, so the caller must serialize it with
+ * any get/put operations on the same pool.
+ *
+ * \param[in]  PoolRecPtr     Pointer to pool structure
+ * \param[in]  Position       Position to search from, 0 for the start of the pool
+ * \param[out] InfoPtr        Buffer to store the block information
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ * \retval #CFE_ES_BUFFER_NOT_IN_POOL  No more blocks exist beyond the given position
+ * \retval #CFE_ES_POOL_BLOCK_INVALID  The descriptor at the position is not valid
+ */
+int32 CFE_ES_GenPoolGetBlockInfo(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Position,
+                                 CFE_ES_GenPoolBlockInfo_t *InfoPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Validate a pool structure
@@ -91,6 +91,23 @@ typedef struct
     CFE_ES_ERLog_FileEntry_t   EntryBuffer; /**< Temp holding area for record to write */
 } CFE_ES_BackgroundLogDumpGlobal_t;
 
+/*
+ * Background memory pool block map dump state structure
+ *
+ * The number of blocks in a pool is not known ahead of time, so the
+ * file writer is fed one block per record, and this keeps the position
+ * of the walk through the pool table and the current pool.
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t FileWrite;   /**< FS state data - must be first */
+    CFE_ES_MemPoolMapEntry_t   EntryBuffer; /**< Temp holding area for record to write */
+    uint32                     PoolIndex;   /**< Index of the pool currently being walked */
+    size_t                     Position;    /**< Position of the next block in that pool, 0 for the start */
+    uint32                     NumBlocks;   /**< Number of blocks written so far */
+    size_t                     WastedBytes; /**< Total wasted bytes in the allocated blocks written so far */
+} CFE_ES_BackgroundMemPoolMapState_t;
+
 /*
 ** Type definition (ES task global data)
 */
@@ -142,9 +159,18 @@ typedef struct
 
     /*
     ** Performance Data Mutex
+    **
+    ** Serializes the perf log dump with perf commands.  Writers in
+    ** CFE_ES_PerfLogAdd() do not take it, they reserve entries via PerfDataSeq.
     */
     osal_id_t PerfDataMutex;
 
+    /*
+    ** Number of perf log entries reserved since collection was started,
+    ** folded back periodically so it does not overflow (see CFE_ES_PERF_SEQ_FOLD)
+    */
+    uint32 PerfDataSeq;
+
     /*
     ** Startup Sync
     */
@@ -200,6 +226,11 @@ typedef struct
     */
     CFE_ES_BackgroundLogDumpGlobal_t BackgroundERLogDumpState;
 
+    /*
+     * Persistent state data associated with memory pool block map file writes
+     */
+    CFE_ES_BackgroundMemPoolMapState_t BackgroundMemPoolMapState;
+
     /*
      * Persistent state data associated with performance log data file writes
      */
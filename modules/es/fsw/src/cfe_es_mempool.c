@@ -97,6 +97,238 @@ int32 CFE_ES_MemPoolDirectCommit(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t Offs
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Locate the task cache of the calling task for the given bucket,
+ * claiming a set of caches for the task on its first use of the pool.
+ * Returns NULL if the pool has no task caches or none are left.
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_MemPoolMagazine_t *CFE_ES_MemPoolCacheLocate(CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId)
+{
+    osal_id_t       OsalId;
+    CFE_ES_TaskId_t TaskId;
+    uint32          Slot;
+
+    if (PoolRecPtr->Magazines == NULL || BucketId == 0)
+    {
+        return NULL;
+    }
+
+    OsalId = OS_TaskGetId();
+    if (!OS_ObjectIdDefined(OsalId))
+    {
+        /* not called from a task */
+        return NULL;
+    }
+
+    TaskId = CFE_ES_TaskId_FromOSAL(OsalId);
+
+    /*
+     * Only the task itself stores its own ID, so there is no need
+     * to take the mutex just to find it.
+     */
+    for (Slot = 0; Slot < CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS; ++Slot)
+    {
+        if (CFE_RESOURCEID_TEST_EQUAL(PoolRecPtr->CacheTaskId[Slot], TaskId))
+        {
+            break;
+        }
+    }
+
+    if (Slot == CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS)
+    {
+        OS_MutSemTake(PoolRecPtr->MutexId);
+
+        for (Slot = 0; Slot < CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS; ++Slot)
+        {
+            if (!CFE_RESOURCEID_TEST_DEFINED(PoolRecPtr->CacheTaskId[Slot]))
+            {
+                PoolRecPtr->CacheTaskId[Slot] = TaskId;
+                break;
+            }
+        }
+
+        OS_MutSemGive(PoolRecPtr->MutexId);
+
+        if (Slot == CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS)
+        {
+            return NULL;
+        }
+    }
+
+    return &PoolRecPtr->Magazines[(Slot * PoolRecPtr->Pool.NumBuckets) + BucketId - 1];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Fill an empty task cache with a batch of blocks from the shared pool,
+ * under the pool mutex.
+ *
+ * The blocks stay allocated as far as the shared pool is concerned, so
+ * their descriptors are not touched again while they are in the cache.
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_MemPoolCacheRefill(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_MemPoolMagazine_t *MagazinePtr,
+                                uint16 BucketId)
+{
+    size_t BlockSize;
+    size_t DataOffset;
+    int32  Status;
+
+    BlockSize = CFE_ES_GenPoolGetBucketState(&PoolRecPtr->Pool, BucketId)->BlockSize;
+
+    OS_MutSemTake(PoolRecPtr->MutexId);
+
+    do
+    {
+        Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, BlockSize);
+        if (Status == CFE_SUCCESS)
+        {
+            MagazinePtr->Offsets[MagazinePtr->Count] = DataOffset;
+            ++MagazinePtr->Count;
+        }
+    } while (Status == CFE_SUCCESS && MagazinePtr->Count < (CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH / 2));
+
+    OS_MutSemGive(PoolRecPtr->MutexId);
+
+    /* a partial batch is fine, as long as there is something to hand out */
+    if (MagazinePtr->Count > 0)
+    {
+        Status = CFE_SUCCESS;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Return the given number of blocks from a task cache to the shared pool,
+ * under the pool mutex.
+ *
+ * This takes the least recently released blocks, keeping those that are
+ * most likely to still be in the CPU data cache.
+ *
+ * A block the shared pool does not take back, e.g. one that was released
+ * twice into different task caches, is dropped from the cache all the same.
+ * The shared pool counts it as a validation error, and the first such error
+ * is returned.
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_MemPoolCacheFlush(CFE_ES_MemPoolRecord_t *PoolRecPtr, CFE_ES_MemPoolMagazine_t *MagazinePtr,
+                               uint32 NumBlocks)
+{
+    size_t DataSize;
+    uint32 Idx;
+    int32  Status;
+    int32  PutStatus;
+
+    Status = CFE_SUCCESS;
+
+    OS_MutSemTake(PoolRecPtr->MutexId);
+
+    for (Idx = 0; Idx < NumBlocks; ++Idx)
+    {
+        PutStatus = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, MagazinePtr->Offsets[Idx]);
+        if (PutStatus != CFE_SUCCESS && Status == CFE_SUCCESS)
+        {
+            Status = PutStatus;
+        }
+    }
+
+    OS_MutSemGive(PoolRecPtr->MutexId);
+
+    MagazinePtr->Count -= NumBlocks;
+    memmove(&MagazinePtr->Offsets[0], &MagazinePtr->Offsets[NumBlocks], MagazinePtr->Count * sizeof(size_t));
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Check a block being released to a task cache.  Returns the bucket ID
+ * of the block, or 0 if it is not a valid allocated block, in which
+ * case it is left to the shared pool to report.  The size is that of
+ * the block size class, as the size last requested is not kept.
+ *
+ * This does not need the pool mutex.  Moving a block into or out of a
+ * task cache does not change its descriptor, so the descriptor of a
+ * block held by the caller is only written by the caller releasing it.
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_ES_MemPoolCacheCheckBlock(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataSizePtr, size_t DataOffset)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    uint16              BucketId;
+
+    if (CFE_ES_GenPoolGetBlockSize(&PoolRecPtr->Pool, DataSizePtr, DataOffset) != CFE_SUCCESS ||
+        PoolRecPtr->Pool.Retrieve(&PoolRecPtr->Pool, DataOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr) !=
+            CFE_SUCCESS)
+    {
+        return 0;
+    }
+
+    BucketId     = BdPtr->Allocated - CFE_ES_MEMORY_ALLOCATED;
+    *DataSizePtr = CFE_ES_GenPoolGetBucketState(&PoolRecPtr->Pool, BucketId)->BlockSize;
+
+    return BucketId;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Check whether a task cache holds the block at the given offset
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_MemPoolCacheHolds(const CFE_ES_MemPoolMagazine_t *MagazinePtr, size_t DataOffset)
+{
+    uint32 Idx;
+
+    for (Idx = 0; Idx < MagazinePtr->Count; ++Idx)
+    {
+        if (MagazinePtr->Offsets[Idx] == DataOffset)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Get the number of free blocks of the given bucket held in task caches
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_MemPoolCacheCount(const CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId)
+{
+    uint32 Slot;
+    uint32 Count;
+
+    Count = 0;
+
+    if (PoolRecPtr->Magazines != NULL && BucketId != 0 && BucketId <= PoolRecPtr->Pool.NumBuckets)
+    {
+        for (Slot = 0; Slot < CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS; ++Slot)
+        {
+            Count += PoolRecPtr->Magazines[(Slot * PoolRecPtr->Pool.NumBuckets) + BucketId - 1].Count;
+        }
+    }
+
+    return Count;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -182,6 +414,19 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
                                  const size_t *BlockSizes, bool UseMutex)
+{
+    return CFE_ES_PoolCreateWithOpts(PoolID, MemPtr, Size, NumBlockSizes, BlockSizes,
+                                     UseMutex ? CFE_ES_POOLOPTS_MUTEX : 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_PoolCreateWithOpts(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                       const size_t *BlockSizes, uint32 PoolOpts)
 {
     int32                   OsStatus;
     int32                   Status;
@@ -189,6 +434,7 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
     CFE_ES_MemPoolRecord_t *PoolRecPtr;
     size_t                  Alignment;
     size_t                  MinimumSize;
+    size_t                  CacheSize;
     char                    MutexName[OS_MAX_API_NAME];
 
     /* Sanity Check inputs */
@@ -197,6 +443,13 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
         return CFE_ES_BAD_ARGUMENT;
     }
 
+    /* Arena blocks have no descriptor, so they cannot be held in task caches */
+    if ((PoolOpts & CFE_ES_POOLOPTS_ARENA) != 0 && (PoolOpts & CFE_ES_POOLOPTS_TASK_CACHE) != 0)
+    {
+        CFE_ES_WriteToSysLog("%s: Arena pool cannot use task caches\n", __func__);
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
     /* If too many sizes are specified, return an error */
     if (NumBlockSizes > CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
     {
@@ -217,10 +470,46 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
         }
     }
 
+    Alignment = ALIGN_OF(CFE_ES_PoolAlign_t); /* memory mapped pools should be aligned */
+    if (Alignment < CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN)
+    {
+        /*
+         * Note about path coverage testing - depending on the
+         * system architecture and configuration this line may be
+         * unreachable.  This is OK.
+         */
+        Alignment = CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN;
+    }
+
+    /*
+     * Task caches, if enabled, are placed at the start of the pool memory
+     */
+    CacheSize = 0;
+    if ((PoolOpts & CFE_ES_POOLOPTS_TASK_CACHE) != 0)
+    {
+        CacheSize = NumBlockSizes * CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS * sizeof(CFE_ES_MemPoolMagazine_t);
+        CacheSize = (CacheSize + Alignment - 1) & ~(Alignment - 1);
+    }
+
+    if ((PoolOpts & CFE_ES_POOLOPTS_ARENA) != 0)
+    {
+        /*
+         * Arena blocks are carved directly from the pool, so the block size list
+         * is not used.  A single bucket spanning the whole pool satisfies the
+         * generic pool and reports the largest possible request in the stats.
+         */
+        NumBlockSizes = 1;
+        BlockSizes    = &Size;
+        MinimumSize   = Alignment;
+    }
+    else
+    {
+        MinimumSize = CacheSize + CFE_ES_GenPoolCalcMinSize(NumBlockSizes, BlockSizes, 1);
+    }
+
     /*
      * Sanity check the pool size
      */
-    MinimumSize = CFE_ES_GenPoolCalcMinSize(NumBlockSizes, BlockSizes, 1);
     if (Size < MinimumSize)
     {
         CFE_ES_WriteToSysLog("%s: Pool size(%lu) too small, need >=%lu bytes\n", __func__, (unsigned long)Size,
@@ -263,28 +552,18 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
         return Status;
     }
 
-    Alignment = ALIGN_OF(CFE_ES_PoolAlign_t); /* memory mapped pools should be aligned */
-    if (Alignment < CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN)
-    {
-        /*
-         * Note about path coverage testing - depending on the
-         * system architecture and configuration this line may be
-         * unreachable.  This is OK.
-         */
-        Alignment = CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN;
-    }
-
     /*
      * Most of the work is done by the generic pool implementation.
      * This subsystem works in offsets, not pointers.
      */
-    Status = CFE_ES_GenPoolInitialize(&PoolRecPtr->Pool, 0, Size, Alignment, NumBlockSizes, BlockSizes,
-                                      CFE_ES_MemPoolDirectRetrieve, CFE_ES_MemPoolDirectCommit);
+    Status = CFE_ES_GenPoolInitialize(&PoolRecPtr->Pool, CacheSize, Size - CacheSize, Alignment, NumBlockSizes,
+                                      BlockSizes, CFE_ES_MemPoolDirectRetrieve, CFE_ES_MemPoolDirectCommit);
 
     /*
      * If successful, complete the process.
+     * Task caches are refilled and flushed under the mutex, so they need one too.
      */
-    if (Status == CFE_SUCCESS && UseMutex == CFE_ES_USE_MUTEX)
+    if (Status == CFE_SUCCESS && (PoolOpts & (CFE_ES_POOLOPTS_MUTEX | CFE_ES_POOLOPTS_TASK_CACHE)) != 0)
     {
         /*
         ** Construct a name for the Mutex from the address
@@ -311,6 +590,13 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
          * This is only relevant for memory-mapped pools which is why it is done here.
          */
         PoolRecPtr->BaseAddr = (cpuaddr)MemPtr;
+        PoolRecPtr->PoolOpts = PoolOpts;
+
+        if (CacheSize > 0)
+        {
+            memset(MemPtr, 0, CacheSize);
+            PoolRecPtr->Magazines = MemPtr;
+        }
 
         /*
          * Get the calling context.
@@ -403,10 +689,12 @@ int32 CFE_ES_PoolDelete(CFE_ES_MemHandle_t PoolID)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle, size_t Size)
 {
-    int32                   Status;
-    CFE_ES_AppId_t          AppId;
-    CFE_ES_MemPoolRecord_t *PoolRecPtr;
-    size_t                  DataOffset;
+    int32                     Status;
+    CFE_ES_AppId_t            AppId;
+    CFE_ES_MemPoolRecord_t *  PoolRecPtr;
+    CFE_ES_MemPoolMagazine_t *MagazinePtr;
+    size_t                    DataOffset;
+    uint16                    BucketId;
 
     if (BufPtr == NULL)
     {
@@ -425,29 +713,67 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
     }
 
     /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
+     * If the pool has task caches, serve the request from
+     * the cache of the calling task when possible.
      */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    MagazinePtr = NULL;
+    BucketId    = 0;
+    if (PoolRecPtr->Magazines != NULL)
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        BucketId    = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, Size);
+        MagazinePtr = CFE_ES_MemPoolCacheLocate(PoolRecPtr, BucketId);
     }
 
-    /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
-     */
-    Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+    if (MagazinePtr != NULL)
+    {
+        Status = CFE_SUCCESS;
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        /* Only an empty cache needs the shared pool, and the mutex */
+        if (MagazinePtr->Count == 0)
+        {
+            Status = CFE_ES_MemPoolCacheRefill(PoolRecPtr, MagazinePtr, BucketId);
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            --MagazinePtr->Count;
+            DataOffset = MagazinePtr->Offsets[MagazinePtr->Count];
+        }
+    }
+    else
     {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemTake(PoolRecPtr->MutexId);
+        }
+
+        /*
+         * Fundamental work is done as a generic routine.
+         *
+         * If successful, this gets an offset, which can then
+         * be translated into a pointer to return to the caller.
+         */
+        if ((PoolRecPtr->PoolOpts & CFE_ES_POOLOPTS_ARENA) != 0)
+        {
+            Status = CFE_ES_GenPoolArenaGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+        }
+        else
+        {
+            Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+        }
+
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
     }
 
     /* If not successful, return error now */
@@ -488,6 +814,12 @@ CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_
         return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
+    /* Arena blocks do not have a descriptor to get the size from */
+    if ((PoolRecPtr->PoolOpts & CFE_ES_POOLOPTS_ARENA) != 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
     /*
      * Real work begins here.
      * If pool is mutex-protected, take the mutex now.
@@ -501,6 +833,12 @@ CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_
 
     Status = CFE_ES_GenPoolGetBlockSize(&PoolRecPtr->Pool, &DataSize, DataOffset);
 
+    /* Blocks pass through the task caches without recording the size requested, so give the block size */
+    if (Status == CFE_SUCCESS && PoolRecPtr->Magazines != NULL)
+    {
+        CFE_ES_MemPoolCacheCheckBlock(PoolRecPtr, &DataSize, DataOffset);
+    }
+
     /*
      * Real work ends here.
      * If pool is mutex-protected, release the mutex now.
@@ -530,10 +868,12 @@ CFE_Status_t CFE_ES_GetPoolBufInfo(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_
  *-----------------------------------------------------------------*/
 int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
 {
-    CFE_ES_MemPoolRecord_t *PoolRecPtr;
-    size_t                  DataSize;
-    size_t                  DataOffset;
-    int32                   Status;
+    CFE_ES_MemPoolRecord_t *  PoolRecPtr;
+    CFE_ES_MemPoolMagazine_t *MagazinePtr;
+    size_t                    DataSize;
+    size_t                    DataOffset;
+    int32                     Status;
+    uint16                    BucketId;
 
     if (BufPtr == NULL)
     {
@@ -550,32 +890,82 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
         return CFE_ES_ERR_RESOURCEID_NOT_VALID;
     }
 
-    /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    /* Arena blocks are only released all at once, by resetting the pool */
+    if ((PoolRecPtr->PoolOpts & CFE_ES_POOLOPTS_ARENA) != 0)
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        CFE_ES_WriteToSysLog("%s: Err:Cannot put block to arena pool (0x%08lX)\n", __func__,
+                             CFE_RESOURCEID_TO_ULONG(Handle));
+
+        return CFE_ES_BAD_ARGUMENT;
     }
 
     DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
 
     /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
+     * If the pool has task caches, a valid block is kept in the
+     * cache of the calling task.  Anything else goes to the shared
+     * pool, which also takes care of reporting invalid blocks.
      */
-    Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
+    MagazinePtr = NULL;
+    BucketId    = 0;
+    if (PoolRecPtr->Magazines != NULL)
+    {
+        BucketId    = CFE_ES_MemPoolCacheCheckBlock(PoolRecPtr, &DataSize, DataOffset);
+        MagazinePtr = CFE_ES_MemPoolCacheLocate(PoolRecPtr, BucketId);
+    }
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    if (MagazinePtr != NULL)
     {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        Status = CFE_SUCCESS;
+
+        /* A block already in the cache is being released twice */
+        if (CFE_ES_MemPoolCacheHolds(MagazinePtr, DataOffset))
+        {
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+
+        /* Only a full cache needs the shared pool, and the mutex */
+        if (Status == CFE_SUCCESS && MagazinePtr->Count == CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH &&
+            CFE_ES_MemPoolCacheFlush(PoolRecPtr, MagazinePtr, CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH / 2) != CFE_SUCCESS)
+        {
+            /* the block being released is fine, only some of those flushed were not */
+            CFE_ES_WriteToSysLog("%s: Err:Flushing task cache of pool 0x%08lX\n", __func__,
+                                 CFE_RESOURCEID_TO_ULONG(Handle));
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            MagazinePtr->Offsets[MagazinePtr->Count] = DataOffset;
+            ++MagazinePtr->Count;
+        }
+    }
+    else
+    {
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemTake(PoolRecPtr->MutexId);
+        }
+
+        /*
+         * Fundamental work is done as a generic routine.
+         *
+         * If successful, this gets an offset, which can then
+         * be translated into a pointer to return to the caller.
+         */
+        Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
+
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
     }
 
     /*
@@ -601,6 +991,53 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_PoolReset(CFE_ES_MemHandle_t Handle)
+{
+    CFE_ES_MemPoolRecord_t *PoolRecPtr;
+
+    PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(Handle);
+
+    /* basic sanity check */
+    if (!CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, Handle))
+    {
+        return CFE_ES_ERR_RESOURCEID_NOT_VALID;
+    }
+
+    /* Other pools may have blocks in use, which cannot be released in bulk */
+    if ((PoolRecPtr->PoolOpts & CFE_ES_POOLOPTS_ARENA) == 0)
+    {
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    /*
+     * Real work begins here.
+     * If pool is mutex-protected, take the mutex now.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        OS_MutSemTake(PoolRecPtr->MutexId);
+    }
+
+    CFE_ES_GenPoolArenaReset(&PoolRecPtr->Pool);
+
+    /*
+     * Real work ends here.
+     * If pool is mutex-protected, release the mutex now.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        OS_MutSemGive(PoolRecPtr->MutexId);
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -653,6 +1090,9 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
     {
         CFE_ES_GenPoolGetBucketUsage(&PoolRecPtr->Pool, NumBuckets, &BufPtr->BlockStats[Idx]);
 
+        /* blocks held in task caches are free as well */
+        BufPtr->BlockStats[Idx].NumFree += CFE_ES_MemPoolCacheCount(PoolRecPtr, NumBuckets);
+
         if (NumBuckets > 0)
         {
             --NumBuckets;
@@ -705,3 +1145,223 @@ bool CFE_ES_ValidateHandle(CFE_ES_MemHandle_t Handle)
 
     return true;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_MemPoolFlushTaskCache(CFE_ES_TaskId_t TaskId)
+{
+    CFE_ES_MemPoolRecord_t *  PoolRecPtr;
+    CFE_ES_MemPoolMagazine_t *MagazinePtr;
+    CFE_ES_MemHandle_t        PoolList[CFE_PLATFORM_ES_MAX_MEMORY_POOLS];
+    uint32                    NumPools;
+    uint32                    i;
+    uint32                    Slot;
+    uint16                    BucketId;
+
+    /*
+     * Collect the pools that have task caches.
+     *
+     * The caches are flushed with only the pool mutex held, since
+     * the pool may write to the system log which takes the ES lock.
+     */
+    NumPools = 0;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    PoolRecPtr = CFE_ES_Global.MemPoolTable;
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_MEMORY_POOLS; ++i)
+    {
+        if (CFE_ES_MemPoolRecordIsUsed(PoolRecPtr) && PoolRecPtr->Magazines != NULL)
+        {
+            PoolList[NumPools] = CFE_ES_MemPoolRecordGetID(PoolRecPtr);
+            ++NumPools;
+        }
+
+        ++PoolRecPtr;
+    }
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    for (i = 0; i < NumPools; ++i)
+    {
+        PoolRecPtr = CFE_ES_LocateMemPoolRecordByID(PoolList[i]);
+        Slot       = CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS;
+
+        /* skip the pool if it was deleted in the meantime */
+        if (CFE_ES_MemPoolRecordIsMatch(PoolRecPtr, PoolList[i]))
+        {
+            for (Slot = 0; Slot < CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS; ++Slot)
+            {
+                if (CFE_RESOURCEID_TEST_EQUAL(PoolRecPtr->CacheTaskId[Slot], TaskId))
+                {
+                    break;
+                }
+            }
+        }
+
+        if (Slot < CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS)
+        {
+            MagazinePtr = &PoolRecPtr->Magazines[Slot * PoolRecPtr->Pool.NumBuckets];
+            for (BucketId = 1; BucketId <= PoolRecPtr->Pool.NumBuckets; ++BucketId)
+            {
+                if (CFE_ES_MemPoolCacheFlush(PoolRecPtr, MagazinePtr, MagazinePtr->Count) != CFE_SUCCESS)
+                {
+                    CFE_ES_WriteToSysLog("%s: Err:Flushing task cache of pool 0x%08lX\n", __func__,
+                                         CFE_RESOURCEID_TO_ULONG(PoolList[i]));
+                }
+
+                ++MagazinePtr;
+            }
+
+            OS_MutSemTake(PoolRecPtr->MutexId);
+            PoolRecPtr->CacheTaskId[Slot] = CFE_ES_TASKID_UNDEFINED;
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_BackgroundMemPoolMapDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_BackgroundMemPoolMapState_t *StatePtr;
+    CFE_ES_MemPoolMapEntry_t *          EntryPtr;
+    CFE_ES_MemPoolRecord_t *            PoolRecPtr;
+    CFE_ES_GenPoolBlockInfo_t           BlockInfo;
+    int32                               Status;
+    uint32                              Slot;
+
+    StatePtr   = (CFE_ES_BackgroundMemPoolMapState_t *)Meta;
+    EntryPtr   = &StatePtr->EntryBuffer;
+    PoolRecPtr = NULL;
+    Status     = CFE_ES_BUFFER_NOT_IN_POOL;
+
+    /*
+     * Find the next block, moving on to the next pool whenever the
+     * end of the current one is reached (or its blocks cannot be walked)
+     */
+    while (StatePtr->PoolIndex < CFE_PLATFORM_ES_MAX_MEMORY_POOLS)
+    {
+        PoolRecPtr = &CFE_ES_Global.MemPoolTable[StatePtr->PoolIndex];
+
+        if (CFE_ES_MemPoolRecordIsUsed(PoolRecPtr) && (PoolRecPtr->PoolOpts & CFE_ES_POOLOPTS_ARENA) == 0)
+        {
+            if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+            {
+                OS_MutSemTake(PoolRecPtr->MutexId);
+            }
+
+            Status = CFE_ES_GenPoolGetBlockInfo(&PoolRecPtr->Pool, StatePtr->Position, &BlockInfo);
+
+            /* Blocks held in task caches are allocated as far as the shared pool is concerned */
+            if (Status == CFE_SUCCESS && BlockInfo.IsAllocated && PoolRecPtr->Magazines != NULL)
+            {
+                for (Slot = 0; Slot < CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS; ++Slot)
+                {
+                    if (CFE_ES_MemPoolCacheHolds(
+                            &PoolRecPtr->Magazines[(Slot * PoolRecPtr->Pool.NumBuckets) + BlockInfo.BucketId - 1],
+                            BlockInfo.BlockOffset))
+                    {
+                        BlockInfo.IsAllocated = false;
+                        break;
+                    }
+                }
+            }
+
+            if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+            {
+                OS_MutSemGive(PoolRecPtr->MutexId);
+            }
+
+            if (Status == CFE_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        ++StatePtr->PoolIndex;
+        StatePtr->Position = 0;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        memset(EntryPtr, 0, sizeof(*EntryPtr));
+
+        EntryPtr->PoolHandle = CFE_ES_MemPoolRecordGetID(PoolRecPtr);
+        EntryPtr->Offset     = CFE_ES_MEMOFFSET_C(BlockInfo.BlockOffset);
+        EntryPtr->BlockSize  = CFE_ES_MEMOFFSET_C(BlockInfo.BlockSize);
+        EntryPtr->ActualSize = CFE_ES_MEMOFFSET_C(BlockInfo.ActualSize);
+        EntryPtr->BucketId   = BlockInfo.BucketId;
+        EntryPtr->Allocated  = BlockInfo.IsAllocated;
+
+        /* The remainder of an allocated block cannot be used by anyone else */
+        if (BlockInfo.IsAllocated)
+        {
+            EntryPtr->WastedBytes = CFE_ES_MEMOFFSET_C(BlockInfo.BlockSize - BlockInfo.ActualSize);
+            StatePtr->WastedBytes += BlockInfo.BlockSize - BlockInfo.ActualSize;
+        }
+
+        ++StatePtr->NumBlocks;
+        StatePtr->Position = BlockInfo.NextPosition;
+
+        *Buffer  = EntryPtr;
+        *BufSize = sizeof(*EntryPtr);
+    }
+    else
+    {
+        *Buffer  = NULL;
+        *BufSize = 0;
+    }
+
+    /* Check for EOF (all pools walked) */
+    return (StatePtr->PoolIndex >= CFE_PLATFORM_ES_MAX_MEMORY_POOLS);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundMemPoolMapEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                             size_t BlockSize, size_t Position)
+{
+    CFE_ES_BackgroundMemPoolMapState_t *StatePtr;
+
+    StatePtr = (CFE_ES_BackgroundMemPoolMapState_t *)Meta;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_MEMPOOL_MAP_EID, CFE_EVS_EventType_DEBUG,
+                              "%s written:Size=%lu,Blocks=%lu,Wasted=%lu", StatePtr->FileWrite.FileName,
+                              (unsigned long)Position, (unsigned long)StatePtr->NumBlocks,
+                              (unsigned long)StatePtr->WastedBytes);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u", StatePtr->FileWrite.FileName,
+                              (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_MEMPOOL_MAP_ERR_EID, CFE_EVS_EventType_ERROR, "Error creating file %s, RC = %d",
+                              StatePtr->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
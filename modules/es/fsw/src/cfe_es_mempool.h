@@ -33,8 +33,25 @@
 */
 #include "common_types.h"
 #include "cfe_resourceid.h"
+#include "cfe_fs_api_typedefs.h"
 #include "cfe_es_generic_pool.h"
 
+/**
+ * A task cache of free blocks of one block size
+ *
+ * Blocks in the cache are allocated as far as the shared pool is concerned,
+ * and their descriptors are left as they are.  Only the owning task pushes
+ * and pops entries, without the pool mutex.  The mutex is only taken to move
+ * a batch of blocks between the cache and the shared pool.  Others only read
+ * the cache for the statistics and the block map, which may then be slightly
+ * out of date.
+ */
+typedef struct
+{
+    uint32 Count;                                        /**< Number of blocks in the cache */
+    size_t Offsets[CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH]; /**< Block offsets, most recently released last */
+} CFE_ES_MemPoolMagazine_t;
+
 typedef struct
 {
     /*
@@ -69,6 +86,24 @@ typedef struct
      * Optional Mutex for serializing get/put operations
      */
     osal_id_t MutexId;
+
+    /**
+     * The options the pool was created with (CFE_ES_POOLOPTS_xxx)
+     */
+    uint32 PoolOpts;
+
+    /**
+     * The task holding each set of task caches, if the pool
+     * was created with #CFE_ES_POOLOPTS_TASK_CACHE
+     */
+    CFE_ES_TaskId_t CacheTaskId[CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS];
+
+    /**
+     * Task caches, one per bucket for each entry in CacheTaskId.
+     * These reside at the start of the pool memory, or this
+     * is NULL if the pool does not use task caches.
+     */
+    CFE_ES_MemPoolMagazine_t *Magazines;
 } CFE_ES_MemPoolRecord_t;
 
 /*---------------------------------------------------------------------------------------*/
@@ -241,4 +276,38 @@ static inline bool CFE_ES_MemPoolRecordIsMatch(const CFE_ES_MemPoolRecord_t *Poo
  */
 bool CFE_ES_CheckMemPoolSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Return the blocks held in the task caches of a task
+ *
+ * Flushes the caches of the given task in every memory pool that was created
+ * with #CFE_ES_POOLOPTS_TASK_CACHE back to the shared pool, and releases the
+ * cache slots for use by other tasks.
+ *
+ * This must only be called once the task has stopped using the pools, i.e.
+ * when it is being deleted or is about to exit.  Global data must NOT be
+ * locked when invoking this function.
+ *
+ * @param[in]   TaskId   the task that is going away
+ */
+void CFE_ES_MemPoolFlushTaskCache(CFE_ES_TaskId_t TaskId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write data getter for the memory pool block map
+ *
+ * Gets the record for the next block, walking each pool in the table in turn.
+ * Arena pools have no block descriptors, so they are skipped.
+ */
+bool CFE_ES_BackgroundMemPoolMapDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Background file write event handler for the memory pool block map
+ *
+ * Report events during writing the memory pool block map to a file
+ */
+void CFE_ES_BackgroundMemPoolMapEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
+                                             size_t BlockSize, size_t Position);
+
 #endif /* CFE_ES_MEMPOOL_H */
@@ -28,6 +28,7 @@
 ** Include Section
 */
 #include "cfe_es_module_all.h"
+#include "cfe_core_atomic.h"
 
 #include <string.h>
 
@@ -64,6 +65,19 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
         ** collection so the ground can dump the data
         */
         Perf->MetaData.State = CFE_ES_PERF_IDLE;
+
+        /*
+        ** Recover the reservation count from the preserved log, so the
+        ** log positions are unchanged when next set from it
+        */
+        if (Perf->MetaData.DataCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+        {
+            CFE_ES_Global.PerfDataSeq = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + Perf->MetaData.DataEnd;
+        }
+        else
+        {
+            CFE_ES_Global.PerfDataSeq = Perf->MetaData.DataCount;
+        }
     }
     else
     {
@@ -81,6 +95,7 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
         Perf->MetaData.DataCount             = 0;
         Perf->MetaData.InvalidMarkerReported = false;
         Perf->MetaData.FilterTriggerMaskSize = CFE_ES_PERF_32BIT_WORDS_IN_MASK;
+        CFE_ES_Global.PerfDataSeq            = 0;
 
         for (i = 0; i < CFE_ES_PERF_32BIT_WORDS_IN_MASK; i++)
         {
@@ -133,6 +148,39 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
     return Result;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogSetDataPosition(uint32 EntryCount)
+{
+    CFE_ES_PerfData_t *Perf;
+    uint32             DataEnd;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    DataEnd = EntryCount % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    CFE_ATOMIC_STORE(&Perf->MetaData.DataEnd, DataEnd);
+
+    if (EntryCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    {
+        CFE_ATOMIC_STORE(&Perf->MetaData.DataCount, EntryCount);
+        CFE_ATOMIC_STORE(&Perf->MetaData.DataStart, 0);
+    }
+    else
+    {
+        /* after the buffer fills up start and end point to the same entry since we
+           are now overwriting old data */
+        CFE_ATOMIC_STORE(&Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+        CFE_ATOMIC_STORE(&Perf->MetaData.DataStart, DataEnd);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -159,16 +207,17 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
         {
             CFE_ES_Global.TaskData.CommandCounter++;
 
-            /* Taking lock here as this might be changing states from one active mode to another.
-             * In that case, need to make sure that the log is not written to while resetting the counters. */
+            /* This might be changing states from one active mode to another.
+             * Writers do not lock, so idle the log first to stop new entries while resetting
+             * the counters (an entry already in progress may still land in the new log). */
             OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
-            Perf->MetaData.Mode                  = CmdPtr->TriggerMode;
-            Perf->MetaData.TriggerCount          = 0;
-            Perf->MetaData.DataStart             = 0;
-            Perf->MetaData.DataEnd               = 0;
-            Perf->MetaData.DataCount             = 0;
-            Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+            CFE_ATOMIC_STORE(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+            Perf->MetaData.Mode = CmdPtr->TriggerMode;
+            CFE_ATOMIC_STORE(&Perf->MetaData.TriggerCount, 0);
+            CFE_ATOMIC_STORE(&Perf->MetaData.InvalidMarkerReported, false);
+            CFE_ATOMIC_STORE(&CFE_ES_Global.PerfDataSeq, 0);
+            CFE_ES_PerfLogSetDataPosition(0);
+            CFE_ATOMIC_STORE(&Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER); /* this must be done last */
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
@@ -217,7 +266,8 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
     if (PerfDumpState->CurrentState == CFE_ES_PerfDumpState_IDLE &&
         PerfDumpState->PendingState == CFE_ES_PerfDumpState_IDLE)
     {
-        Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        CFE_ATOMIC_STORE(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+        CFE_ES_PerfLogSetDataPosition(CFE_ATOMIC_LOAD(&CFE_ES_Global.PerfDataSeq));
 
         /* Copy out the string, using default if unspecified */
         Status = CFE_FS_ParseInputFileNameEx(PerfDumpState->DataFileName, CmdPtr->DataFileName,
@@ -340,6 +390,9 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
 
                 case CFE_ES_PerfDumpState_LOCK_DATA:
                     OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+
+                    /* Any writes that were in progress at stop time are now finished */
+                    CFE_ES_PerfLogSetDataPosition(CFE_ATOMIC_LOAD(&CFE_ES_Global.PerfDataSeq));
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
@@ -564,7 +617,10 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
 void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 {
     CFE_ES_PerfDataEntry_t EntryData;
-    uint32                 DataEnd;
+    uint32                 EntryCount;
+    uint32                 TriggerCount;
+    uint32                 State;
+    bool                   IsComplete;
     CFE_ES_PerfData_t *    Perf;
 
     /*
@@ -573,9 +629,9 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     Perf = &CFE_ES_Global.ResetDataPtr->Perf;
 
     /*
-     * If the global state is idle, exit immediately without locking or doing anything
+     * If the global state is idle, exit immediately without doing anything
      */
-    if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
+    if (CFE_ATOMIC_LOAD(&Perf->MetaData.State) == CFE_ES_PERF_IDLE)
     {
         return;
     }
@@ -584,11 +640,11 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     if (Marker >= CFE_MISSION_ES_PERF_MAX_IDS)
     {
         /* if marker has not been reported previously ... */
-        if (Perf->MetaData.InvalidMarkerReported == false)
+        if (CFE_ATOMIC_LOAD(&Perf->MetaData.InvalidMarkerReported) == false &&
+            CFE_ATOMIC_EXCHANGE(&Perf->MetaData.InvalidMarkerReported, true) == false)
         {
             CFE_ES_WriteToSysLog("%s: Invalid performance marker %d,max is %d\n", __func__, (unsigned int)Marker,
                                  (CFE_MISSION_ES_PERF_MAX_IDS - 1));
-            Perf->MetaData.InvalidMarkerReported = true;
         }
 
         return;
@@ -596,94 +652,79 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 
     /*
      * check if this ID is filtered.
-     * This is also done outside the lock -
-     * normally masks should NOT be changed while perf log is active / non-idle,
-     * so although this is reading a global it should be constant, and this avoids
-     * locking (and potential task switch) if the data is ultimately not going to
-     * be written to the log.
+     * Normally masks should NOT be changed while perf log is active / non-idle,
+     * so although this is reading a global it should be constant.
      */
     if (!CFE_ES_TEST_LONG_MASK(Perf->MetaData.FilterMask, Marker))
     {
         return;
     }
 
-    /*
-     * prepare the entry data (timestamp) before locking,
-     * just in case the locking operation incurs a delay
-     */
     EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
     CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
 
     /*
-     * Acquire the perflog mutex before writing into the shared area.
-     * Note this lock is held for long periods while a background dump
-     * is taking place, but the dump should never be active at the
-     * same time that a capture/record is taking place.
+     * Confirm that the global is still non-idle before taking a slot
+     * (state could become idle while getting the timestamp)
      */
-    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    if (CFE_ATOMIC_LOAD(&Perf->MetaData.State) == CFE_ES_PERF_IDLE)
+    {
+        return;
+    }
 
     /*
-     * Confirm that the global is still non-idle after lock
-     * (state could become idle while getting lock)
+     * Reserve the next perflog slot.  No lock is taken here, so that recording
+     * a marker cannot block or be blocked by another task.  Concurrent writers
+     * each get a different slot, so entries are ordered by reservation and may
+     * be slightly out of timestamp order if a writer is preempted in between.
      */
-    if (Perf->MetaData.State != CFE_ES_PERF_IDLE)
+    EntryCount = CFE_ATOMIC_ADD_FETCH(&CFE_ES_Global.PerfDataSeq, 1);
+    if (EntryCount == CFE_ES_PERF_SEQ_FOLD)
     {
-        /* copy data to next perflog slot */
-        DataEnd                   = Perf->MetaData.DataEnd;
-        Perf->DataBuffer[DataEnd] = EntryData;
+        CFE_ATOMIC_SUB_FETCH(&CFE_ES_Global.PerfDataSeq,
+                             CFE_ES_PERF_SEQ_FOLD - CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    }
+
+    Perf->DataBuffer[(EntryCount - 1) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE] = EntryData;
 
-        ++DataEnd;
-        if (DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    /* The positions are reset from the final count when the log is dumped */
+    CFE_ES_PerfLogSetDataPosition(EntryCount);
+
+    /*
+     * Trigger state machine.  Each transition is made with a compare-exchange,
+     * so that exactly one writer triggers and exactly one completes the log.
+     */
+    State = CFE_ATOMIC_LOAD(&Perf->MetaData.State);
+
+    /* waiting for trigger */
+    if (State == CFE_ES_PERF_WAITING_FOR_TRIGGER && CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
+    {
+        if (CFE_ATOMIC_COMPARE_EXCHANGE(&Perf->MetaData.State, &State, CFE_ES_PERF_TRIGGERED))
         {
-            DataEnd = 0;
+            State = CFE_ES_PERF_TRIGGERED;
         }
-        Perf->MetaData.DataEnd = DataEnd;
+    }
 
-        /* we have filled up the buffer */
-        if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    /* triggered */
+    if (State == CFE_ES_PERF_TRIGGERED)
+    {
+        TriggerCount = CFE_ATOMIC_ADD_FETCH(&Perf->MetaData.TriggerCount, 1);
+        if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_START)
         {
-            Perf->MetaData.DataCount++;
+            IsComplete = (TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
         }
-        else
+        else if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_CENTER)
         {
-            /* after the buffer fills up start and end point to the same entry since we
-               are now overwriting old data */
-            Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
+            IsComplete = (TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2);
         }
-
-        /* waiting for trigger */
-        if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
+        else
         {
-            if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
-            {
-                Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
-            }
+            IsComplete = (Perf->MetaData.Mode == CFE_ES_PerfTrigger_END);
         }
 
-        /* triggered */
-        if (Perf->MetaData.State == CFE_ES_PERF_TRIGGERED)
+        if (IsComplete)
         {
-            Perf->MetaData.TriggerCount++;
-            if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_START)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_CENTER)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PerfTrigger_END)
-            {
-                Perf->MetaData.State = CFE_ES_PERF_IDLE;
-            }
+            CFE_ATOMIC_COMPARE_EXCHANGE(&Perf->MetaData.State, &State, CFE_ES_PERF_IDLE);
         }
     }
-
-    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 }
@@ -81,6 +81,17 @@ typedef enum
     CFE_ES_PerfDumpState_MAX                  /* Placeholder for last state, no action, always last */
 } CFE_ES_PerfDumpState_t;
 
+/**
+ * @brief Point at which the perf log reservation counter is folded back
+ *
+ * The counter is reduced by (CFE_ES_PERF_SEQ_FOLD - CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+ * when it reaches this value.  Being a multiple of the buffer size, this keeps
+ * the buffer index of every reservation the same, and the counter never drops
+ * below the buffer size, so the log is still seen as full.
+ */
+#define CFE_ES_PERF_SEQ_FOLD \
+    (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE * (0x40000000 / CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE))
+
 /**
  * @brief Performance log dump state structure
  *
@@ -124,6 +135,18 @@ typedef struct
  */
 uint32 CFE_ES_GetPerfLogDumpRemaining(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Update the perf log start/end/count from a number of reserved entries
+ *
+ * Entries are added without a lock, so the positions stored in the perf
+ * log metadata by each writer may be momentarily stale.  This sets them
+ * from the reservation count, so they are exact once writers have stopped.
+ *
+ * @param[in] EntryCount Number of entries reserved since collection was started
+ */
+void CFE_ES_PerfLogSetDataPosition(uint32 EntryCount);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Write performance data to a file
@@ -59,6 +59,7 @@
 #define CFE_ES_APP_LOG_DESC  "ES Application Info file"
 #define CFE_ES_ER_LOG_DESC   "ES ERlog data file"
 #define CFE_ES_PERF_LOG_DESC "ES Performance data file"
+#define CFE_ES_POOL_MAP_DESC "ES Memory pool block map"
 
 /*
  * Limit for the total number of entries that may be
@@ -267,6 +268,12 @@ int32 CFE_ES_SendMemPoolStatsCmd(const CFE_ES_SendMemPoolStatsCmd_t *data);
  */
 int32 CFE_ES_DumpCDSRegistryCmd(const CFE_ES_DumpCDSRegistryCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Process Cmd to write the block map of all memory pools to a file.
+ */
+int32 CFE_ES_WriteMemPoolMapCmd(const CFE_ES_WriteMemPoolMapCmd_t *data);
+
 /*
 ** Message Handler Helper Functions
 */
@@ -172,6 +172,17 @@
 #error CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN must be a power of 2!
 #endif
 
+/*
+**  Memory pool task caches
+*/
+#if CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS < 1
+#error CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH < 2
+#error CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH cannot be less than 2!
+#endif
+
 /*
 **  Intermediate ES Memory Pool Block Sizes
 */
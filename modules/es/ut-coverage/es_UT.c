@@ -147,6 +147,8 @@ static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_SEND_MEM_POOL_STATS_CC, SendMemPoolStatsCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_DUMP_CDS_REGISTRY_CC, DumpCDSRegistryCmd) };
+static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_MAP_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_MEM_POOL_MAP_CC, WriteMemPoolMapCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_SEND_HK =
     { ES_UT_MSG_DISPATCH(SEND_HK, SendHkCmd) };
 static const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_INVALID_LENGTH =
@@ -643,6 +645,9 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestGenericPool);
     UT_ADD_TEST(TestCDSMempool);
     UT_ADD_TEST(TestESMempool);
+    UT_ADD_TEST(TestESMempoolTaskCache);
+    UT_ADD_TEST(TestESMempoolArena);
+    UT_ADD_TEST(TestESMempoolMap);
     UT_ADD_TEST(TestSysLog);
     UT_ADD_TEST(TestBackground);
     UT_ADD_TEST(TestStatusToString);
@@ -2158,21 +2163,22 @@ void TestERLog(void)
 
 void TestGenericPool(void)
 {
-    CFE_ES_GenPoolRecord_t Pool1;
-    CFE_ES_GenPoolRecord_t Pool2;
-    size_t                 Offset1 = 0;
-    size_t                 Offset2 = 0;
-    size_t                 Offset3 = 0;
-    size_t                 Offset4 = 0;
-    size_t                 OffsetEnd;
-    size_t                 BlockSize = 0;
-    CFE_ES_MemOffset_t     FreeSize;
-    CFE_ES_MemOffset_t     TotalSize;
-    uint16                 NumBlocks;
-    uint32                 CountBuf;
-    uint32                 ErrBuf;
-    CFE_ES_BlockStats_t    BlockStats;
-    static const size_t    UT_POOL_BLOCK_SIZES[CFE_PLATFORM_ES_POOL_MAX_BUCKETS] = {
+    CFE_ES_GenPoolRecord_t    Pool1;
+    CFE_ES_GenPoolRecord_t    Pool2;
+    size_t                    Offset1 = 0;
+    size_t                    Offset2 = 0;
+    size_t                    Offset3 = 0;
+    size_t                    Offset4 = 0;
+    size_t                    OffsetEnd;
+    size_t                    BlockSize = 0;
+    CFE_ES_MemOffset_t        FreeSize;
+    CFE_ES_MemOffset_t        TotalSize;
+    uint16                    NumBlocks;
+    uint32                    CountBuf;
+    uint32                    ErrBuf;
+    CFE_ES_BlockStats_t       BlockStats;
+    CFE_ES_GenPoolBlockInfo_t BlockInfo;
+    static const size_t       UT_POOL_BLOCK_SIZES[CFE_PLATFORM_ES_POOL_MAX_BUCKETS] = {
         /*
          * These are intentionally in a mixed order
          * so that the implementation will sort them.
@@ -2232,6 +2238,26 @@ void TestGenericPool(void)
     /* Attempt Bigger than the largest bucket */
     UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 1000), CFE_ES_ERR_MEM_BLOCK_SIZE);
 
+    /* Size class boundaries */
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolSizeClass(0), 0);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolSizeClass(1), 0);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolSizeClass(2), 1);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolSizeClass(32), 5);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolSizeClass(33), 6);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolSizeClass((size_t)-1), CFE_ES_GENERIC_POOL_SIZE_CLASSES - 1);
+
+    /* Bucket lookup must select the smallest block that fits, including within a size class */
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 0), Pool1.NumBuckets);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 4), Pool1.NumBuckets);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 5), Pool1.NumBuckets - 1);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 33), Pool1.NumBuckets - 8);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 41), Pool1.NumBuckets - 10);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 64), 2);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 65), 1);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 128), 1);
+    UtAssert_ZERO(CFE_ES_GenPoolFindBucket(&Pool1, 129));
+    UtAssert_ZERO(CFE_ES_GenPoolFindBucket(&Pool1, (size_t)-1));
+
     /* Call stats functions for coverage (no return code) */
     UtAssert_VOIDCALL(CFE_ES_GenPoolGetUsage(&Pool1, &FreeSize, &TotalSize));
     UtAssert_VOIDCALL(CFE_ES_GenPoolGetUsage(&Pool1, NULL, &TotalSize));
@@ -2277,6 +2303,26 @@ void TestGenericPool(void)
         UtAssert_UINT32_EQ(ExpectedCount, Pool2.Buckets[i].ReleaseCount);
     }
 
+    /* Walk the blocks in the pool, the first two were released and the last is still allocated */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockInfo(&Pool1, 0, &BlockInfo));
+    UtAssert_EQ(size_t, BlockInfo.BlockOffset, Offset1);
+    UtAssert_EQ(size_t, BlockInfo.BlockSize, 44);
+    UtAssert_BOOL_FALSE(BlockInfo.IsAllocated);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockInfo(&Pool1, BlockInfo.NextPosition, &BlockInfo));
+    UtAssert_EQ(size_t, BlockInfo.BlockOffset, Offset2);
+    UtAssert_EQ(size_t, BlockInfo.BlockSize, 128);
+    UtAssert_EQ(size_t, BlockInfo.ActualSize, 100);
+    UtAssert_BOOL_FALSE(BlockInfo.IsAllocated);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockInfo(&Pool1, BlockInfo.NextPosition, &BlockInfo));
+    UtAssert_EQ(size_t, BlockInfo.BlockOffset, Offset3);
+    UtAssert_EQ(size_t, BlockInfo.BlockSize, 8);
+    UtAssert_EQ(size_t, BlockInfo.ActualSize, 6);
+    UtAssert_UINT32_EQ(BlockInfo.BucketId, Pool1.NumBuckets - 1);
+    UtAssert_BOOL_TRUE(BlockInfo.IsAllocated);
+    UtAssert_EQ(size_t, BlockInfo.NextPosition, Pool1.TailPosition);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockInfo(&Pool1, BlockInfo.NextPosition, &BlockInfo),
+                      CFE_ES_BUFFER_NOT_IN_POOL);
+
     /* Get blocks again, from the recovered pool, to demonstrate that
      * the pool is functional after recovery. */
     CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool2, &Offset3, 44));
@@ -2409,6 +2455,8 @@ void TestGenericPool(void)
     Pool1.Buckets[0].FirstOffset  = 2;
     Pool1.Buckets[0].ReleaseCount = Pool1.Buckets[0].RecycleCount + 1;
     UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, Pool1.Buckets[0].BlockSize), CFE_ES_CDS_ACCESS_ERROR);
+    Pool1.TailPosition = Pool1.PoolMaxOffset;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockInfo(&Pool1, 0, &BlockInfo), CFE_ES_CDS_ACCESS_ERROR);
 
     /* Commit failures */
     ES_ResetUnitTest();
@@ -2439,6 +2487,17 @@ void TestGenericPool(void)
     BdPtr->ActualSize = 0;
     UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offset1), CFE_ES_POOL_BLOCK_INVALID);
 
+    /* A block that cannot be identified ends the walk */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockInfo(&Pool1, 0, &BlockInfo));
+    BdPtr->ActualSize = Pool1.Buckets[0].BlockSize + 1;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockInfo(&Pool1, 0, &BlockInfo), CFE_ES_POOL_BLOCK_INVALID);
+    BdPtr->ActualSize = 0;
+    BdPtr->CheckBits  = ~CFE_ES_CHECK_PATTERN;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockInfo(&Pool1, 0, &BlockInfo), CFE_ES_POOL_BLOCK_INVALID);
+    BdPtr->CheckBits = CFE_ES_CHECK_PATTERN;
+    BdPtr->Allocated = 0;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockInfo(&Pool1, 0, &BlockInfo), CFE_ES_POOL_BLOCK_INVALID);
+
     UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlockSize(&Pool1, NULL, 0), CFE_ES_BUFFER_NOT_IN_POOL);
 
     /* Put pool block with bad allocation info */
@@ -2506,6 +2565,7 @@ void TestTask(void)
         CFE_ES_SendMemPoolStatsCmd_t SendMemPoolStatsCmd;
         CFE_ES_DumpCDSRegistryCmd_t  DumpCDSRegistryCmd;
         CFE_ES_QueryAllTasksCmd_t    QueryAllTasksCmd;
+        CFE_ES_WriteMemPoolMapCmd_t  WriteMemPoolMapCmd;
     } CmdBuf;
     CFE_ES_AppRecord_t *    UtAppRecPtr;
     CFE_ES_AppRecord_t *    UtAppRecPtr1;
@@ -3159,6 +3219,30 @@ void TestTask(void)
                     UT_TPID_CFE_ES_CMD_WRITE_ER_LOG_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_ERLOG_PENDING_ERR_EID);
 
+    /* Test successful request to write the memory pool block map, done by the background task */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteMemPoolMapCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_MAP_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundMemPoolMapState.FileWrite.FileSubType, CFE_FS_SubType_ES_MEMPOOLMAP);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Failure of parsing the file name */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteMemPoolMapCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_MAP_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_MEMPOOL_MAP_ERR_EID);
+
+    /* Write already in progress */
+    UT_ClearEventHistory();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.WriteMemPoolMapCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_MEM_POOL_MAP_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_MEMPOOL_MAP_PENDING_ERR_EID);
+
     /* Test scan for exceptions in the PSP, should invoke a Processor Reset */
     ES_ResetUnitTest();
     UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_Exception_GetCount), 1);
@@ -3602,6 +3686,22 @@ void TestPerf(void)
     CFE_ES_SetupPerfVariables(CFE_PSP_RST_TYPE_PROCESSOR);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
 
+    /* The reservation count is recovered from the preserved log on a processor reset */
+    ES_ResetUnitTest();
+    Perf->MetaData.DataCount = 10;
+    CFE_ES_SetupPerfVariables(CFE_PSP_RST_TYPE_PROCESSOR);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfDataSeq, 10);
+    Perf->MetaData.DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->MetaData.DataEnd   = 10;
+    CFE_ES_SetupPerfVariables(CFE_PSP_RST_TYPE_PROCESSOR);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfDataSeq, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 10);
+    CFE_ES_PerfLogSetDataPosition(CFE_ES_Global.PerfDataSeq);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 10);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 10);
+    CFE_ES_SetupPerfVariables(CFE_PSP_RST_TYPE_POWERON);
+    UtAssert_ZERO(CFE_ES_Global.PerfDataSeq);
+
     /* Test successful performance data collection start in START
      * trigger mode
      */
@@ -3812,11 +3912,14 @@ void TestPerf(void)
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PerfTrigger_END);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
 
-    /* Test addition where state goes to idle after first check */
+    /* Test addition where state goes to idle after first check, no entry is reserved */
     ES_ResetUnitTest();
-    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
-    UT_SetHandlerFunction(UT_KEY(OS_MutSemTake), ES_UT_SetPerfIdle, NULL);
+    Perf->MetaData.State         = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.FilterMask[0] = 0xffff;
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_SetPerfIdle, NULL);
     CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_ZERO(CFE_ES_Global.PerfDataSeq);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
 
     /* Test addition of a new entry to the performance log with an invalid
      * marker after an invalid marker has already been reported
@@ -3846,6 +3949,24 @@ void TestPerf(void)
     Perf->MetaData.FilterMask[0] = 0xffff;
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 1);
+
+    /* Test addition of a new entry once the log has wrapped, and at the point where the
+     * reservation count is folded back, which must not move the slot or the log positions
+     */
+    Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.TriggerMask[0] = 0x0;
+    CFE_ES_Global.PerfDataSeq     = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 1);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 1);
+    CFE_ES_Global.PerfDataSeq = CFE_ES_PERF_SEQ_FOLD - 1;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.PerfDataSeq, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_ZERO(Perf->MetaData.DataStart);
+    UtAssert_ZERO(Perf->MetaData.DataEnd);
 
     /* Test addition of a new entry to the performance log with a marker that
      * is not in the trigger mask
@@ -5573,6 +5694,320 @@ void TestESMempool(void)
     UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, NULL), CFE_ES_BAD_ARGUMENT);
 }
 
+void TestESMempoolTaskCache(void)
+{
+    static CFE_ES_STATIC_POOL_TYPE(4096) PoolBuffer;
+    CFE_ES_MemHandle_t                 PoolID = CFE_ES_MEMHANDLE_UNDEFINED;
+    CFE_ES_MemPoolBuf_t                BufList[CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH + 1];
+    CFE_ES_MemPoolBuf_t                addressp;
+    CFE_ES_MemPoolRecord_t *           PoolPtr;
+    CFE_ES_MemPoolMagazine_t *         MagazinePtr;
+    CFE_ES_MemPoolStats_t              Stats;
+    CFE_ES_BackgroundMemPoolMapState_t MapState;
+    CFE_ES_TaskRecord_t *              UtTaskRecPtr;
+    CFE_ES_TaskId_t                    TaskId;
+    void *                             LocalBuffer;
+    size_t                             LocalBufSize;
+    size_t                             BlockSizes[2] = {32, 64};
+    uint32                             i;
+
+    UtPrintf("Begin Test ES memory pool task caches");
+
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, &UtTaskRecPtr);
+    TaskId = CFE_ES_TaskRecordGetID(UtTaskRecPtr);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), OS_ObjectIdToInteger(CFE_ES_TaskId_ToOSAL(TaskId)));
+
+    /* The caches must fit in the pool memory along with at least one block */
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateWithOpts(&PoolID, PoolBuffer.Data, sizeof(CFE_ES_MemPoolMagazine_t), 2,
+                                                BlockSizes, CFE_ES_POOLOPTS_TASK_CACHE),
+                      CFE_ES_BAD_ARGUMENT);
+
+    /* Task caches always get a mutex, even if not asked for */
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreateWithOpts(&PoolID, PoolBuffer.Data, sizeof(PoolBuffer), 2, BlockSizes,
+                                                   CFE_ES_POOLOPTS_TASK_CACHE));
+    PoolPtr = CFE_ES_LocateMemPoolRecordByID(PoolID);
+    UtAssert_ADDRESS_EQ(PoolPtr->Magazines, PoolBuffer.Data);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(PoolPtr->MutexId));
+
+    /* First get claims a cache for the task and refills it with a batch, the size reported is the block size */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp, PoolID, 40), 40);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID, addressp), 64);
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(PoolPtr->CacheTaskId[0], TaskId));
+    MagazinePtr = &PoolPtr->Magazines[1]; /* second bucket, 64 bytes */
+    UtAssert_UINT32_EQ(MagazinePtr->Count, (CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH / 2) - 1);
+
+    /* Blocks held in the cache are reported as free */
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    UtAssert_UINT32_EQ(Stats.BlockStats[0].NumCreated, CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH / 2);
+    UtAssert_UINT32_EQ(Stats.BlockStats[0].NumFree, (CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH / 2) - 1);
+    UtAssert_ZERO(Stats.BlockStats[1].NumCreated);
+
+    /* The block map shows them as free too, the first one created being the first in the cache */
+    memset(&MapState, 0, sizeof(MapState));
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundMemPoolMapDataGetter(&MapState, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_EQ(size_t, CFE_ES_MEMOFFSET_TO_SIZET(MapState.EntryBuffer.Offset), MagazinePtr->Offsets[0]);
+    UtAssert_BOOL_FALSE(MapState.EntryBuffer.Allocated);
+
+    /* Put goes back into the cache without the pool mutex, and a second put of the same block is caught */
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UT_ResetState(UT_KEY(OS_MutSemGive));
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp), 64);
+    UtAssert_UINT32_EQ(MagazinePtr->Count, CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH / 2);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+
+    /* The most recently released block is handed out first, without the pool mutex */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&BufList[0], PoolID, 50), 50);
+    UtAssert_ADDRESS_EQ(BufList[0], addressp);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+
+    /* Drain the cache so it needs another refill, then overfill it so it flushes */
+    for (i = 1; i <= CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&BufList[i], PoolID, 64), 64);
+    }
+    for (i = 0; i <= CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, BufList[i]), 64);
+    }
+    UtAssert_UINT32_LTEQ(MagazinePtr->Count, CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH);
+    UtAssert_NONZERO(PoolPtr->Pool.Buckets[1].ReleaseCount);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    UtAssert_UINT32_EQ(Stats.BlockStats[0].NumFree, Stats.BlockStats[0].NumCreated);
+
+    /* Flushing the task returns everything to the shared pool and frees the slot */
+    CFE_ES_MemPoolFlushTaskCache(TaskId);
+    UtAssert_ZERO(MagazinePtr->Count);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(PoolPtr->CacheTaskId[0]));
+    UtAssert_UINT32_EQ(PoolPtr->Pool.Buckets[1].ReleaseCount - PoolPtr->Pool.Buckets[1].RecycleCount,
+                       Stats.BlockStats[0].NumCreated);
+
+    /* Requests too large for any bucket use the shared path and fail there */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp, PoolID, 100), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    /* Calls outside of a task context use the shared pool */
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), OS_ObjectIdToInteger(OS_OBJECT_ID_UNDEFINED));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp, PoolID, 20), 20);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp), 20);
+    UtAssert_ZERO(PoolPtr->Magazines[0].Count);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(PoolPtr->CacheTaskId[0]));
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), OS_ObjectIdToInteger(CFE_ES_TaskId_ToOSAL(TaskId)));
+
+    /* With all cache slots taken, other tasks use the shared pool */
+    for (i = 0; i < CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS; ++i)
+    {
+        PoolPtr->CacheTaskId[i] = CFE_ES_TASKID_C(
+            CFE_ResourceId_FromInteger(CFE_ResourceId_ToInteger(CFE_RESOURCEID_UNWRAP(TaskId)) + i + 1));
+    }
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp, PoolID, 20), 20);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp), 20);
+    for (i = 0; i < CFE_PLATFORM_ES_MEMPOOL_CACHE_TASKS; ++i)
+    {
+        UtAssert_ZERO(PoolPtr->Magazines[i * 2].Count);
+    }
+    memset(PoolPtr->CacheTaskId, 0, sizeof(PoolPtr->CacheTaskId));
+
+    /*
+     * A block released twice into different caches is dropped when flushed, and counted
+     * as an error, without failing the release that caused the flush
+     */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&BufList[0], PoolID, 20), 20);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&BufList[1], PoolID, 20), 20);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, BufList[0]), 32);
+    MagazinePtr = &PoolPtr->Magazines[0];
+    while (MagazinePtr->Count < CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH)
+    {
+        MagazinePtr->Offsets[MagazinePtr->Count] = MagazinePtr->Offsets[0];
+        ++MagazinePtr->Count;
+    }
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    i = Stats.CheckErrCtr;
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, BufList[1]), 32);
+    UtAssert_UINT32_EQ(MagazinePtr->Count, (CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH / 2) + 1);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    UtAssert_UINT32_EQ(Stats.CheckErrCtr, i + 1);
+    CFE_ES_MemPoolFlushTaskCache(TaskId);
+    UtAssert_ZERO(MagazinePtr->Count);
+
+    /* A refill that cannot get a single block fails */
+    for (i = 0; i < 200; ++i)
+    {
+        if (CFE_ES_GetPoolBuf(&addressp, PoolID, 20) == CFE_ES_ERR_MEM_BLOCK_SIZE)
+        {
+            break;
+        }
+    }
+    UtAssert_UINT32_LTEQ(i, 199);
+
+    /* A failure to access a block descriptor is reported, and the blocks that cannot be flushed are dropped */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp), 32);
+    PoolPtr->Pool.Retrieve = ES_UT_PoolRetrieveFail;
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp), CFE_ES_CDS_ACCESS_ERROR);
+    UtAssert_UINT32_EQ(PoolPtr->Magazines[0].Count, 1);
+    CFE_ES_MemPoolFlushTaskCache(TaskId);
+    UtAssert_ZERO(PoolPtr->Magazines[0].Count);
+}
+
+void TestESMempoolArena(void)
+{
+    static CFE_ES_STATIC_POOL_TYPE(1024) PoolBuffer;
+    CFE_ES_MemHandle_t      PoolID  = CFE_ES_MEMHANDLE_UNDEFINED;
+    CFE_ES_MemHandle_t      PoolID2 = CFE_ES_MEMHANDLE_UNDEFINED;
+    CFE_ES_MemPoolBuf_t     addressp1;
+    CFE_ES_MemPoolBuf_t     addressp2;
+    CFE_ES_MemPoolRecord_t *PoolPtr;
+    CFE_ES_MemPoolStats_t   Stats;
+    size_t                  AlignSize;
+    size_t                  FillSize;
+
+    UtPrintf("Begin Test ES memory pool arena");
+
+    ES_ResetUnitTest();
+
+    /* Arena pools cannot have task caches, and must not be empty */
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateWithOpts(&PoolID, PoolBuffer.Data, sizeof(PoolBuffer), 0, NULL,
+                                                CFE_ES_POOLOPTS_ARENA | CFE_ES_POOLOPTS_TASK_CACHE),
+                      CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateWithOpts(&PoolID, PoolBuffer.Data, 0, 0, NULL, CFE_ES_POOLOPTS_ARENA),
+                      CFE_ES_BAD_ARGUMENT);
+
+    /* Block sizes are not used, the whole pool is one bucket */
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreateWithOpts(&PoolID, PoolBuffer.Data, sizeof(PoolBuffer), 0, NULL,
+                                                   CFE_ES_POOLOPTS_MUTEX | CFE_ES_POOLOPTS_ARENA));
+    PoolPtr   = CFE_ES_LocateMemPoolRecordByID(PoolID);
+    AlignSize = PoolPtr->Pool.AlignMask + 1;
+    UtAssert_UINT32_EQ(PoolPtr->Pool.NumBuckets, 1);
+    UtAssert_EQ(size_t, PoolPtr->Pool.Buckets[0].BlockSize, sizeof(PoolBuffer));
+
+    /* Buffers are carved sequentially with no descriptor, aligned */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 1), 1);
+    UtAssert_ADDRESS_EQ(addressp1, PoolBuffer.Data);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID, 100), 100);
+    UtAssert_ADDRESS_EQ(addressp2, &PoolBuffer.Data[AlignSize]);
+
+    /* Any size that fits in the remaining memory can be requested */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, sizeof(PoolBuffer)), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, (size_t)-1), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    UtAssert_UINT32_EQ(Stats.NumBlocksRequested, 2);
+    UtAssert_UINT32_EQ(CFE_ES_MEMOFFSET_TO_SIZET(Stats.PoolSize), sizeof(PoolBuffer));
+    UtAssert_UINT32_EQ(CFE_ES_MEMOFFSET_TO_SIZET(Stats.NumFreeBytes), sizeof(PoolBuffer) - AlignSize - 100);
+    FillSize = sizeof(PoolBuffer) - ((AlignSize + 100 + PoolPtr->Pool.AlignMask) & ~PoolPtr->Pool.AlignMask);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, FillSize), FillSize);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 1), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    /* Buffers cannot be released or inspected individually */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp2), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID, addressp2), CFE_ES_BAD_ARGUMENT);
+
+    /* Reset releases everything, but keeps the request count */
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolReset(PoolID));
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    UtAssert_UINT32_EQ(Stats.NumBlocksRequested, 3);
+    UtAssert_UINT32_EQ(CFE_ES_MEMOFFSET_TO_SIZET(Stats.NumFreeBytes), sizeof(PoolBuffer));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 8), 8);
+    UtAssert_ADDRESS_EQ(addressp1, PoolBuffer.Data);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID));
+
+    /* Arena without a mutex */
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_PoolCreateWithOpts(&PoolID, PoolBuffer.Data, sizeof(PoolBuffer), 0, NULL, CFE_ES_POOLOPTS_ARENA));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 8), 8);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolReset(PoolID));
+
+    /* Only arena pools can be reset */
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolCreate(&PoolID2, &PoolBuffer.Data[512], 512));
+    UtAssert_INT32_EQ(CFE_ES_PoolReset(PoolID2), CFE_ES_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID2));
+    UtAssert_INT32_EQ(CFE_ES_PoolReset(PoolID2), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID));
+}
+
+void TestESMempoolMap(void)
+{
+    static CFE_ES_STATIC_POOL_TYPE(1536) PoolBuffer;
+    CFE_ES_BackgroundMemPoolMapState_t State;
+    CFE_ES_MemHandle_t                 PoolID  = CFE_ES_MEMHANDLE_UNDEFINED;
+    CFE_ES_MemHandle_t                 PoolID2 = CFE_ES_MEMHANDLE_UNDEFINED;
+    CFE_ES_MemHandle_t                 PoolID3 = CFE_ES_MEMHANDLE_UNDEFINED;
+    CFE_ES_MemPoolBuf_t                addressp1;
+    CFE_ES_MemPoolBuf_t                addressp2;
+    void *                             LocalBuffer;
+    size_t                             LocalBufSize;
+    size_t                             Wasted;
+
+    UtPrintf("Begin Test ES memory pool map");
+
+    ES_ResetUnitTest();
+
+    /* No pools, so nothing to write */
+    memset(&State, 0, sizeof(State));
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundMemPoolMapDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* One allocated and one released block, plus an empty pool and an arena pool which has no blocks to list */
+    CFE_UtAssert_SETUP(CFE_ES_PoolCreate(&PoolID, PoolBuffer.Data, 512));
+    CFE_UtAssert_SETUP(CFE_ES_PoolCreateNoSem(&PoolID2, &PoolBuffer.Data[512], 512));
+    CFE_UtAssert_SETUP(
+        CFE_ES_PoolCreateWithOpts(&PoolID3, &PoolBuffer.Data[1024], 512, 0, NULL, CFE_ES_POOLOPTS_ARENA));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 10), 10);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID, 100), 100);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp2), 100);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID3, 100), 100);
+
+    memset(&State, 0, sizeof(State));
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundMemPoolMapDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &State.EntryBuffer);
+    UtAssert_EQ(size_t, LocalBufSize, sizeof(State.EntryBuffer));
+    CFE_UtAssert_RESOURCEID_EQ(State.EntryBuffer.PoolHandle, PoolID);
+    UtAssert_BOOL_TRUE(State.EntryBuffer.Allocated);
+    UtAssert_EQ(size_t, CFE_ES_MEMOFFSET_TO_SIZET(State.EntryBuffer.ActualSize), 10);
+    Wasted = CFE_ES_MEMOFFSET_TO_SIZET(State.EntryBuffer.BlockSize) - 10;
+    UtAssert_EQ(size_t, CFE_ES_MEMOFFSET_TO_SIZET(State.EntryBuffer.WastedBytes), Wasted);
+
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundMemPoolMapDataGetter(&State, 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_NOT_NULL(LocalBuffer);
+    CFE_UtAssert_RESOURCEID_EQ(State.EntryBuffer.PoolHandle, PoolID);
+    UtAssert_BOOL_FALSE(State.EntryBuffer.Allocated);
+    UtAssert_EQ(size_t, CFE_ES_MEMOFFSET_TO_SIZET(State.EntryBuffer.ActualSize), 100);
+    UtAssert_ZERO(CFE_ES_MEMOFFSET_TO_SIZET(State.EntryBuffer.WastedBytes));
+
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundMemPoolMapDataGetter(&State, 2, &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+    UtAssert_UINT32_EQ(State.NumBlocks, 2);
+    UtAssert_EQ(size_t, State.WastedBytes, Wasted);
+
+    /* Event handler */
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundMemPoolMapEventHandler(&State, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 2, 0, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_MEMPOOL_MAP_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundMemPoolMapEventHandler(&State, CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR, -1, 2, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundMemPoolMapEventHandler(&State, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, -1, 2, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundMemPoolMapEventHandler(&State, CFE_FS_FileWriteEvent_CREATE_ERROR, -1, 2, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_MEMPOOL_MAP_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundMemPoolMapEventHandler(&State, CFE_FS_FileWriteEvent_UNDEFINED, CFE_SUCCESS, 2, 0, 100);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID));
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID2));
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID3));
+}
+
 /* Tests to fill gaps in coverage in SysLog */
 void TestSysLog(void)
 {
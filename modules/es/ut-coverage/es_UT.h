@@ -243,6 +243,54 @@ void TestCDSMempool(void);
 ******************************************************************************/
 void TestESMempool(void);
 
+/*****************************************************************************/
+/**
+** \brief Perform tests on the per-task block caches of ES memory pools
+**
+** \par Description
+**        This function tests the refill, flush and task cleanup of pools
+**        created with the CFE_ES_POOLOPTS_TASK_CACHE option.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestESMempoolTaskCache(void);
+
+/*****************************************************************************/
+/**
+** \brief Performs tests on memory pools created as arenas
+**
+** \par Description
+**        This function tests allocation, stats and reset of pools
+**        created with the CFE_ES_POOLOPTS_ARENA option.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestESMempoolArena(void);
+
+/*****************************************************************************/
+/**
+** \brief Performs tests on the memory pool block map file
+**
+** \par Description
+**        This function tests the background file writer callbacks
+**        that list the blocks of all memory pools.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestESMempoolMap(void);
+
 void TestSysLog(void);
 void TestResourceID(void);
 void TestGenericCounterAPI(void);
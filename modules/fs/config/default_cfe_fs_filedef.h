@@ -165,7 +165,27 @@ enum CFE_FS_SubType
      * command.
      *
      */
-    CFE_FS_SubType_ES_QUERYALLTASKS = 23
+    CFE_FS_SubType_ES_QUERYALLTASKS = 23,
+
+    /**
+     * @brief Software Bus Pipe Latency Data Dump File
+     *
+     * Software Bus Pipe Latency Data Dump File which is generated in response to a
+     * \link #CFE_SB_WRITE_PIPE_LATENCY_CC \SB_WRITEPIPELAT2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_SB_PIPELATENCY = 24,
+
+    /**
+     * @brief Executive Services Memory Pool Block Map Data Dump File
+     *
+     * Executive Services Memory Pool Block Map Data Dump File which is generated in response to a
+     * \link #CFE_ES_WRITE_MEM_POOL_MAP_CC \ES_WRITEPOOLMAP2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_ES_MEMPOOLMAP = 25
 };
 
 /**
@@ -75,6 +75,9 @@ enum
     CFE_RESOURCEID_TBL_VALRESULTID_BASE_OFFSET = OS_OBJECT_TYPE_USER + 8,
     CFE_RESOURCEID_TBL_DUMPCTRLID_BASE_OFFSET  = OS_OBJECT_TYPE_USER + 9,
 
+    /* SB producer buffer pools */
+    CFE_RESOURCEID_SB_BUFFERPOOLID_BASE_OFFSET = OS_OBJECT_TYPE_USER + 10,
+
 };
 
 /*
@@ -102,6 +105,9 @@ enum
     CFE_TBL_VALRESULTID_BASE = CFE_RESOURCEID_MAKE_BASE(CFE_RESOURCEID_TBL_VALRESULTID_BASE_OFFSET),
     CFE_TBL_DUMPCTRLID_BASE  = CFE_RESOURCEID_MAKE_BASE(CFE_RESOURCEID_TBL_DUMPCTRLID_BASE_OFFSET),
 
+    /* SB producer buffer pools */
+    CFE_SB_BUFFERPOOLID_BASE = CFE_RESOURCEID_MAKE_BASE(CFE_RESOURCEID_SB_BUFFERPOOLID_BASE_OFFSET),
+
 };
 
 /** @} */
@@ -29,7 +29,8 @@
 #include "cfe_mission_cfg.h"
 #include "cfe_resourceid_typedef.h"
 
-#define CFE_SB_SUB_ENTRIES_PER_PKT 20 /**< \brief Configuration parameter used by SBN App */
+#define CFE_SB_SUB_ENTRIES_PER_PKT  20 /**< \brief Configuration parameter used by SBN App */
+#define CFE_SB_PIPE_LATENCY_BUCKETS 20 /**< \brief Number of buckets in a pipe latency histogram */
 
 /**
  * @brief Label definitions associated with CFE_SB_QosPriority_Enum_t
@@ -115,12 +116,12 @@ typedef CFE_RESOURCEID_BASE_TYPE CFE_SB_PipeId_t;
 
 /** \brief Quality Of Service Type Definition
 **
-** Currently an unused parameter in #CFE_SB_SubscribeEx
-** Intended to be used for interprocessor communication only
+** Passed to #CFE_SB_SubscribeEx.  The priority selects the lane of pipes created
+** with #CFE_SB_PIPEOPTS_PRIORITY, the reliability is currently unused.
 **/
 typedef struct
 {
-    uint8 Priority; /**< \brief  Specify high(1) or low(0) message priority for off-board routing, currently unused */
+    uint8 Priority;    /**< \brief  Specify high(1) or low(0) message priority, see #CFE_SB_QosPriority_Enum_t */
     uint8 Reliability; /**< \brief  Specify high(1) or low(0) message transfer reliability for off-board routing,
                           currently unused */
 } CFE_SB_Qos_t;
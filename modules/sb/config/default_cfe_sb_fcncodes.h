@@ -459,4 +459,79 @@
 */
 #define CFE_SB_SEND_PREV_SUBS_CC 11
 
+/** \cfesbcmd Write Pipe Latency to a File
+**
+**  \par Description
+**       This command will create a file containing a histogram of the latency
+**       of the messages received from each pipe, which is the time from the
+**       transmit of a message until it is received.  A pipe whose messages
+**       spend a long time on it belongs to an application that is falling
+**       behind.  An absolute path and filename may be specified in the command.
+**       If this command field contains an empty string (NULL terminator as
+**       the first character) the default file path and name is used.
+**       The default file path and name is defined in the platform
+**       configuration file as #CFE_PLATFORM_SB_DEFAULT_PIPE_LATENCY_FILENAME.
+**
+**  \cfecmdmnemonic \SB_WRITEPIPELAT2FILE
+**
+**  \par Command Structure
+**       #CFE_SB_WritePipeLatencyCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment.
+**         NOTE: the command counter is incremented when the request is accepted,
+**         before writing the file, which is performed as a background task.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_SB_DEFAULT_PIPE_LATENCY_FILENAME configuration parameter)
+**         will be updated with the latest information.
+**       - The #CFE_SB_SND_RTG_EID debug event message will be generated
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - A previous request to write a software bus information file has not yet completed
+**       - The specified FileName cannot be parsed
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \SB_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases. See #CFE_SB_SND_RTG_ERR1_EID and #CFE_SB_FILEWRITE_ERR_EID
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system and could, if performed repeatedly without
+**       sufficient file management by the operator, fill the file system.
+**
+**  \sa #CFE_SB_RESET_PIPE_LATENCY_CC
+*/
+#define CFE_SB_WRITE_PIPE_LATENCY_CC 12
+
+/** \cfesbcmd Reset Pipe Latency
+**
+**  \par Description
+**       This command clears the latency histograms of all pipes, as written
+**       to file by the #CFE_SB_WRITE_PIPE_LATENCY_CC command.
+**
+**  \cfecmdmnemonic \SB_RESETPIPELAT
+**
+**  \par Command Structure
+**       #CFE_SB_ResetPipeLatencyCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with the
+**       following telemetry:
+**       - \b \c \SB_CMDPC - command execution counter will increment
+**       - The #CFE_SB_RESET_PIPE_LATENCY_EID informational event message will be generated
+**
+**  \par Error Conditions
+**       There are no error conditions for this command.
+**
+**  \par Criticality
+**       There are no critical issues related to this command.
+**
+**  \sa #CFE_SB_WRITE_PIPE_LATENCY_CC
+*/
+#define CFE_SB_RESET_PIPE_LATENCY_CC 13
+
 #endif
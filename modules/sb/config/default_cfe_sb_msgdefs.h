@@ -155,6 +155,28 @@ typedef struct CFE_SB_PipeInfoEntry
     uint8           Spare[3];                          /**< Padding to make this structure a multiple of 4 bytes */
 } CFE_SB_PipeInfoEntry_t;
 
+/**
+** \brief SB Pipe Latency File Entry
+**
+** This structure is output as part of the CFE SB
+** "Write Pipe Latency" command (#CFE_SB_WRITE_PIPE_LATENCY_CC).
+**
+** The latency of a message is the time from its transmit until it is
+** received from the pipe.  Bucket N of the histogram counts the messages
+** with a latency of at least 2^N and less than 2^(N+1) microseconds.  The
+** first bucket also counts latencies below 1 microsecond, and the last
+** bucket also counts everything longer.
+*/
+typedef struct CFE_SB_PipeLatencyEntry
+{
+    CFE_SB_PipeId_t PipeId;                               /**< The runtime ID of the pipe */
+    CFE_ES_AppId_t  AppId;                                /**< The runtime ID of the app that owns the pipe */
+    char            PipeName[CFE_MISSION_MAX_API_LEN];    /**< The Name of the pipe */
+    char            AppName[CFE_MISSION_MAX_API_LEN];     /**< The Name of the app that owns the pipe */
+    uint32          MaxLatency;                           /**< Longest latency since reset, in microseconds */
+    uint32          Buckets[CFE_SB_PIPE_LATENCY_BUCKETS]; /**< Number of messages received per latency bucket */
+} CFE_SB_PipeLatencyEntry_t;
+
 /**
 ** \cfesbtlm SB Statistics Telemetry Packet
 **
@@ -196,6 +218,11 @@ typedef struct CFE_SB_StatsTlm_Payload
     uint32 PeakSBBuffersInUse; /**< \cfetlmmnemonic \SB_SMPSBBIU
                                     \brief Max number of SB message buffers in use */
 
+    uint32 MsgMapMaxProbeLength; /**< \cfetlmmnemonic \SB_SMMMPRBL
+                                      \brief Longest probe length of a MsgId in the routing map */
+    uint32 MsgMapAvgProbeLength; /**< \cfetlmmnemonic \SB_SMMAPRBL
+                                      \brief Average probe length of MsgIds in the routing map, in hundredths */
+
     uint32 MaxPipeDepthAllowed; /**< \cfetlmmnemonic \SB_SMMPDALW
                                      \brief Maximum allowed pipe depth */
     CFE_SB_PipeDepthStats_t
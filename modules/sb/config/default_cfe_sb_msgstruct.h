@@ -84,6 +84,11 @@ typedef struct CFE_SB_SendHkCmd
     CFE_MSG_CommandHeader_t CommandHeader;
 } CFE_SB_SendHkCmd_t;
 
+typedef struct CFE_SB_ResetPipeLatencyCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader;
+} CFE_SB_ResetPipeLatencyCmd_t;
+
 /*
  * Create a unique typedef for each of the commands that share this format.
  */
@@ -105,6 +110,12 @@ typedef struct CFE_SB_WriteMapInfoCmd
     CFE_SB_WriteFileInfoCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_SB_WriteMapInfoCmd_t;
 
+typedef struct CFE_SB_WritePipeLatencyCmd
+{
+    CFE_MSG_CommandHeader_t           CommandHeader; /**< \brief Command header */
+    CFE_SB_WriteFileInfoCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_SB_WritePipeLatencyCmd_t;
+
 /*
  * Create a unique typedef for each of the commands that share this format.
  */
@@ -784,6 +784,75 @@
  */
 #define CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID 72
 
+/**
+ * \brief SB Create Pipe API Ring Buffer Setup Failure Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  #CFE_SB_CreatePipeEx API failure creating the ring buffer or its wakeup
+ *  semaphore for a pipe with the #CFE_SB_PIPEOPTS_RING option.
+ */
+#define CFE_SB_CR_PIPE_RING_ERR_EID 73
+
+/**
+ * \brief SB Subscribe Mask API Mask Subscription Limit Reached Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  #CFE_SB_SubscribeMask API failure due to no free mask subscription, the
+ *  limit is #CFE_PLATFORM_SB_MAX_MASK_SUBS.
+ */
+#define CFE_SB_MAX_MASK_SUBS_MET_EID 74
+
+/**
+ * \brief SB Reset Pipe Latency Command Success Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_SB_RESET_PIPE_LATENCY_CC SB Reset Pipe Latency Command \endlink success.
+ */
+#define CFE_SB_RESET_PIPE_LATENCY_EID 75
+
+/**
+ * \brief SB Set Pipe Wakeup API Bad Argument Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  #CFE_SB_SetPipeWakeup API failure due to an invalid pipe ID, a pipe that
+ *  was not created with #CFE_SB_PIPEOPTS_RING, or a threshold without a delay.
+ */
+#define CFE_SB_SETPIPEWAKEUP_ERR_EID 76
+
+/**
+ * \brief SB Set Pipe Wakeup API Not Owner Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  #CFE_SB_SetPipeWakeup API failure due to not being the pipe owner.
+ */
+#define CFE_SB_SETPIPEWAKEUP_OWNER_ERR_EID 77
+
+/**
+ * \brief SB Set Pipe Wakeup API Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  #CFE_SB_SetPipeWakeup API success.
+ */
+#define CFE_SB_SETPIPEWAKEUP_EID 78
+
 /**\}*/
 
 #endif /* CFE_SB_EVENTS_H */
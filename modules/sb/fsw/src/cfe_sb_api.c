@@ -57,6 +57,7 @@
 ** Include Files
 */
 #include "cfe_sb_module_all.h"
+#include "cfe_core_atomic.h"
 
 #include <string.h>
 
@@ -94,22 +95,48 @@ CFE_Status_t CFE_SB_PipeId_ToIndex(CFE_SB_PipeId_t PipeID, uint32 *Idx)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName)
 {
-    CFE_ES_AppId_t   AppId;
-    CFE_ES_TaskId_t  TskId;
-    osal_id_t        SysQueueId;
-    int32            OsStatus;
-    int32            Status;
-    CFE_SB_PipeD_t * PipeDscPtr;
-    CFE_ResourceId_t PendingPipeId = CFE_RESOURCEID_UNDEFINED;
-    uint16           PendingEventId;
-    char             FullName[(OS_MAX_API_NAME * 2)];
+    return CFE_SB_CreatePipeEx(PipeIdPtr, Depth, PipeName, 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_CreatePipeEx(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName, uint8 Opts)
+{
+    CFE_ES_AppId_t     AppId;
+    CFE_ES_TaskId_t    TskId;
+    osal_id_t          SysQueueId;
+    osal_id_t          WakeupSemId;
+    int32              OsStatus;
+    int32              Status;
+    CFE_SB_PipeD_t *   PipeDscPtr;
+    CFE_SB_PipeRing_t *RingPtr;
+    CFE_SB_PipeRing_t *UrgentRingPtr;
+    uint32             NumRingSlots;
+    uint16             QueueDepth;
+    CFE_ResourceId_t   PendingPipeId = CFE_RESOURCEID_UNDEFINED;
+    uint16             PendingEventId;
+    char               FullName[(OS_MAX_API_NAME * 2)];
 
     Status         = CFE_SUCCESS;
     SysQueueId     = OS_OBJECT_ID_UNDEFINED;
+    WakeupSemId    = OS_OBJECT_ID_UNDEFINED;
     PendingEventId = 0;
     PipeDscPtr     = NULL;
+    RingPtr        = NULL;
+    UrgentRingPtr  = NULL;
+    NumRingSlots   = 0;
     OsStatus       = OS_SUCCESS;
 
+    /* Both lanes of a priority pipe are rings */
+    if ((Opts & CFE_SB_PIPEOPTS_PRIORITY) != 0)
+    {
+        Opts |= CFE_SB_PIPEOPTS_RING;
+    }
+
     /*
      * Get caller AppId.
      *
@@ -147,8 +174,11 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
         }
         else
         {
-            /* Fully clear the entry, just in case of stale data */
-            memset(PipeDscPtr, 0, sizeof(*PipeDscPtr));
+            /*
+             * Fully clear the entry, just in case of stale data, except for the ring user count.
+             * A transmitter holding the ID of the pipe that used the entry before may be counting.
+             */
+            memset(PipeDscPtr, 0, offsetof(CFE_SB_PipeD_t, RingUsers));
 
             CFE_SB_PipeDescSetUsed(PipeDscPtr, CFE_RESOURCEID_RESERVED);
             CFE_SB_Global.LastPipeId = PendingPipeId;
@@ -159,8 +189,21 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
 
     if (Status == CFE_SUCCESS)
     {
+        /*
+         * A ring buffer pipe still gets a (minimal) queue, as this is what registers the
+         * pipe name, so the name is checked and looked up the same way for all pipes.
+         */
+        if ((Opts & CFE_SB_PIPEOPTS_RING) != 0)
+        {
+            QueueDepth = 1;
+        }
+        else
+        {
+            QueueDepth = Depth;
+        }
+
         /* create the queue */
-        OsStatus = OS_QueueCreate(&SysQueueId, PipeName, Depth, sizeof(CFE_SB_BufferD_t *), 0);
+        OsStatus = OS_QueueCreate(&SysQueueId, PipeName, QueueDepth, sizeof(CFE_SB_BufferD_t *), 0);
         if (OsStatus != OS_SUCCESS)
         {
             if (OsStatus == OS_ERR_NAME_TAKEN)
@@ -182,14 +225,61 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
         }
     }
 
+    if (Status == CFE_SUCCESS && (Opts & CFE_SB_PIPEOPTS_RING) != 0)
+    {
+        OsStatus = OS_BinSemCreate(&WakeupSemId, PipeName, 0, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            WakeupSemId    = OS_OBJECT_ID_UNDEFINED;
+            PendingEventId = CFE_SB_CR_PIPE_RING_ERR_EID;
+            Status         = CFE_SB_PIPE_CR_ERR;
+        }
+    }
+
     CFE_SB_LockSharedData(__func__, __LINE__);
 
+    if (Status == CFE_SUCCESS && (Opts & CFE_SB_PIPEOPTS_RING) != 0)
+    {
+        NumRingSlots = CFE_SB_PipeRing_GetNumSlots(Depth);
+        RingPtr      = CFE_SB_GetPipeRingBlk(NumRingSlots);
+
+        /* Each lane gets the full depth, so a burst on one lane cannot crowd out the other */
+        if (RingPtr != NULL && (Opts & CFE_SB_PIPEOPTS_PRIORITY) != 0)
+        {
+            UrgentRingPtr = CFE_SB_GetPipeRingBlk(NumRingSlots);
+            if (UrgentRingPtr == NULL)
+            {
+                CFE_SB_PutPipeRingBlk(RingPtr);
+                RingPtr = NULL;
+            }
+        }
+
+        if (RingPtr == NULL)
+        {
+            PendingEventId = CFE_SB_CR_PIPE_RING_ERR_EID;
+            Status         = CFE_SB_BUF_ALOC_ERR;
+        }
+        else
+        {
+            CFE_SB_PipeRing_Init(RingPtr, NumRingSlots, WakeupSemId);
+
+            if (UrgentRingPtr != NULL)
+            {
+                CFE_SB_PipeRing_Init(UrgentRingPtr, NumRingSlots, WakeupSemId);
+                RingPtr->UrgentLane = UrgentRingPtr;
+            }
+        }
+    }
+
     if (Status == CFE_SUCCESS)
     {
         /* fill in the pipe table fields */
         PipeDscPtr->SysQueueId    = SysQueueId;
         PipeDscPtr->MaxQueueDepth = Depth;
         PipeDscPtr->AppId         = AppId;
+        PipeDscPtr->Opts          = Opts;
+
+        CFE_ATOMIC_STORE(&PipeDscPtr->Ring, RingPtr);
 
         CFE_SB_PipeDescSetUsed(PipeDscPtr, PendingPipeId);
 
@@ -219,6 +309,17 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 
+    /* If setting up the ring failed, the queue (and possibly the semaphore) must be deleted again */
+    if (PendingEventId == CFE_SB_CR_PIPE_RING_ERR_EID)
+    {
+        OS_QueueDelete(SysQueueId);
+
+        if (OS_ObjectIdDefined(WakeupSemId))
+        {
+            OS_BinSemDelete(WakeupSemId);
+        }
+    }
+
     /* Send any pending events now, after final unlock */
     switch (PendingEventId)
     {
@@ -249,6 +350,11 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
                                        "CreatePipeErr:OS_QueueCreate returned %ld,app %s", (long)OsStatus,
                                        CFE_SB_GetAppTskName(TskId, FullName));
             break;
+        case CFE_SB_CR_PIPE_RING_ERR_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_CR_PIPE_RING_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "CreatePipeErr:Ring setup failed,depth %d,status %ld,app %s", (int)Depth,
+                                       (long)Status, CFE_SB_GetAppTskName(TskId, FullName));
+            break;
 
         default:
             break;
@@ -336,6 +442,7 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     int32                       Status;
     CFE_ES_TaskId_t             TskId;
     CFE_SB_BufferD_t *          BufDscPtr;
+    CFE_SB_PipeRing_t *         RingPtr;
     osal_id_t                   SysQueueId;
     char                        FullName[(OS_MAX_API_NAME * 2)];
     size_t                      BufDscSize;
@@ -365,7 +472,8 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     }
     else
     {
-        /* Remove the pipe from all routes */
+        /* Remove the pipe from all routes, and drop its mask subscriptions so no new routes get it */
+        CFE_SB_RemoveMaskSubs(PipeId);
         Args.PipeId   = PipeId;
         Args.FullName = FullName;
         CFE_SBR_ForEachRouteId(CFE_SB_RemovePipeFromRoute, &Args, NULL);
@@ -376,10 +484,12 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
          * but the pipe ID itself also needs to be invalidated now (before releasing lock) to make
          * sure that no no subscriptions/routes can be added either.
          *
-         * However we must first save certain state data for later deletion.
+         * However we must first save certain state data for later deletion,
+         * and drop the buffers still held from the last receive call.
          */
         SysQueueId = PipeDscPtr->SysQueueId;
-        BufDscPtr  = PipeDscPtr->LastBuffer;
+        BufDscPtr  = NULL;
+        CFE_SB_ReleasePipeBuffers(PipeDscPtr);
 
         /*
          * Mark entry as "reserved" so other resources can be deleted
@@ -395,14 +505,15 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     /* remove any messages that might be on the pipe */
     if (Status == CFE_SUCCESS)
     {
+        /* For a ring buffer pipe, wait for any transmitter/receiver still using the ring */
+        RingPtr = CFE_SB_PipeRing_Detach(PipeDscPtr);
+
         while (true)
         {
             /* decrement refcount of any previous buffer */
             if (BufDscPtr != NULL)
             {
-                CFE_SB_LockSharedData(__func__, __LINE__);
-                CFE_SB_DecrBufUseCnt(BufDscPtr);
-                CFE_SB_UnlockSharedData(__func__, __LINE__);
+                CFE_SB_DecrBufUseCntUnlocked(BufDscPtr);
                 BufDscPtr = NULL;
             }
 
@@ -415,6 +526,14 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
 
         /* Delete the underlying OS queue */
         OS_QueueDelete(SysQueueId);
+
+        /* A task waiting on this pipe as part of a set will find that it is gone once woken */
+        CFE_SB_PipeSet_Wake(PipeDscPtr);
+
+        if (RingPtr != NULL)
+        {
+            CFE_SB_PipeRing_Destroy(RingPtr);
+        }
     }
 
     /*
@@ -481,6 +600,26 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Callback for rebuilding the snapshot of a route after the options of one
+ * of its pipes have changed
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RefreshPipeInRoute(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
+{
+    const CFE_SB_PipeId_t *PipeIdPtr;
+
+    PipeIdPtr = (const CFE_SB_PipeId_t *)ArgPtr;
+
+    if (CFE_SB_GetDestPtr(RouteId, *PipeIdPtr) != NULL)
+    {
+        CFE_SB_PublishRouteSnapshot(RouteId);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -494,6 +633,7 @@ CFE_Status_t CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts)
     CFE_ES_TaskId_t TskId;
     uint16          PendingEventID;
     int32           Status;
+    uint8           OldOpts;
     char            FullName[(OS_MAX_API_NAME * 2)];
 
     PendingEventID = 0;
@@ -523,7 +663,15 @@ CFE_Status_t CFE_SB_SetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 Opts)
     }
     else
     {
-        PipeDscPtr->Opts = Opts;
+        /* The pipe backend is fixed at creation, so the ring option is kept as it is */
+        OldOpts          = PipeDscPtr->Opts;
+        PipeDscPtr->Opts = (Opts & ~CFE_SB_PIPEOPTS_FIXED) | (OldOpts & CFE_SB_PIPEOPTS_FIXED);
+
+        /* Route snapshots record which destinations ignore their own app's messages */
+        if (((PipeDscPtr->Opts ^ OldOpts) & CFE_SB_PIPEOPTS_IGNOREMINE) != 0)
+        {
+            CFE_SBR_ForEachRouteId(CFE_SB_RefreshPipeInRoute, &PipeId, NULL);
+        }
     }
 
     /* If anything went wrong, increment the error counter before unlock */
@@ -657,6 +805,126 @@ CFE_Status_t CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptsPtr)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_SetPipeWakeup(CFE_SB_PipeId_t PipeId, uint16 MsgCount, uint32 MaxDelayUsec)
+{
+    CFE_SB_PipeD_t *   PipeDscPtr;
+    CFE_SB_PipeRing_t *RingPtr;
+    CFE_ES_AppId_t     AppID;
+    CFE_ES_TaskId_t    TskId;
+    uint16             PendingEventID;
+    char               FullName[(OS_MAX_API_NAME * 2)];
+    CFE_Status_t       Status;
+
+    PendingEventID = 0;
+
+    Status = CFE_ES_GetAppID(&AppID);
+    if (Status != CFE_SUCCESS)
+    {
+        /* shouldn't happen... */
+        return Status;
+    }
+
+    /* take semaphore to prevent a task switch during this call */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* check input parameters, only ring pipes decide when to wake their reader */
+    RingPtr    = NULL;
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        RingPtr = CFE_ATOMIC_LOAD(&PipeDscPtr->Ring);
+    }
+
+    /* Holding back the wakeup without a bound on the delay could leave messages sitting in the pipe */
+    if (RingPtr == NULL || (MsgCount > 1 && MaxDelayUsec == 0))
+    {
+        PendingEventID = CFE_SB_SETPIPEWAKEUP_ERR_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    /* check that the caller AppId is the owner of the pipe */
+    else if (!CFE_RESOURCEID_TEST_EQUAL(AppID, PipeDscPtr->AppId))
+    {
+        PendingEventID = CFE_SB_SETPIPEWAKEUP_OWNER_ERR_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        if (MsgCount > 1)
+        {
+            /* OSAL waits are in milliseconds, round up so the reader never wakes too early */
+            CFE_ATOMIC_STORE(&RingPtr->WakeupDelay, (MaxDelayUsec / 1000) + ((MaxDelayUsec % 1000) != 0));
+            CFE_ATOMIC_STORE(&RingPtr->WakeupThreshold, MsgCount);
+        }
+        else
+        {
+            CFE_ATOMIC_STORE(&RingPtr->WakeupThreshold, 0);
+            CFE_ATOMIC_STORE(&RingPtr->WakeupDelay, 0);
+        }
+
+        /* A reader that is already waiting has to start over with the new settings */
+        if (CFE_ATOMIC_EXCHANGE(&RingPtr->ReaderParked, 0) != 0)
+        {
+            OS_BinSemGive(RingPtr->WakeupSemId);
+        }
+    }
+
+    /* If anything went wrong, increment the error counter before unlock */
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_SB_Global.HKTlmMsg.Payload.PipeOptsErrorCounter++;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Send Events */
+    if (PendingEventID != 0)
+    {
+        /* get TaskId of caller for events */
+        CFE_ES_GetTaskID(&TskId);
+    }
+    else
+    {
+        TskId = CFE_ES_TASKID_UNDEFINED;
+    }
+
+    switch (PendingEventID)
+    {
+        case CFE_SB_SETPIPEWAKEUP_ERR_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_SETPIPEWAKEUP_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Pipe Wakeup Error:Bad Argument,PipeId %lu,Count %u,Delay %lu,Requestor %s",
+                                       CFE_RESOURCEID_TO_ULONG(PipeId), (unsigned int)MsgCount,
+                                       (unsigned long)MaxDelayUsec, CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+        case CFE_SB_SETPIPEWAKEUP_OWNER_ERR_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_SETPIPEWAKEUP_OWNER_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Pipe Wakeup Set Error: Caller(%s) is not the owner of pipe %lu",
+                                       CFE_SB_GetAppTskName(TskId, FullName), CFE_RESOURCEID_TO_ULONG(PipeId));
+            break;
+
+        default:
+            break;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* get AppID of caller for events */
+        CFE_ES_GetAppName(FullName, AppID, sizeof(FullName));
+
+        CFE_EVS_SendEventWithAppID(CFE_SB_SETPIPEWAKEUP_EID, CFE_EVS_EventType_DEBUG, CFE_SB_Global.AppId,
+                                   "Pipe wakeup set:id %lu,owner %s,count %u,delay %lu",
+                                   CFE_RESOURCEID_TO_ULONG(PipeId), FullName, (unsigned int)MsgCount,
+                                   (unsigned long)MaxDelayUsec);
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -927,11 +1195,13 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
     char                   PipeName[OS_MAX_API_NAME];
     uint32                 Collisions;
     uint16                 PendingEventID;
+    bool                   IsNewRoute;
 
     PendingEventID = 0;
     Status         = CFE_SUCCESS;
     DestPtr        = NULL;
     Collisions     = 0;
+    IsNewRoute     = false;
 
     /* get the callers Application Id */
     CFE_ES_GetAppID(&AppId);
@@ -968,7 +1238,8 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
         if (!CFE_SBR_IsValidRouteId(RouteId))
         {
             /* Add the route */
-            RouteId = CFE_SBR_AddRoute(MsgId, &Collisions);
+            RouteId    = CFE_SB_AddRoute(MsgId, &Collisions);
+            IsNewRoute = true;
 
             /* if all routing table elements are used, send event */
             if (!CFE_SBR_IsValidRouteId(RouteId))
@@ -976,16 +1247,6 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
                 PendingEventID = CFE_SB_MAX_MSGS_MET_EID;
                 Status         = CFE_SB_MAX_MSGS_MET;
             }
-            else
-            {
-                /* Increment the MsgIds in use ctr and if it's > the high water mark,*/
-                /* adjust the high water mark */
-                CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse++;
-                if (CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse)
-                {
-                    CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse = CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse;
-                }
-            }
         }
     }
 
@@ -1000,7 +1261,18 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
             /* Check if duplicate (status stays as CFE_SUCCESS) */
             if (CFE_RESOURCEID_TEST_EQUAL(DestPtr->PipeId, PipeId))
             {
-                PendingEventID = CFE_SB_DUP_SUBSCRIP_EID;
+                if (DestPtr->IsMaskDest)
+                {
+                    /* Take over the destination added by a mask subscription of the pipe */
+                    DestPtr->IsMaskDest    = false;
+                    DestPtr->MsgId2PipeLim = MsgLim;
+                    DestPtr->Scope         = Scope;
+                    DestPtr->IsUrgent      = (Quality.Priority == CFE_SB_QosPriority_HIGH);
+                }
+                else
+                {
+                    PendingEventID = CFE_SB_DUP_SUBSCRIP_EID;
+                }
                 break;
             }
 
@@ -1016,33 +1288,24 @@ int32 CFE_SB_SubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, CFE_SB_
         /* If no existing dest found, add one now */
         if (DestPtr == NULL)
         {
-            DestPtr = CFE_SB_GetDestinationBlk();
+            DestPtr = CFE_SB_AddDest(RouteId, PipeId, MsgLim, Scope);
             if (DestPtr == NULL)
             {
                 PendingEventID = CFE_SB_DEST_BLK_ERR_EID;
                 Status         = CFE_SB_BUF_ALOC_ERR;
+
+                /* Do not keep the route if it was only added for this subscription */
+                CFE_SB_RemoveRouteIfUnused(RouteId);
             }
             else
             {
-                /* initialize destination block */
-                DestPtr->PipeId        = PipeId;
-                DestPtr->MsgId2PipeLim = MsgLim;
-                DestPtr->Active        = CFE_SB_ACTIVE;
-                DestPtr->BuffCount     = 0;
-                DestPtr->DestCnt       = 0;
-                DestPtr->Scope         = Scope;
-                DestPtr->Prev          = NULL;
-                DestPtr->Next          = NULL;
-
-                /* add destination node */
-                CFE_SB_AddDestNode(RouteId, DestPtr);
-
-                CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse++;
-                if (CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse >
-                    CFE_SB_Global.StatTlmMsg.Payload.PeakSubscriptionsInUse)
+                /* Transmitters read the lane from the destination, so it does not matter that it is set last */
+                DestPtr->IsUrgent = (Quality.Priority == CFE_SB_QosPriority_HIGH);
+
+                if (IsNewRoute)
                 {
-                    CFE_SB_Global.StatTlmMsg.Payload.PeakSubscriptionsInUse =
-                        CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse;
+                    /* A new route also goes to the pipes of matching mask subscriptions */
+                    CFE_SB_AddMaskDests(RouteId);
                 }
             }
         }
@@ -1332,47 +1595,63 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
 
 /*----------------------------------------------------------------
  *
- * Implemented per public API
- * See description in header file for argument/return detail
+ * Internal helper routine only, not part of API.
+ *
+ * Callback for adding the pipe of a new mask subscription to a route
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut)
+void CFE_SB_AddMaskSubToRoute(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
 {
-    CFE_SB_ReceiveTxn_State_t  TxnBuf;
-    CFE_SB_MessageTxn_State_t *Txn;
+    const CFE_SB_MaskSub_t *MaskSubPtr;
 
-    Txn = CFE_SB_ReceiveTxn_Init(&TxnBuf, BufPtr);
+    MaskSubPtr = (const CFE_SB_MaskSub_t *)ArgPtr;
 
-    if (CFE_SB_MessageTxn_IsOK(Txn))
+    if (CFE_SB_MaskSubIsMatch(MaskSubPtr, CFE_SBR_GetMsgId(RouteId)))
     {
-        CFE_SB_MessageTxn_SetTimeout(Txn, TimeOut);
+        CFE_SB_AddMaskDests(RouteId);
     }
+}
 
-    if (CFE_SB_MessageTxn_IsOK(Txn))
-    {
-        CFE_SB_ReceiveTxn_SetPipeId(Txn, PipeId);
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Callback for removing the destinations of a mask subscription from a route
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RemoveMaskSubFromRoute(CFE_SBR_RouteId_t RouteId, void *ArgPtr)
+{
+    const CFE_SB_MaskSub_t *MaskSubPtr;
+    CFE_SB_DestinationD_t * DestPtr;
+    CFE_SB_MsgId_t          MsgId;
+    uint32                  i;
 
-        /*
-         * Set the verify flag true by default -
-         * in the default impl verify is a no-op that always succeeds.
-         * If an actual implementation is provided, it will be used here.
-         */
-        CFE_SB_MessageTxn_SetEndpoint(Txn, true);
-    }
+    MaskSubPtr = (const CFE_SB_MaskSub_t *)ArgPtr;
+    MsgId      = CFE_SBR_GetMsgId(RouteId);
+    DestPtr    = NULL;
 
-    if (BufPtr != NULL)
+    if (CFE_SB_MaskSubIsMatch(MaskSubPtr, MsgId))
     {
-        /*
-         * Note - the API should qualify the parameter as "const", but this is
-         * kept non-const for backward compatibility.  Callers should never write to
-         * the returned buffer, it is const in practice.
-         */
-        *BufPtr = (CFE_SB_Buffer_t *)CFE_SB_ReceiveTxn_Execute(Txn);
+        DestPtr = CFE_SB_GetDestPtr(RouteId, MaskSubPtr->PipeId);
     }
 
-    CFE_SB_MessageTxn_ReportEvents(Txn);
+    if (DestPtr != NULL && DestPtr->IsMaskDest)
+    {
+        /* Keep the destination if another mask subscription of the pipe still matches */
+        for (i = 0; i < CFE_PLATFORM_SB_MAX_MASK_SUBS && DestPtr != NULL; ++i)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(CFE_SB_Global.MaskSubs[i].PipeId, MaskSubPtr->PipeId) &&
+                CFE_SB_MaskSubIsMatch(&CFE_SB_Global.MaskSubs[i], MsgId))
+            {
+                DestPtr = NULL;
+            }
+        }
 
-    return CFE_SB_MessageTxn_GetStatus(Txn);
+        if (DestPtr != NULL)
+        {
+            CFE_SB_RemoveDest(RouteId, DestPtr);
+        }
+    }
 }
 
 /*----------------------------------------------------------------
@@ -1381,35 +1660,555 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
+CFE_Status_t CFE_SB_SubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId,
+                                  uint16 MsgLim)
 {
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_SB_MaskSub_t *MaskSubPtr;
+    CFE_SB_MaskSub_t *FreeMaskSubPtr;
+    CFE_SB_MaskSub_t  MaskSub;
+    int32             Status;
+    CFE_ES_TaskId_t   TskId;
     CFE_ES_AppId_t    AppId;
-    char              AppName[OS_MAX_API_NAME] = {""};
-    CFE_SB_BufferD_t *BufDscPtr;
-    CFE_SB_Buffer_t * BufPtr;
-    CFE_Status_t      Status;
+    char              FullName[(OS_MAX_API_NAME * 2)];
+    uint32            i;
+    uint16            PendingEventID;
 
-    AppId     = CFE_ES_APPID_UNDEFINED;
-    BufDscPtr = NULL;
-    BufPtr    = NULL;
+    PendingEventID = 0;
+    Status         = CFE_SUCCESS;
 
-    Status = CFE_ES_GetAppID(&AppId);
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
 
-    if (MsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+    /* get TaskId of caller for events */
+    CFE_ES_GetTaskID(&TskId);
+
+    /* take semaphore to prevent a task switch during this call */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* check that the pipe has been created */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
     {
-        CFE_ES_GetAppName(AppName, AppId, sizeof(AppName));
-        CFE_ES_WriteToSysLog("%s %s: Failed, requested size %zu larger than allowed %d\n",
-                             AppName, __func__, MsgSize, CFE_MISSION_SB_MAX_SB_MSG_SIZE);
-        return NULL;
+        PendingEventID = CFE_SB_SUB_INV_PIPE_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
     }
-
-    /* get callers AppId */
-    if (Status == CFE_SUCCESS)
+    else if (!CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
     {
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
-        /*
-         * All this needs to do is get a descriptor from the pool,
+        PendingEventID = CFE_SB_SUB_INV_CALLER_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else if (!CFE_SB_IsValidMsgId(MsgId))
+    {
+        PendingEventID = CFE_SB_SUB_ARG_ERR_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        /* Look for the same mask subscription, and for a free entry */
+        FreeMaskSubPtr = NULL;
+        for (i = 0; i < CFE_PLATFORM_SB_MAX_MASK_SUBS; ++i)
+        {
+            MaskSubPtr = &CFE_SB_Global.MaskSubs[i];
+            if (!CFE_RESOURCEID_TEST_DEFINED(MaskSubPtr->PipeId))
+            {
+                if (FreeMaskSubPtr == NULL)
+                {
+                    FreeMaskSubPtr = MaskSubPtr;
+                }
+            }
+            else if (CFE_RESOURCEID_TEST_EQUAL(MaskSubPtr->PipeId, PipeId) && MaskSubPtr->Mask == Mask &&
+                     MaskSubPtr->MsgIdValue == (CFE_SB_MsgIdToValue(MsgId) & Mask))
+            {
+                /* Duplicate (status stays as CFE_SUCCESS) */
+                PendingEventID = CFE_SB_DUP_SUBSCRIP_EID;
+                break;
+            }
+        }
+
+        if (PendingEventID == 0)
+        {
+            if (FreeMaskSubPtr == NULL)
+            {
+                PendingEventID = CFE_SB_MAX_MASK_SUBS_MET_EID;
+                Status         = CFE_SB_MAX_MASK_SUBS_MET;
+            }
+            else
+            {
+                FreeMaskSubPtr->PipeId     = PipeId;
+                FreeMaskSubPtr->MsgIdValue = CFE_SB_MsgIdToValue(MsgId) & Mask;
+                FreeMaskSubPtr->Mask       = Mask;
+                FreeMaskSubPtr->MsgLim     = MsgLim;
+                CFE_SB_Global.NumMaskSubs++;
+
+                /*
+                 * Resolve the match now, so transmitters never have to: message IDs that already
+                 * have a route get the pipe, and every other matching message ID gets a route
+                 */
+                CFE_SBR_ForEachRouteId(CFE_SB_AddMaskSubToRoute, FreeMaskSubPtr, NULL);
+                Status = CFE_SB_AddMaskRoutes(FreeMaskSubPtr);
+
+                if (Status != CFE_SUCCESS)
+                {
+                    /* Undo the whole subscription rather than leave it partly resolved */
+                    MaskSub                = *FreeMaskSubPtr;
+                    FreeMaskSubPtr->PipeId = CFE_SB_INVALID_PIPE;
+                    CFE_SB_Global.NumMaskSubs--;
+                    CFE_SBR_ForEachRouteId(CFE_SB_RemoveMaskSubFromRoute, &MaskSub, NULL);
+
+                    PendingEventID = CFE_SB_MAX_MSGS_MET_EID;
+                }
+            }
+        }
+    }
+
+    /* Increment counter before unlock */
+    switch (PendingEventID)
+    {
+        case CFE_SB_SUB_INV_PIPE_EID:
+        case CFE_SB_SUB_INV_CALLER_EID:
+        case CFE_SB_SUB_ARG_ERR_EID:
+        case CFE_SB_MAX_MASK_SUBS_MET_EID:
+        case CFE_SB_MAX_MSGS_MET_EID:
+            CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter++;
+            break;
+        case CFE_SB_DUP_SUBSCRIP_EID:
+            CFE_SB_Global.HKTlmMsg.Payload.DuplicateSubscriptionsCounter++;
+            break;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    switch (PendingEventID)
+    {
+        case CFE_SB_DUP_SUBSCRIP_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_DUP_SUBSCRIP_EID, CFE_EVS_EventType_INFORMATION, CFE_SB_Global.AppId,
+                                       "Duplicate Subscription,MsgId 0x%x Mask 0x%x on pipe %lu,app %s",
+                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)Mask,
+                                       CFE_RESOURCEID_TO_ULONG(PipeId), CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_SUB_INV_CALLER_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_SUB_INV_CALLER_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Subscribe Err:Caller(%s) is not the owner of pipe %lu,Msg=0x%x",
+                                       CFE_SB_GetAppTskName(TskId, FullName), CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId));
+            break;
+
+        case CFE_SB_SUB_INV_PIPE_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_SUB_INV_PIPE_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Subscribe Err:Invalid Pipe Id,Msg=0x%x,PipeId=%lu,App %s",
+                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId), CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_MAX_MASK_SUBS_MET_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_MAX_MASK_SUBS_MET_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Subscribe Err:Max Mask Subs(%d)In Use,MsgId 0x%x Mask 0x%x,app %s",
+                                       CFE_PLATFORM_SB_MAX_MASK_SUBS, (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                       (unsigned int)Mask, CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_MAX_MSGS_MET_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_MAX_MSGS_MET_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Subscribe Err:Max Msgs(%d)In Use,MsgId 0x%x Mask 0x%x,app %s",
+                                       CFE_PLATFORM_SB_MAX_MSG_IDS, (unsigned int)CFE_SB_MsgIdToValue(MsgId),
+                                       (unsigned int)Mask, CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_SUB_ARG_ERR_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_SUB_ARG_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Subscribe Err:Bad Arg,MsgId 0x%x Mask 0x%x,PipeId %lu,app %s",
+                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)Mask,
+                                       CFE_RESOURCEID_TO_ULONG(PipeId), CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        default:
+            break;
+    }
+
+    /* If no other event pending, send a debug event indicating success */
+    if (Status == CFE_SUCCESS && PendingEventID == 0)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_RCVD_EID, CFE_EVS_EventType_DEBUG, CFE_SB_Global.AppId,
+                                   "Subscription Rcvd:MsgId 0x%x Mask 0x%x on PipeId %lu,app %s",
+                                   (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)Mask,
+                                   CFE_RESOURCEID_TO_ULONG(PipeId), CFE_SB_GetAppTskName(TskId, FullName));
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_UnsubscribeMask(CFE_SB_MsgId_t MsgId, CFE_SB_MsgId_Atom_t Mask, CFE_SB_PipeId_t PipeId)
+{
+    CFE_SB_PipeD_t * PipeDscPtr;
+    CFE_SB_MaskSub_t MaskSub;
+    int32            Status;
+    CFE_ES_TaskId_t  TskId;
+    CFE_ES_AppId_t   AppId;
+    char             FullName[(OS_MAX_API_NAME * 2)];
+    uint32           i;
+    uint16           PendingEventID;
+
+    PendingEventID = 0;
+    Status         = CFE_SUCCESS;
+
+    /* get the callers Application Id */
+    CFE_ES_GetAppID(&AppId);
+
+    /* get TaskId of caller for events */
+    CFE_ES_GetTaskID(&TskId);
+
+    /* take semaphore to prevent a task switch during this call */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* check that the pipe has been created */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        PendingEventID = CFE_SB_UNSUB_INV_PIPE_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    /* if caller is not the owner of the pipe, send error event and return */
+    else if (!CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
+    {
+        PendingEventID = CFE_SB_UNSUB_INV_CALLER_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else if (!CFE_SB_IsValidMsgId(MsgId))
+    {
+        PendingEventID = CFE_SB_UNSUB_ARG_ERR_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        MaskSub.PipeId     = PipeId;
+        MaskSub.MsgIdValue = CFE_SB_MsgIdToValue(MsgId) & Mask;
+        MaskSub.Mask       = Mask;
+        MaskSub.MsgLim     = 0;
+
+        for (i = 0; i < CFE_PLATFORM_SB_MAX_MASK_SUBS; ++i)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(CFE_SB_Global.MaskSubs[i].PipeId, PipeId) &&
+                CFE_SB_Global.MaskSubs[i].Mask == Mask && CFE_SB_Global.MaskSubs[i].MsgIdValue == MaskSub.MsgIdValue)
+            {
+                break;
+            }
+        }
+
+        if (i < CFE_PLATFORM_SB_MAX_MASK_SUBS)
+        {
+            CFE_SB_Global.MaskSubs[i].PipeId = CFE_SB_INVALID_PIPE;
+            CFE_SB_Global.NumMaskSubs--;
+
+            CFE_SBR_ForEachRouteId(CFE_SB_RemoveMaskSubFromRoute, &MaskSub, NULL);
+        }
+        else
+        {
+            PendingEventID = CFE_SB_UNSUB_NO_SUBS_EID;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    switch (PendingEventID)
+    {
+        case CFE_SB_UNSUB_NO_SUBS_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_NO_SUBS_EID, CFE_EVS_EventType_INFORMATION, CFE_SB_Global.AppId,
+                                       "Unsubscribe Err:No subs for Msg 0x%x Mask 0x%x on pipe %lu,app %s",
+                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)Mask,
+                                       CFE_RESOURCEID_TO_ULONG(PipeId), CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_UNSUB_INV_PIPE_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_INV_PIPE_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Unsubscribe Err:Invalid Pipe Id Msg=0x%x,Pipe=%lu,app=%s",
+                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId), CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_UNSUB_INV_CALLER_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_INV_CALLER_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Unsubscribe Err:Caller(%s) is not the owner of pipe %lu,Msg=0x%x",
+                                       CFE_SB_GetAppTskName(TskId, FullName), CFE_RESOURCEID_TO_ULONG(PipeId),
+                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId));
+            break;
+
+        case CFE_SB_UNSUB_ARG_ERR_EID:
+            CFE_EVS_SendEventWithAppID(CFE_SB_UNSUB_ARG_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                       "Unsubscribe Err:Bad Arg,MsgId 0x%x Mask 0x%x,PipeId %lu,app %s",
+                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)Mask,
+                                       CFE_RESOURCEID_TO_ULONG(PipeId), CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        default:
+            break;
+    }
+
+    /* if no other event pending, send a debug event for successful unsubscribe */
+    if (Status == CFE_SUCCESS && PendingEventID == 0)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_SB_SUBSCRIPTION_REMOVED_EID, CFE_EVS_EventType_DEBUG, CFE_SB_Global.AppId,
+                                   "Subscription Removed:Msg 0x%x Mask 0x%x on pipe %lu,app %s",
+                                   (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)Mask,
+                                   CFE_RESOURCEID_TO_ULONG(PipeId), CFE_SB_GetAppTskName(TskId, FullName));
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_SetDeliveryRate(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint16 Decimation, uint16 MaxRateHz)
+{
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SBR_RouteId_t      RouteId;
+    CFE_ES_AppId_t         AppId;
+    CFE_Status_t           Status;
+    uint32                 MinInterval;
+    int64                  LastDelivery;
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    /* Round the interval up, so the rate is never exceeded */
+    MinInterval = 0;
+    if (MaxRateHz != 0)
+    {
+        MinInterval = (1000000 + MaxRateHz - 1) / MaxRateHz;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    DestPtr    = NULL;
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    /* Only the owner of the pipe may change the rate of one of its subscriptions */
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId) && CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId) &&
+        CFE_SB_IsValidMsgId(MsgId))
+    {
+        RouteId = CFE_SBR_GetRouteId(MsgId);
+        if (CFE_SBR_IsValidRouteId(RouteId))
+        {
+            DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
+        }
+    }
+
+    if (DestPtr == NULL)
+    {
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        /* The next message is the first one delivered, whichever limit applies */
+        LastDelivery = CFE_SB_GetLatencyTime() - MinInterval;
+
+        CFE_ATOMIC_STORE(&DestPtr->DecimationCount, 0);
+        CFE_ATOMIC_STORE(&DestPtr->Decimation, Decimation);
+        CFE_ATOMIC_STORE(&DestPtr->LastDeliveryEpoch, (uint32)((uint64)LastDelivery >> 32));
+        CFE_ATOMIC_STORE(&DestPtr->LastDelivery, (uint32)LastDelivery);
+        CFE_ATOMIC_STORE(&DestPtr->MinInterval, MinInterval);
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    CFE_SB_ReceiveTxn_State_t  TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+
+    Txn = CFE_SB_ReceiveTxn_Init(&TxnBuf, BufPtr);
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_MessageTxn_SetTimeout(Txn, TimeOut);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_ReceiveTxn_SetPipeId(Txn, PipeId);
+
+        /*
+         * Set the verify flag true by default -
+         * in the default impl verify is a no-op that always succeeds.
+         * If an actual implementation is provided, it will be used here.
+         */
+        CFE_SB_MessageTxn_SetEndpoint(Txn, true);
+    }
+
+    if (BufPtr != NULL)
+    {
+        /*
+         * Note - the API should qualify the parameter as "const", but this is
+         * kept non-const for backward compatibility.  Callers should never write to
+         * the returned buffer, it is const in practice.
+         */
+        *BufPtr = (CFE_SB_Buffer_t *)CFE_SB_ReceiveTxn_Execute(Txn);
+    }
+
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    return CFE_SB_MessageTxn_GetStatus(Txn);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReceiveBufferBatch(CFE_SB_PipeId_t PipeId, CFE_SB_Buffer_t **BufArray, uint32 MaxCount,
+                                       int32 TimeOut, uint32 *ReceivedCountPtr)
+{
+    CFE_SB_ReceiveTxn_State_t  TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    uint32                     NumReceived;
+
+    NumReceived = 0;
+
+    Txn = CFE_SB_ReceiveTxn_Init(&TxnBuf, BufArray);
+
+    if (CFE_SB_MessageTxn_IsOK(Txn) && (ReceivedCountPtr == NULL || MaxCount == 0))
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_MessageTxn_SetTimeout(Txn, TimeOut);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        /* This also releases all buffers returned by the previous receive on this pipe */
+        CFE_SB_ReceiveTxn_SetPipeId(Txn, PipeId);
+
+        /* Same as CFE_SB_ReceiveBuffer(), verify each buffer at the endpoint */
+        CFE_SB_MessageTxn_SetEndpoint(Txn, true);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        NumReceived = CFE_SB_ReceiveTxn_ExecuteBatch(Txn, BufArray, MaxCount);
+    }
+
+    if (ReceivedCountPtr != NULL)
+    {
+        *ReceivedCountPtr = NumReceived;
+    }
+
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    return CFE_SB_MessageTxn_GetStatus(Txn);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReceiveBufferFromSet(CFE_SB_Buffer_t **BufPtr, const CFE_SB_PipeId_t *PipeIdList, uint16 NumPipes,
+                                         int32 TimeOut, CFE_SB_PipeId_t *ReadyPipeIdPtr)
+{
+    CFE_SB_ReceiveSetTxn_State_t TxnBuf;
+    CFE_SB_MessageTxn_State_t *  Txn;
+    uint16                       i;
+
+    Txn = CFE_SB_ReceiveSetTxn_Init(&TxnBuf, BufPtr);
+
+    if (CFE_SB_MessageTxn_IsOK(Txn) &&
+        (PipeIdList == NULL || NumPipes == 0 || NumPipes > CFE_PLATFORM_SB_MAX_PIPES_PER_SET))
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_MessageTxn_SetTimeout(Txn, TimeOut);
+    }
+
+    /* The order of the list is the priority order of the pipes */
+    for (i = 0; CFE_SB_MessageTxn_IsOK(Txn) && i < NumPipes; ++i)
+    {
+        /* This also releases the buffer returned by the previous receive on each pipe */
+        CFE_SB_ReceiveTxn_AddPipeId(Txn, PipeIdList[i]);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        /* Same as CFE_SB_ReceiveBuffer(), verify each buffer at the endpoint */
+        CFE_SB_MessageTxn_SetEndpoint(Txn, true);
+    }
+
+    if (BufPtr != NULL)
+    {
+        *BufPtr = (CFE_SB_Buffer_t *)CFE_SB_ReceiveSetTxn_Execute(Txn, ReadyPipeIdPtr);
+    }
+
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    return CFE_SB_MessageTxn_GetStatus(Txn);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
+{
+    CFE_ES_AppId_t    AppId;
+    char              AppName[OS_MAX_API_NAME] = {""};
+    CFE_SB_BufferD_t *BufDscPtr;
+    CFE_SB_Buffer_t * BufPtr;
+    CFE_Status_t      Status;
+
+    AppId     = CFE_ES_APPID_UNDEFINED;
+    BufDscPtr = NULL;
+    BufPtr    = NULL;
+
+    Status = CFE_ES_GetAppID(&AppId);
+
+    if (MsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+    {
+        CFE_ES_GetAppName(AppName, AppId, sizeof(AppName));
+        CFE_ES_WriteToSysLog("%s %s: Failed, requested size %zu larger than allowed %d\n",
+                             AppName, __func__, MsgSize, CFE_MISSION_SB_MAX_SB_MSG_SIZE);
+        return NULL;
+    }
+
+    /* get callers AppId */
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        /*
+         * All this needs to do is get a descriptor from the pool,
          * and associate that descriptor with this app ID, so it
          * can be freed if this app is deleted before it uses it.
          */
@@ -1506,6 +2305,231 @@ CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IsOrigination)
     return CFE_SB_MessageTxn_GetStatus(Txn);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitBufferBatch(CFE_SB_Buffer_t *const *BufPtrArray, uint32 BufCount, bool IsOrigination,
+                                        uint32 *TransmitCountPtr)
+{
+    CFE_SB_TransmitTxn_State_t TxnBuf[CFE_SB_TRANSMIT_BATCH_SIZE];
+    CFE_SB_BufferD_t *         BufDscSet[CFE_SB_TRANSMIT_BATCH_SIZE];
+    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_Status_t               Status;
+    uint32                     NumTxns;
+    uint32                     i;
+    bool                       IsStopped;
+
+    if (BufPtrArray == NULL || TransmitCountPtr == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    *TransmitCountPtr = 0;
+    Status            = CFE_SUCCESS;
+    IsStopped         = false;
+    NumTxns           = 0;
+
+    while (!IsStopped && *TransmitCountPtr < BufCount)
+    {
+        /*
+         * Set up the next group of transactions, stopping at the first buffer that
+         * cannot be sent.  That buffer is left in the next free transaction slot.
+         */
+        NumTxns = 0;
+        while (!IsStopped && NumTxns < CFE_SB_TRANSMIT_BATCH_SIZE && (*TransmitCountPtr + NumTxns) < BufCount)
+        {
+            Txn = CFE_SB_TransmitTxn_Init(&TxnBuf[NumTxns], BufPtrArray[*TransmitCountPtr + NumTxns]);
+
+            /* In this context, the user should have set the the size and MsgId in the content */
+            if (CFE_SB_MessageTxn_IsOK(Txn))
+            {
+                CFE_SB_TransmitTxn_SetupFromMsg(Txn, &BufPtrArray[*TransmitCountPtr + NumTxns]->Msg);
+            }
+
+            if (CFE_SB_MessageTxn_IsOK(Txn))
+            {
+                /* Save passed-in parameters */
+                CFE_SB_MessageTxn_SetEndpoint(Txn, IsOrigination);
+
+                BufDscSet[NumTxns] = CFE_SB_TransmitTxn_SetupBuffer(Txn, BufPtrArray[*TransmitCountPtr + NumTxns]);
+            }
+
+            if (CFE_SB_MessageTxn_IsOK(Txn))
+            {
+                ++NumTxns;
+            }
+            else
+            {
+                IsStopped = true;
+            }
+        }
+
+        if (NumTxns > 0)
+        {
+            CFE_SB_TransmitTxn_ExecuteBatch(TxnBuf, BufDscSet, NumTxns);
+        }
+
+        /* send an event for each pipe write error that may have occurred */
+        for (i = 0; i < NumTxns; ++i)
+        {
+            Txn = &TxnBuf[i].MessageTxn_State;
+            CFE_SB_MessageTxn_ReportEvents(Txn);
+
+            if (Status == CFE_SUCCESS)
+            {
+                Status = CFE_SB_MessageTxn_GetStatus(Txn);
+            }
+        }
+
+        *TransmitCountPtr += NumTxns;
+    }
+
+    /* Also report the buffer that stopped the batch, which was not sent */
+    if (IsStopped)
+    {
+        Txn = &TxnBuf[NumTxns].MessageTxn_State;
+        CFE_SB_MessageTxn_ReportEvents(Txn);
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_SB_MessageTxn_GetStatus(Txn);
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_CreateBufferPool(CFE_SB_BufferPoolId_t *PoolIdPtr, size_t MsgSize, uint16 NumBuffers)
+{
+    CFE_SB_BufferPool_t *PoolPtr;
+    CFE_ResourceId_t     PendingId;
+    CFE_ES_AppId_t       AppId;
+    CFE_Status_t         Status;
+
+    if (PoolIdPtr == NULL || NumBuffers == 0 || MsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    PendingId = CFE_ResourceId_FindNext(CFE_SB_Global.LastBufferPoolId, CFE_PLATFORM_SB_MAX_BUFFER_POOLS,
+                                        CFE_SB_CheckBufferPoolSlotUsed);
+    PoolPtr   = CFE_SB_LocateBufferPoolByID(CFE_SB_BUFFERPOOLID_C(PendingId));
+
+    if (PoolPtr == NULL)
+    {
+        Status = CFE_SB_MAX_BUFFER_POOLS_MET;
+    }
+    else if (!CFE_SB_FillBufferPool(PoolPtr, MsgSize, NumBuffers))
+    {
+        Status = CFE_SB_BUF_ALOC_ERR;
+    }
+    else
+    {
+        PoolPtr->PoolId                = CFE_SB_BUFFERPOOLID_C(PendingId);
+        PoolPtr->AppId                 = AppId;
+        CFE_SB_Global.LastBufferPoolId = PendingId;
+        *PoolIdPtr                     = PoolPtr->PoolId;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_DeleteBufferPool(CFE_SB_BufferPoolId_t PoolId)
+{
+    CFE_SB_BufferPool_t *PoolPtr;
+    CFE_ES_AppId_t       AppId;
+    CFE_Status_t         Status;
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    PoolPtr = CFE_SB_LocateBufferPoolByID(PoolId);
+
+    /* Only the owner may delete a pool */
+    if (!CFE_SB_BufferPoolIsMatch(PoolPtr, PoolId) || !CFE_RESOURCEID_TEST_EQUAL(PoolPtr->AppId, AppId))
+    {
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        CFE_SB_ReleaseBufferPool(PoolPtr);
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_Buffer_t *CFE_SB_AllocatePoolMessageBuffer(CFE_SB_BufferPoolId_t PoolId)
+{
+    CFE_SB_BufferPool_t *PoolPtr;
+    CFE_SB_BufferD_t *   BufDscPtr;
+    CFE_SB_Buffer_t *    BufPtr;
+    CFE_ES_AppId_t       AppId;
+
+    BufPtr = NULL;
+
+    if (CFE_ES_GetAppID(&AppId) == CFE_SUCCESS)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        PoolPtr = CFE_SB_LocateBufferPoolByID(PoolId);
+
+        if (CFE_SB_BufferPoolIsMatch(PoolPtr, PoolId) && CFE_RESOURCEID_TEST_EQUAL(PoolPtr->AppId, AppId))
+        {
+            BufDscPtr = CFE_SB_GetBufferFromBufferPool(PoolPtr);
+
+            if (BufDscPtr != NULL)
+            {
+                /* Track the buffer as a zero-copy assigned to this app ID, same as any other */
+                BufDscPtr->AppId = AppId;
+                BufPtr           = &BufDscPtr->Content;
+                CFE_SB_TrackingListAdd(&CFE_SB_Global.ZeroCopyList, &BufDscPtr->Link);
+            }
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    return BufPtr;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -1572,3 +2596,101 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOriginat
 
     return CFE_SB_MessageTxn_GetStatus(Txn);
 }
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitMsgV(const CFE_SB_MsgFragment_t *FragArray, uint32 FragCount, bool IsOrigination)
+{
+    CFE_SB_TransmitTxn_State_t TxnBuf;
+    CFE_SB_MessageTxn_State_t *Txn;
+    CFE_SB_Buffer_t *          BufPtr;
+    uint8 *                    DestPtr;
+    size_t                     TotalSize;
+    CFE_Status_t               Status;
+    uint32                     i;
+
+    BufPtr    = NULL;
+    TotalSize = 0;
+    Txn       = CFE_SB_TransmitTxn_Init(&TxnBuf, FragArray);
+
+    /* The first fragment has to hold the header, the MsgId is read from there once the message is built */
+    if (CFE_SB_MessageTxn_IsOK(Txn) &&
+        (FragCount == 0 || FragArray[0].DataPtr == NULL || FragArray[0].DataSize < sizeof(CFE_MSG_Message_t)))
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_SEND_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
+
+    for (i = 0; CFE_SB_MessageTxn_IsOK(Txn) && i < FragCount; ++i)
+    {
+        if (FragArray[i].DataPtr == NULL && FragArray[i].DataSize != 0)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_SEND_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+        }
+        else if (FragArray[i].DataSize > (CFE_MISSION_SB_MAX_SB_MSG_SIZE - TotalSize))
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_MSG_TOO_BIG_EID, CFE_SB_MSG_TOO_BIG);
+        }
+        else
+        {
+            TotalSize += FragArray[i].DataSize;
+        }
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        /* Get buffer - as in CFE_SB_TransmitMsg, the use count of 1 refers to this task as it fills the buffer */
+        BufPtr = CFE_SB_AllocateMessageBuffer(TotalSize);
+        if (BufPtr == NULL)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_GET_BUF_ERR_EID, CFE_SB_BUF_ALOC_ERR);
+        }
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        /* Assemble the fragments directly in the buffer */
+        DestPtr = (uint8 *)&BufPtr->Msg;
+        for (i = 0; i < FragCount; ++i)
+        {
+            if (FragArray[i].DataSize != 0)
+            {
+                memcpy(DestPtr, FragArray[i].DataPtr, FragArray[i].DataSize);
+                DestPtr += FragArray[i].DataSize;
+            }
+        }
+
+        /* Only the complete message has a known size */
+        Status = CFE_MSG_SetSize(&BufPtr->Msg, TotalSize);
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(Txn, CFE_SB_SEND_BAD_ARG_EID, Status);
+        }
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        CFE_SB_TransmitTxn_SetupFromMsg(Txn, &BufPtr->Msg);
+    }
+
+    if (CFE_SB_MessageTxn_IsOK(Txn))
+    {
+        /* Save passed-in parameters, origination actions are done by the transmit on the complete message */
+        CFE_SB_MessageTxn_SetEndpoint(Txn, IsOrigination);
+
+        CFE_SB_TransmitTxn_Execute(Txn, BufPtr);
+    }
+    else if (BufPtr != NULL)
+    {
+        /* The message could not be sent, so the buffer is still owned by this task */
+        CFE_SB_ReleaseMessageBuffer(BufPtr);
+    }
+
+    /* send an event for each pipe write error that may have occurred */
+    CFE_SB_MessageTxn_ReportEvents(Txn);
+
+    return CFE_SB_MessageTxn_GetStatus(Txn);
+}
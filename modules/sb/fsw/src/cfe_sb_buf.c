@@ -32,6 +32,7 @@
 */
 
 #include "cfe_sb_module_all.h"
+#include "cfe_core_atomic.h"
 
 /*
  * The actual message content of a SB Buffer Descriptor is the
@@ -86,6 +87,79 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
     Node->Next->Prev = Node;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_GetBufFreeListIndex(size_t AllocSize)
+{
+    uint32 ListIdx;
+
+    if (CFE_PLATFORM_SB_BUF_CACHE_DEPTH == 0)
+    {
+        return CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    }
+
+    /* The block sizes are listed largest first, so search from the end for the first one that fits */
+    ListIdx = CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    while (ListIdx > 0 && CFE_SB_MemPoolDefSize[ListIdx - 1] < AllocSize)
+    {
+        --ListIdx;
+    }
+
+    if (ListIdx == 0)
+    {
+        /* Larger than any block size, the pool will not be able to provide it anyway */
+        return CFE_PLATFORM_ES_POOL_MAX_BUCKETS;
+    }
+
+    return ListIdx - 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RefillBufFreeList(uint32 ListIdx)
+{
+    CFE_SB_BufFreeList_t *FreeListPtr;
+    CFE_SB_BufferLink_t * Link;
+    CFE_ES_MemPoolBuf_t   addr;
+    uint32                NumBufs;
+    uint32                i;
+
+    FreeListPtr = &CFE_SB_Global.Mem.FreeList[ListIdx];
+
+    /* Do not take more than the list keeps, but always the one buffer being requested */
+    NumBufs = CFE_PLATFORM_SB_BUF_CACHE_REFILL;
+    if (NumBufs > FreeListPtr->MaxFree)
+    {
+        NumBufs = FreeListPtr->MaxFree;
+    }
+    if (NumBufs == 0)
+    {
+        NumBufs = 1;
+    }
+
+    for (i = 0; i < NumBufs; ++i)
+    {
+        addr = NULL;
+        if (CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, CFE_SB_MemPoolDefSize[ListIdx]) < 0)
+        {
+            break;
+        }
+
+        Link              = (CFE_SB_BufferLink_t *)addr;
+        Link->Next        = FreeListPtr->Head;
+        FreeListPtr->Head = Link;
+        ++FreeListPtr->NumFree;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -94,38 +168,60 @@ void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node
  *-----------------------------------------------------------------*/
 CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
 {
-    int32               stat1;
-    size_t              AllocSize;
-    CFE_ES_MemPoolBuf_t addr = NULL;
-    CFE_SB_BufferD_t *  bd;
+    int32                 stat1;
+    size_t                AllocSize;
+    uint32                ListIdx;
+    CFE_ES_MemPoolBuf_t   addr = NULL;
+    CFE_SB_BufferD_t *    bd;
+    CFE_SB_BufFreeList_t *FreeListPtr;
 
     /* The allocation needs to include enough space for the descriptor object */
     AllocSize = MaxMsgSize + CFE_SB_BUFFERD_CONTENT_OFFSET;
 
-    /* Allocate a new buffer descriptor from the SB memory pool.*/
-    stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
-    if (stat1 < 0)
+    ListIdx = CFE_SB_GetBufFreeListIndex(AllocSize);
+    if (ListIdx < CFE_PLATFORM_ES_POOL_MAX_BUCKETS)
     {
-        return NULL;
-    }
+        /*
+         * Take a buffer of the full block size from the free list.  If the
+         * pool cannot refill the list, there is no block of this size left.
+         */
+        FreeListPtr = &CFE_SB_Global.Mem.FreeList[ListIdx];
+        if (FreeListPtr->Head == NULL)
+        {
+            CFE_SB_RefillBufFreeList(ListIdx);
+            if (FreeListPtr->Head == NULL)
+            {
+                return NULL;
+            }
+        }
 
-    /* increment the number of buffers in use and adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse++;
-    if (CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse)
+        /* The link is the first member of the descriptor */
+        bd                = (CFE_SB_BufferD_t *)FreeListPtr->Head;
+        FreeListPtr->Head = FreeListPtr->Head->Next;
+        --FreeListPtr->NumFree;
+
+        AllocSize = CFE_SB_MemPoolDefSize[ListIdx];
+    }
+    else
     {
-        CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
+        /* Allocate a new buffer descriptor from the SB memory pool.*/
+        stat1 = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
+        if (stat1 < 0)
+        {
+            return NULL;
+        }
+
+        bd = (CFE_SB_BufferD_t *)addr;
     }
 
+    /* increment the number of buffers in use and adjust the high water mark if needed */
+    CFE_SB_AddCounterWithPeak(&CFE_SB_Global.Counters.SBBuffersInUse, &CFE_SB_Global.Counters.PeakSBBuffersInUse, 1);
+
     /* Add the size of the actual buffer to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += AllocSize;
-    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
-    {
-        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
-    }
+    CFE_SB_AddCounterWithPeak(&CFE_SB_Global.Counters.MemInUse, &CFE_SB_Global.Counters.PeakMemInUse, AllocSize);
 
     /* Initialize the buffer descriptor structure. */
-    bd = (CFE_SB_BufferD_t *)addr;
     memset(bd, 0, CFE_SB_BUFFERD_CONTENT_OFFSET);
 
     bd->UseCount      = 1;
@@ -144,14 +240,182 @@ CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize)
  *-----------------------------------------------------------------*/
 void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
 {
+    CFE_SB_BufFreeList_t *FreeListPtr;
+    CFE_SB_BufferPool_t * PoolPtr;
+    uint32                ListIdx;
+
     /* Remove from any tracking list (no effect if not in a list) */
     CFE_SB_TrackingListRemove(&bd->Link);
 
-    --CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse;
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= bd->AllocatedSize;
+    /* A buffer of a producer pool goes back to that pool, unless the pool has been deleted */
+    PoolPtr = bd->OwnerPool;
+    if (PoolPtr != NULL)
+    {
+        if (CFE_RESOURCEID_TEST_EQUAL(PoolPtr->PoolId, CFE_RESOURCEID_RESERVED))
+        {
+            bd->OwnerPool = NULL;
+            --PoolPtr->NumBuffers;
+            if (PoolPtr->NumBuffers == 0)
+            {
+                PoolPtr->PoolId = CFE_SB_INVALID_BUFFER_POOL;
+            }
+        }
+        else
+        {
+            bd->Link.Next     = PoolPtr->FreeHead;
+            PoolPtr->FreeHead = &bd->Link;
+            ++PoolPtr->NumFree;
+            return;
+        }
+    }
+
+    CFE_ATOMIC_SUB_FETCH(&CFE_SB_Global.Counters.SBBuffersInUse, 1);
+    CFE_ATOMIC_SUB_FETCH(&CFE_SB_Global.Counters.MemInUse, bd->AllocatedSize);
+
+    /* Keep buffers of a full block size for reuse, as long as the free list for that size has room */
+    ListIdx = CFE_SB_GetBufFreeListIndex(bd->AllocatedSize);
+    if (ListIdx < CFE_PLATFORM_ES_POOL_MAX_BUCKETS && CFE_SB_MemPoolDefSize[ListIdx] == bd->AllocatedSize &&
+        CFE_SB_Global.Mem.FreeList[ListIdx].NumFree < CFE_SB_Global.Mem.FreeList[ListIdx].MaxFree)
+    {
+        FreeListPtr       = &CFE_SB_Global.Mem.FreeList[ListIdx];
+        bd->Link.Next     = FreeListPtr->Head;
+        FreeListPtr->Head = &bd->Link;
+        ++FreeListPtr->NumFree;
+    }
+    else
+    {
+        /* finally give the buf descriptor back to the buf descriptor pool */
+        CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_FillBufferPool(CFE_SB_BufferPool_t *PoolPtr, size_t MsgSize, uint16 NumBuffers)
+{
+    CFE_SB_BufferD_t *bd;
+
+    while (PoolPtr->NumBuffers < NumBuffers)
+    {
+        bd = CFE_SB_GetBufferFromPool(MsgSize);
+        if (bd == NULL)
+        {
+            break;
+        }
+
+        /* Clear the content once, later users get the buffer as it was left */
+        memset(&bd->Content, 0, MsgSize);
+
+        bd->OwnerPool     = PoolPtr;
+        bd->Link.Next     = PoolPtr->FreeHead;
+        PoolPtr->FreeHead = &bd->Link;
+        ++PoolPtr->NumFree;
+        ++PoolPtr->NumBuffers;
+    }
+
+    if (PoolPtr->NumBuffers < NumBuffers)
+    {
+        /* Not enough memory, give back what was obtained */
+        while (PoolPtr->FreeHead != NULL)
+        {
+            bd                = (CFE_SB_BufferD_t *)PoolPtr->FreeHead;
+            PoolPtr->FreeHead = PoolPtr->FreeHead->Next;
+            bd->OwnerPool     = NULL;
+            CFE_SB_TrackingListReset(&bd->Link);
+            CFE_SB_ReturnBufferToPool(bd);
+        }
+
+        PoolPtr->NumFree    = 0;
+        PoolPtr->NumBuffers = 0;
+        return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferD_t *CFE_SB_GetBufferFromBufferPool(CFE_SB_BufferPool_t *PoolPtr)
+{
+    CFE_SB_BufferD_t *bd;
+    size_t            AllocSize;
+
+    if (PoolPtr->FreeHead == NULL)
+    {
+        return NULL;
+    }
 
-    /* finally give the buf descriptor back to the buf descriptor pool */
-    CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, bd);
+    /* The link is the first member of the descriptor */
+    bd                = (CFE_SB_BufferD_t *)PoolPtr->FreeHead;
+    PoolPtr->FreeHead = PoolPtr->FreeHead->Next;
+    --PoolPtr->NumFree;
+
+    /* Only the descriptor is reset, the content is kept */
+    AllocSize = bd->AllocatedSize;
+    memset(bd, 0, CFE_SB_BUFFERD_CONTENT_OFFSET);
+
+    bd->UseCount      = 1;
+    bd->AllocatedSize = AllocSize;
+    bd->OwnerPool     = PoolPtr;
+
+    CFE_SB_TrackingListReset(&bd->Link);
+
+    return bd;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReleaseBufferPool(CFE_SB_BufferPool_t *PoolPtr)
+{
+    CFE_SB_BufferD_t *bd;
+
+    /* From now on, buffers coming back are given to the SB memory pool */
+    PoolPtr->PoolId = CFE_SB_BUFFERPOOLID_C(CFE_RESOURCEID_RESERVED);
+    PoolPtr->AppId  = CFE_ES_APPID_UNDEFINED;
+
+    while (PoolPtr->FreeHead != NULL)
+    {
+        bd                = (CFE_SB_BufferD_t *)PoolPtr->FreeHead;
+        PoolPtr->FreeHead = PoolPtr->FreeHead->Next;
+        --PoolPtr->NumFree;
+        CFE_SB_TrackingListReset(&bd->Link);
+
+        /* If no buffer is in use, the last one returned here also frees the slot */
+        CFE_SB_ReturnBufferToPool(bd);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_AddCounterWithPeak(uint32 *CounterPtr, uint32 *PeakPtr, uint32 Amount)
+{
+    uint32 Value;
+    uint32 Peak;
+
+    Value = CFE_ATOMIC_ADD_FETCH(CounterPtr, Amount);
+
+    /* Raise the high water mark unless another task already raised it further */
+    Peak = CFE_ATOMIC_LOAD(PeakPtr);
+    while (Value > Peak && !CFE_ATOMIC_COMPARE_EXCHANGE(PeakPtr, &Peak, Value))
+    {
+        /* Peak was reloaded, try again */
+    }
 }
 
 /*----------------------------------------------------------------
@@ -162,10 +426,13 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd)
  *-----------------------------------------------------------------*/
 void CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd)
 {
+    uint16 UseCount;
+
     /* range check the UseCount variable */
-    if (bd->UseCount < 0x7FFF)
+    UseCount = CFE_ATOMIC_LOAD(&bd->UseCount);
+    while (UseCount < 0x7FFF && !CFE_ATOMIC_COMPARE_EXCHANGE(&bd->UseCount, &UseCount, (uint16)(UseCount + 1)))
     {
-        ++bd->UseCount;
+        /* UseCount was reloaded, try again */
     }
 }
 
@@ -175,17 +442,49 @@ void CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
+bool CFE_SB_DropBufUseCnt(CFE_SB_BufferD_t *bd)
 {
+    uint16 UseCount;
+
     /* range check the UseCount variable */
-    if (bd->UseCount > 0)
+    UseCount = CFE_ATOMIC_LOAD(&bd->UseCount);
+    while (UseCount > 0 && !CFE_ATOMIC_COMPARE_EXCHANGE(&bd->UseCount, &UseCount, (uint16)(UseCount - 1)))
     {
-        --bd->UseCount;
+        /* UseCount was reloaded, try again */
+    }
 
-        if (bd->UseCount == 0)
-        {
-            CFE_SB_ReturnBufferToPool(bd);
-        }
+    /* UseCount holds the value before the decrement, so this is true for the last reference only */
+    return (UseCount == 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd)
+{
+    if (CFE_SB_DropBufUseCnt(bd))
+    {
+        CFE_SB_ReturnBufferToPool(bd);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_DecrBufUseCntUnlocked(CFE_SB_BufferD_t *bd)
+{
+    /* No other task can find the buffer once the last reference is gone, only the pool needs the lock */
+    if (CFE_SB_DropBufUseCnt(bd))
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        CFE_SB_ReturnBufferToPool(bd);
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 }
 
@@ -209,11 +508,7 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void)
 
     /* Add the size of a destination descriptor to the memory-in-use ctr and */
     /* adjust the high water mark if needed */
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse += Stat;
-    if (CFE_SB_Global.StatTlmMsg.Payload.MemInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse)
-    {
-        CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
-    }
+    CFE_SB_AddCounterWithPeak(&CFE_SB_Global.Counters.MemInUse, &CFE_SB_Global.Counters.PeakMemInUse, Stat);
 
     return (CFE_SB_DestinationD_t *)addr;
 }
@@ -238,8 +533,93 @@ int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest)
     if (Stat > 0)
     {
         /* Subtract the size of the destination block from the Memory in use ctr */
-        CFE_SB_Global.StatTlmMsg.Payload.MemInUse -= Stat;
+        CFE_ATOMIC_SUB_FETCH(&CFE_SB_Global.Counters.MemInUse, Stat);
     }
 
     return CFE_SUCCESS;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_RouteSnapshot_t *CFE_SB_GetRouteSnapshotBlk(uint32 NumDests)
+{
+    int32               Stat;
+    CFE_ES_MemPoolBuf_t addr = NULL;
+    size_t              AllocSize;
+
+    /* Only allocate as many destination entries as are actually used */
+    AllocSize = offsetof(CFE_SB_RouteSnapshot_t, Dests) + (NumDests * sizeof(CFE_SB_RouteDest_t));
+
+    Stat = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
+    if (Stat < 0)
+    {
+        return NULL;
+    }
+
+    CFE_SB_AddCounterWithPeak(&CFE_SB_Global.Counters.MemInUse, &CFE_SB_Global.Counters.PeakMemInUse, Stat);
+
+    return (CFE_SB_RouteSnapshot_t *)addr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PutRouteSnapshotBlk(CFE_SB_RouteSnapshot_t *SnapshotPtr)
+{
+    int32 Stat;
+
+    Stat = CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, SnapshotPtr);
+    if (Stat > 0)
+    {
+        CFE_ATOMIC_SUB_FETCH(&CFE_SB_Global.Counters.MemInUse, Stat);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_PipeRing_t *CFE_SB_GetPipeRingBlk(uint32 NumSlots)
+{
+    int32               Stat;
+    CFE_ES_MemPoolBuf_t addr = NULL;
+    size_t              AllocSize;
+
+    AllocSize = offsetof(CFE_SB_PipeRing_t, Slots) + (NumSlots * sizeof(CFE_SB_PipeRingSlot_t));
+
+    Stat = CFE_ES_GetPoolBuf(&addr, CFE_SB_Global.Mem.PoolHdl, AllocSize);
+    if (Stat < 0)
+    {
+        return NULL;
+    }
+
+    CFE_SB_AddCounterWithPeak(&CFE_SB_Global.Counters.MemInUse, &CFE_SB_Global.Counters.PeakMemInUse, Stat);
+
+    return (CFE_SB_PipeRing_t *)addr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PutPipeRingBlk(CFE_SB_PipeRing_t *RingPtr)
+{
+    int32 Stat;
+
+    Stat = CFE_ES_PutPoolBuf(CFE_SB_Global.Mem.PoolHdl, RingPtr);
+    if (Stat > 0)
+    {
+        CFE_ATOMIC_SUB_FETCH(&CFE_SB_Global.Counters.MemInUse, Stat);
+    }
+}
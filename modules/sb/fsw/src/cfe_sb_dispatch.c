@@ -182,6 +182,20 @@ void CFE_SB_ProcessCmdPipePkt(const CFE_SB_Buffer_t *SBBufPtr)
                     }
                     break;
 
+                case CFE_SB_WRITE_PIPE_LATENCY_CC:
+                    if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_WritePipeLatencyCmd_t)))
+                    {
+                        CFE_SB_WritePipeLatencyCmd((const CFE_SB_WritePipeLatencyCmd_t *)SBBufPtr);
+                    }
+                    break;
+
+                case CFE_SB_RESET_PIPE_LATENCY_CC:
+                    if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_ResetPipeLatencyCmd_t)))
+                    {
+                        CFE_SB_ResetPipeLatencyCmd((const CFE_SB_ResetPipeLatencyCmd_t *)SBBufPtr);
+                    }
+                    break;
+
                 default:
                     CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID, CFE_EVS_EventType_ERROR,
                                       "Invalid Cmd, Unexpected Command Code %u", FcnCode);
@@ -99,7 +99,8 @@ int32 CFE_SB_EarlyInit(void)
  *-----------------------------------------------------------------*/
 int32 CFE_SB_InitBuffers(void)
 {
-    int32 Stat = 0;
+    int32  Stat = 0;
+    uint32 ListIdx;
 
     Stat = CFE_ES_PoolCreateEx(&CFE_SB_Global.Mem.PoolHdl, CFE_SB_Global.Mem.Partition.Data,
                                CFE_PLATFORM_SB_BUF_MEMORY_BYTES, CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
@@ -119,6 +120,19 @@ int32 CFE_SB_InitBuffers(void)
     CFE_SB_TrackingListReset(&CFE_SB_Global.InTransitList);
     CFE_SB_TrackingListReset(&CFE_SB_Global.ZeroCopyList);
 
+    /* All buffers come from the new pool, so the free lists start out empty */
+    memset(CFE_SB_Global.Mem.FreeList, 0, sizeof(CFE_SB_Global.Mem.FreeList));
+
+    /* Large block sizes keep fewer buffers, so the lists do not tie up much of the pool */
+    for (ListIdx = 0; ListIdx < CFE_PLATFORM_ES_POOL_MAX_BUCKETS; ++ListIdx)
+    {
+        CFE_SB_Global.Mem.FreeList[ListIdx].MaxFree = CFE_PLATFORM_SB_BUF_CACHE_BYTES / CFE_SB_MemPoolDefSize[ListIdx];
+        if (CFE_SB_Global.Mem.FreeList[ListIdx].MaxFree > CFE_PLATFORM_SB_BUF_CACHE_DEPTH)
+        {
+            CFE_SB_Global.Mem.FreeList[ListIdx].MaxFree = CFE_PLATFORM_SB_BUF_CACHE_DEPTH;
+        }
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -130,5 +144,6 @@ int32 CFE_SB_InitBuffers(void)
  *-----------------------------------------------------------------*/
 void CFE_SB_InitPipeTbl(void)
 {
-    CFE_SB_Global.LastPipeId = CFE_ResourceId_FromInteger(CFE_SB_PIPEID_BASE);
+    CFE_SB_Global.LastPipeId       = CFE_ResourceId_FromInteger(CFE_SB_PIPEID_BASE);
+    CFE_SB_Global.LastBufferPoolId = CFE_ResourceId_FromInteger(CFE_SB_BUFFERPOOLID_BASE);
 }
@@ -0,0 +1,198 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/******************************************************************************
+** File: cfe_sb_pipeset.c
+**
+** Purpose:
+**      This file contains the waiters used by CFE_SB_ReceiveBufferFromSet to
+**      block on several pipes at once.
+**
+**      An OSAL queue can only be waited on by itself, so a task waiting on a
+**      set of pipes instead waits on the binary semaphore of a waiter entry.
+**      While it waits, every pipe of the set refers to the entry, and each
+**      write to one of those pipes gives the semaphore if the task is parked.
+**      The entries and their semaphores are kept for reuse by later waits.
+**
+******************************************************************************/
+
+/*
+**  Include Files
+*/
+
+#include "cfe_sb_module_all.h"
+#include "cfe_core_atomic.h"
+
+#include <stdio.h>
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_PipeSet_Attach(const CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetWaiter_t **WaiterPtrP)
+{
+    CFE_SB_PipeSetWaiter_t *WaiterPtr;
+    CFE_SB_PipeD_t *        PipeDscPtr;
+    CFE_Status_t            Status;
+    int32                   OsStatus;
+    char                    SemName[OS_MAX_API_NAME];
+    uint32                  WaiterNum;
+    uint32                  i;
+
+    *WaiterPtrP = NULL;
+    WaiterPtr   = NULL;
+    Status      = CFE_SB_PIPE_SET_BUSY;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    for (WaiterNum = 0; WaiterNum < CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS; ++WaiterNum)
+    {
+        if (!CFE_SB_Global.PipeSetWaiters[WaiterNum].InUse)
+        {
+            WaiterPtr = &CFE_SB_Global.PipeSetWaiters[WaiterNum];
+            break;
+        }
+    }
+
+    if (WaiterPtr != NULL && !OS_ObjectIdDefined(WaiterPtr->WakeupSemId))
+    {
+        snprintf(SemName, sizeof(SemName), "SBSetWait%u", (unsigned int)WaiterNum);
+        OsStatus = OS_BinSemCreate(&WaiterPtr->WakeupSemId, SemName, 0, 0);
+        if (OsStatus != OS_SUCCESS)
+        {
+            WaiterPtr->WakeupSemId = OS_OBJECT_ID_UNDEFINED;
+            WaiterPtr              = NULL;
+            Status                 = CFE_SB_PIPE_RD_ERR;
+        }
+    }
+
+    /* Each pipe can only wake one waiter */
+    for (i = 0; WaiterPtr != NULL && i < TxnPtr->NumPipes; ++i)
+    {
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(TxnPtr->PipeSet[i].PipeId);
+        if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, TxnPtr->PipeSet[i].PipeId) || PipeDscPtr->SetWaiter != 0)
+        {
+            WaiterPtr = NULL;
+        }
+    }
+
+    if (WaiterPtr != NULL)
+    {
+        WaiterPtr->InUse = true;
+        CFE_ATOMIC_STORE(&WaiterPtr->Parked, 0);
+
+        for (i = 0; i < TxnPtr->NumPipes; ++i)
+        {
+            PipeDscPtr = CFE_SB_LocatePipeDescByID(TxnPtr->PipeSet[i].PipeId);
+            CFE_ATOMIC_STORE(&PipeDscPtr->SetWaiter, WaiterNum + 1);
+        }
+
+        *WaiterPtrP = WaiterPtr;
+        Status      = CFE_SUCCESS;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeSet_Detach(const CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetWaiter_t *WaiterPtr)
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+    uint32          WaiterRef;
+    uint32          Expected;
+    uint32          i;
+
+    WaiterRef = (uint32)(WaiterPtr - CFE_SB_Global.PipeSetWaiters) + 1;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    for (i = 0; i < TxnPtr->NumPipes; ++i)
+    {
+        /* A pipe that was deleted while waiting may already have been cleared or reused */
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(TxnPtr->PipeSet[i].PipeId);
+        if (PipeDscPtr != NULL)
+        {
+            Expected = WaiterRef;
+            CFE_ATOMIC_COMPARE_EXCHANGE(&PipeDscPtr->SetWaiter, &Expected, 0);
+        }
+    }
+
+    WaiterPtr->InUse = false;
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeSet_Wake(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    CFE_SB_PipeSetWaiter_t *WaiterPtr;
+    uint32                  WaiterRef;
+
+    if (PipeDscPtr != NULL)
+    {
+        WaiterRef = CFE_ATOMIC_LOAD(&PipeDscPtr->SetWaiter);
+        if (WaiterRef != 0 && WaiterRef <= CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS)
+        {
+            WaiterPtr = &CFE_SB_Global.PipeSetWaiters[WaiterRef - 1];
+
+            /* Only bother the OS if the waiter actually went to sleep */
+            if (CFE_ATOMIC_LOAD(&WaiterPtr->Parked) != 0 && CFE_ATOMIC_EXCHANGE(&WaiterPtr->Parked, 0) != 0)
+            {
+                OS_BinSemGive(WaiterPtr->WakeupSemId);
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_PipeSet_Wait(CFE_SB_PipeSetWaiter_t *WaiterPtr, int32 OsTimeout)
+{
+    int32 OsStatus;
+
+    if (OsTimeout == OS_PEND)
+    {
+        OsStatus = OS_BinSemTake(WaiterPtr->WakeupSemId);
+    }
+    else
+    {
+        OsStatus = OS_BinSemTimedWait(WaiterPtr->WakeupSemId, OsTimeout);
+    }
+
+    CFE_ATOMIC_STORE(&WaiterPtr->Parked, 0);
+
+    return OsStatus;
+}
@@ -75,6 +75,7 @@
 */
 
 #include "cfe_sb_module_all.h"
+#include "cfe_core_atomic.h"
 
 #include <string.h>
 
@@ -117,6 +118,20 @@ int32 CFE_SB_CleanUpApp(CFE_ES_AppId_t AppId)
     /* Release any zero copy buffers */
     CFE_SB_ZeroCopyReleaseAppId(AppId);
 
+    /* Delete any producer buffer pools, buffers still in transit are freed once delivered */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_BUFFER_POOLS; ++i)
+    {
+        if (CFE_SB_BufferPoolIsUsed(&CFE_SB_Global.BufferPools[i]) &&
+            CFE_RESOURCEID_TEST_EQUAL(CFE_SB_Global.BufferPools[i].AppId, AppId))
+        {
+            CFE_SB_ReleaseBufferPool(&CFE_SB_Global.BufferPools[i]);
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
     return CFE_SUCCESS;
 }
 
@@ -246,6 +261,45 @@ bool CFE_SB_CheckPipeDescSlotUsed(CFE_ResourceId_t CheckId)
     return (PipeDscPtr == NULL || CFE_SB_PipeDescIsUsed(PipeDscPtr));
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferPool_t *CFE_SB_LocateBufferPoolByID(CFE_SB_BufferPoolId_t PoolId)
+{
+    CFE_SB_BufferPool_t *PoolPtr;
+    uint32               Idx;
+
+    if (CFE_ResourceId_ToIndex(CFE_RESOURCEID_UNWRAP(PoolId), CFE_SB_BUFFERPOOLID_BASE,
+                               CFE_PLATFORM_SB_MAX_BUFFER_POOLS, &Idx) == CFE_SUCCESS)
+    {
+        PoolPtr = &CFE_SB_Global.BufferPools[Idx];
+    }
+    else
+    {
+        PoolPtr = NULL;
+    }
+
+    return PoolPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_CheckBufferPoolSlotUsed(CFE_ResourceId_t CheckId)
+{
+    CFE_SB_BufferPool_t *PoolPtr;
+
+    /* As with pipes, a NULL pointer should never happen but is treated as used */
+    PoolPtr = CFE_SB_LocateBufferPoolByID(CFE_SB_BUFFERPOOLID_C(CheckId));
+    return (PoolPtr == NULL || CFE_SB_BufferPoolIsUsed(PoolPtr));
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -376,6 +430,8 @@ int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNo
     /* Update Head */
     CFE_SBR_SetDestListHeadPtr(RouteId, NewNode);
 
+    CFE_SB_PublishRouteSnapshot(RouteId);
+
     return CFE_SUCCESS;
 }
 
@@ -388,8 +444,14 @@ int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNo
 void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr)
 {
     CFE_SB_RemoveDestNode(RouteId, DestPtr);
-    CFE_SB_PutDestinationBlk(DestPtr);
+
+    /* A transmitter may still be reading this destination, so it cannot go back to the pool yet */
+    CFE_SB_RetireDest(DestPtr);
     CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse--;
+
+    CFE_SB_RemoveRouteIfUnused(RouteId);
+
+    CFE_SB_ReleaseRetiredRouteData();
 }
 
 /*----------------------------------------------------------------
@@ -398,41 +460,84 @@ void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NodeToRemove)
+void CFE_SB_RemoveRouteIfUnused(CFE_SBR_RouteId_t RouteId)
 {
-    CFE_SB_DestinationD_t *PrevNode;
-    CFE_SB_DestinationD_t *NextNode;
-
-    if ((NodeToRemove->Prev == NULL) && (NodeToRemove->Next == NULL))
-    {
-        /* Clear destinations if this is the only node in the list */
-        CFE_SBR_SetDestListHeadPtr(RouteId, NULL);
-    }
-    else if (NodeToRemove->Prev == NULL)
+    if (CFE_SBR_GetDestListHeadPtr(RouteId) == NULL)
     {
-        /* First in the list, set the next node to list head */
-        NextNode       = NodeToRemove->Next;
-        NextNode->Prev = NULL;
-        CFE_SBR_SetDestListHeadPtr(RouteId, NextNode);
+        CFE_SBR_RemoveRoute(RouteId);
+        CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse--;
     }
-    else if (NodeToRemove->Next == NULL)
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SBR_RouteId_t CFE_SB_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
+{
+    CFE_SBR_RouteId_t RouteId;
+
+    /* Routes removed earlier can be reused, unless a transmitter may still have them */
+    CFE_SB_ReleaseRetiredRouteData();
+
+    RouteId = CFE_SBR_AddRoute(MsgId, CollisionsPtr);
+
+    if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        /* Last in the list, remove previous pointer */
-        PrevNode       = NodeToRemove->Prev;
-        PrevNode->Next = NULL;
+        /* Increment the MsgIds in use ctr and if it's > the high water mark,*/
+        /* adjust the high water mark */
+        CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse++;
+        if (CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse > CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse)
+        {
+            CFE_SB_Global.StatTlmMsg.Payload.PeakMsgIdsInUse = CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse;
+        }
     }
-    else
+
+    return RouteId;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_DestinationD_t *CFE_SB_AddDest(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId, uint16 MsgLim, uint8 Scope)
+{
+    CFE_SB_DestinationD_t *DestPtr;
+
+    DestPtr = CFE_SB_GetDestinationBlk();
+    if (DestPtr != NULL)
     {
-        /* Middle of list, remove */
-        PrevNode       = NodeToRemove->Prev;
-        NextNode       = NodeToRemove->Next;
-        PrevNode->Next = NextNode;
-        NextNode->Prev = PrevNode;
+        /* initialize destination block */
+        DestPtr->PipeId        = PipeId;
+        DestPtr->MsgId2PipeLim = MsgLim;
+        DestPtr->Active        = CFE_SB_ACTIVE;
+        DestPtr->BuffCount     = 0;
+        DestPtr->DestCnt       = 0;
+        DestPtr->Scope         = Scope;
+        DestPtr->IsMaskDest    = false;
+        DestPtr->IsUrgent      = false;
+        DestPtr->Decimation    = 0;
+        DestPtr->MinInterval   = 0;
+        DestPtr->Prev          = NULL;
+        DestPtr->Next          = NULL;
+
+        /* add destination node */
+        CFE_SB_AddDestNode(RouteId, DestPtr);
+
+        CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse++;
+        if (CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse >
+            CFE_SB_Global.StatTlmMsg.Payload.PeakSubscriptionsInUse)
+        {
+            CFE_SB_Global.StatTlmMsg.Payload.PeakSubscriptionsInUse =
+                CFE_SB_Global.StatTlmMsg.Payload.SubscriptionsInUse;
+        }
     }
 
-    /* initialize the node before returning it to the heap */
-    NodeToRemove->Next = NULL;
-    NodeToRemove->Prev = NULL;
+    return DestPtr;
 }
 
 /*----------------------------------------------------------------
@@ -441,44 +546,54 @@ void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *Nod
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
+void CFE_SB_AddMaskDests(CFE_SBR_RouteId_t RouteId)
 {
-    CFE_SB_BufferLink_t *NextLink;
-    CFE_SB_BufferD_t *   DscPtr;
+    CFE_SB_MaskSub_t *     MaskSubPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_MsgId_t         MsgId;
+    uint32                 DestCount;
+    uint32                 i;
+    bool                   IsFull;
 
-    /*
-     * First go through the "ZeroCopy" tracking list and find all nodes
-     * with a matching AppID.  This needs to be done while locked to
-     * prevent other tasks from changing the list at the same time.
-     */
-    if (CFE_RESOURCEID_TEST_DEFINED(AppId))
+    /* Most routes are added with no mask subscription in use */
+    if (CFE_SB_Global.NumMaskSubs != 0)
     {
-        CFE_SB_LockSharedData(__func__, __LINE__);
+        MsgId = CFE_SBR_GetMsgId(RouteId);
 
-        /* Get start of list */
-        NextLink = CFE_SB_TrackingListGetNext(&CFE_SB_Global.ZeroCopyList);
-        while (!CFE_SB_TrackingListIsEnd(&CFE_SB_Global.ZeroCopyList, NextLink))
+        DestCount = 0;
+        for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId); DestPtr != NULL; DestPtr = DestPtr->Next)
         {
-            /* Get buffer descriptor pointer */
-            /* NOTE: casting via void* here rather than CFE_SB_BufferD_t* avoids a false
-             * alignment warning on platforms with strict alignment requirements */
-            DscPtr = (void *)NextLink;
+            ++DestCount;
+        }
 
-            /* Read the next link now in case this node gets moved */
-            NextLink = CFE_SB_TrackingListGetNext(NextLink);
+        IsFull = false;
+        for (i = 0; i < CFE_PLATFORM_SB_MAX_MASK_SUBS && !IsFull; ++i)
+        {
+            MaskSubPtr = &CFE_SB_Global.MaskSubs[i];
 
-            /* Check if it is a zero-copy buffer owned by this app */
-            if (CFE_RESOURCEID_TEST_EQUAL(DscPtr->AppId, AppId))
+            if (CFE_RESOURCEID_TEST_DEFINED(MaskSubPtr->PipeId) && CFE_SB_MaskSubIsMatch(MaskSubPtr, MsgId) &&
+                CFE_SB_GetDestPtr(RouteId, MaskSubPtr->PipeId) == NULL)
             {
-                /* If so, decrement the use count as the app has now gone away */
-                CFE_SB_DecrBufUseCnt(DscPtr);
+                DestPtr = NULL;
+                if (DestCount < CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+                {
+                    DestPtr = CFE_SB_AddDest(RouteId, MaskSubPtr->PipeId, MaskSubPtr->MsgLim, CFE_SB_MSG_LOCAL);
+                }
+
+                if (DestPtr == NULL)
+                {
+                    /* Skip the remaining mask subscriptions rather than report each one */
+                    CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter++;
+                    IsFull = true;
+                }
+                else
+                {
+                    DestPtr->IsMaskDest = true;
+                    ++DestCount;
+                }
             }
         }
-
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
-
-    return CFE_SUCCESS;
 }
 
 /*----------------------------------------------------------------
@@ -487,34 +602,49 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr)
+int32 CFE_SB_AddMaskRoutes(const CFE_SB_MaskSub_t *MaskSubPtr)
 {
-    cpuaddr BufDscAddr;
+    CFE_SBR_RouteId_t   RouteId;
+    CFE_SB_MsgId_t      MsgId;
+    CFE_SB_MsgId_Atom_t Value;
+    int32               Status;
 
-    /*
-     * Calculate descriptor pointer from buffer pointer -
-     * The buffer is just a member (offset) in the descriptor
-     */
-    BufDscAddr = (cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content);
-    *BufDscPtr = (CFE_SB_BufferD_t *)BufDscAddr;
+    Status = CFE_SUCCESS;
 
     /*
-     * Check that the descriptor is actually a "zero copy" type,
+     * Visit only the matching values, in increasing order: the bits outside of the
+     * mask count up as one number, and the walk ends when they wrap around to zero
+     * or the value passes the highest valid message ID.
      */
-    if (!CFE_RESOURCEID_TEST_DEFINED((*BufDscPtr)->AppId))
+    Value = MaskSubPtr->MsgIdValue;
+    do
     {
-        return CFE_SB_BUFFER_INVALID;
-    }
+        MsgId = CFE_SB_ValueToMsgId(Value);
 
-    /* Basic sanity check passed */
-    return CFE_SUCCESS;
-}
+        if (CFE_SB_IsValidMsgId(MsgId) && !CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId)))
+        {
+            RouteId = CFE_SB_AddRoute(MsgId, NULL);
+            if (!CFE_SBR_IsValidRouteId(RouteId))
+            {
+                Status = CFE_SB_MAX_MSGS_MET;
+                break;
+            }
 
-/******************************************************************
- *
- * MESSAGE TRANSACTION IMPLEMENTATION FUNCTIONS
- *
- ******************************************************************/
+            CFE_SB_AddMaskDests(RouteId);
+
+            /* Do not keep the route if no destination could be added */
+            CFE_SB_RemoveRouteIfUnused(RouteId);
+        }
+
+        Value = ((Value | MaskSubPtr->Mask) + 1) & ~MaskSubPtr->Mask;
+        if (Value != 0)
+        {
+            Value |= MaskSubPtr->MsgIdValue;
+        }
+    } while (Value != 0 && Value <= CFE_PLATFORM_SB_HIGHEST_VALID_MSGID);
+
+    return Status;
+}
 
 /*----------------------------------------------------------------
  *
@@ -522,93 +652,650 @@ int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_Init(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *PipeSet, uint16 MaxPipes,
-                            const void *RefMemPtr)
+void CFE_SB_RemoveMaskSubs(CFE_SB_PipeId_t PipeId)
 {
-    memset(TxnPtr, 0, offsetof(CFE_SB_TransmitTxn_State_t, DestSet));
-    TxnPtr->PipeSet  = PipeSet;
-    TxnPtr->MaxPipes = MaxPipes;
+    uint32 i;
 
-    /* The reference pointer is kept just for (potential) reporting in events, etc.
-     * It is not dereferenced from here. */
-    TxnPtr->RefMemPtr = RefMemPtr;
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_MASK_SUBS; ++i)
+    {
+        if (CFE_RESOURCEID_TEST_EQUAL(CFE_SB_Global.MaskSubs[i].PipeId, PipeId))
+        {
+            CFE_SB_Global.MaskSubs[i].PipeId = CFE_SB_INVALID_PIPE;
+            CFE_SB_Global.NumMaskSubs--;
+        }
+    }
 }
 
 /*----------------------------------------------------------------
  *
- * Local Helper function
- * Not invoked outside of this unit
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_SetTimeout(CFE_SB_MessageTxn_State_t *TxnPtr, int32 Timeout)
+void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NodeToRemove)
 {
-    TxnPtr->UserTimeoutParam = Timeout;
-    if (Timeout > 0)
+    CFE_SB_DestinationD_t *PrevNode;
+    CFE_SB_DestinationD_t *NextNode;
+
+    if ((NodeToRemove->Prev == NULL) && (NodeToRemove->Next == NULL))
     {
-        /* Convert to an absolute timeout */
-        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_TIMED;
-        CFE_PSP_GetTime(&TxnPtr->AbsTimeout);
-        TxnPtr->AbsTimeout = OS_TimeAdd(TxnPtr->AbsTimeout, OS_TimeFromTotalMilliseconds(Timeout));
+        /* Clear destinations if this is the only node in the list */
+        CFE_SBR_SetDestListHeadPtr(RouteId, NULL);
     }
-    else if (Timeout == CFE_SB_POLL)
+    else if (NodeToRemove->Prev == NULL)
     {
-        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_POLL;
+        /* First in the list, set the next node to list head */
+        NextNode       = NodeToRemove->Next;
+        NextNode->Prev = NULL;
+        CFE_SBR_SetDestListHeadPtr(RouteId, NextNode);
     }
-    else if (Timeout == CFE_SB_PEND_FOREVER)
+    else if (NodeToRemove->Next == NULL)
     {
-        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_PEND;
+        /* Last in the list, remove previous pointer */
+        PrevNode       = NodeToRemove->Prev;
+        PrevNode->Next = NULL;
     }
     else
     {
-        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+        /* Middle of list, remove */
+        PrevNode       = NodeToRemove->Prev;
+        NextNode       = NodeToRemove->Next;
+        PrevNode->Next = NextNode;
+        NextNode->Prev = PrevNode;
     }
+
+    /* initialize the node before returning it to the heap */
+    NodeToRemove->Next = NULL;
+    NodeToRemove->Prev = NULL;
+
+    CFE_SB_PublishRouteSnapshot(RouteId);
 }
 
 /*----------------------------------------------------------------
  *
- * Local Helper function
- * Not invoked outside of this unit
+ * Application-scope internal function
+ * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_GetEventDetails(const CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_SB_PipeSetEntry_t *ContextPtr,
-                                       uint16 EventId, CFE_ES_TaskId_t TskId, char *EvtMsg, size_t EvtMsgSize,
-                                       CFE_EVS_EventType_Enum_t *EventType, int32 *ReqBit)
+void CFE_SB_PublishRouteSnapshot(CFE_SBR_RouteId_t RouteId)
 {
-    char  FullName[(OS_MAX_API_NAME * 2)];
-    char  PipeName[OS_MAX_API_NAME];
-    int32 LocalOsStatus;
+    CFE_SB_RouteSnapshot_t *NewSnapshotPtr;
+    CFE_SB_RouteSnapshot_t *OldSnapshotPtr;
+    CFE_SB_DestinationD_t * DestPtr;
+    uint32                  NumDests;
+    uint32                  Slot;
+
+    /* Count the destinations, the bound guards against a corrupted list */
+    NumDests = 0;
+    DestPtr  = CFE_SBR_GetDestListHeadPtr(RouteId);
+    while (DestPtr != NULL && NumDests < CFE_PLATFORM_SB_MAX_DEST_PER_PKT)
+    {
+        ++NumDests;
+        DestPtr = DestPtr->Next;
+    }
 
-    if (ContextPtr == NULL)
+    if (NumDests == 0)
     {
-        LocalOsStatus = INT32_MIN; /* should not be used; do not alias any actual OS status */
+        NewSnapshotPtr = NULL;
     }
     else
     {
-        LocalOsStatus = ContextPtr->OsStatus;
-        if (ContextPtr->PendingEventId == CFE_SB_BAD_PIPEID_EID)
+        NewSnapshotPtr = CFE_SB_GetRouteSnapshotBlk(NumDests);
+        if (NewSnapshotPtr == NULL)
         {
-            /* do not attempt to map to a pipe name if reporting a bad pipeID event - use its ID */
-            snprintf(PipeName, sizeof(PipeName), "%lu", CFE_RESOURCEID_TO_ULONG(ContextPtr->PipeId));
+            /* Transmitters will have to read the list itself, under the lock */
+            NewSnapshotPtr = &CFE_SB_Global.LockedRouteSnapshot;
         }
         else
         {
-            CFE_SB_GetPipeName(PipeName, sizeof(PipeName), ContextPtr->PipeId);
+            NewSnapshotPtr->RetireNext    = NULL;
+            NewSnapshotPtr->NumDests      = NumDests;
+            NewSnapshotPtr->HasIgnoreMine = false;
+
+            NumDests = 0;
+            DestPtr  = CFE_SBR_GetDestListHeadPtr(RouteId);
+            while (NumDests < NewSnapshotPtr->NumDests)
+            {
+                CFE_SB_FillRouteDest(&NewSnapshotPtr->Dests[NumDests], DestPtr);
+                if (NewSnapshotPtr->Dests[NumDests].IgnoreMine)
+                {
+                    NewSnapshotPtr->HasIgnoreMine = true;
+                }
+                ++NumDests;
+                DestPtr = DestPtr->Next;
+            }
         }
     }
 
-    switch (EventId)
-    {
-        case CFE_SB_SEND_BAD_ARG_EID:
-            *ReqBit    = CFE_SB_SEND_BAD_ARG_EID_BIT;
-            *EventType = CFE_EVS_EventType_ERROR;
+    OldSnapshotPtr =
+        CFE_ATOMIC_EXCHANGE(&CFE_SB_Global.RouteSnapshot[CFE_SBR_RouteIdToValue(RouteId)], NewSnapshotPtr);
 
-            snprintf(EvtMsg, EvtMsgSize, "Send Err:Bad input argument,Arg 0x%lx,App %s",
-                     (unsigned long)TxnPtr->RefMemPtr, CFE_SB_GetAppTskName(TskId, FullName));
-            break;
+    if (OldSnapshotPtr != NULL && OldSnapshotPtr != &CFE_SB_Global.LockedRouteSnapshot)
+    {
+        Slot                                 = CFE_SB_Global.RouteEpoch & 1;
+        OldSnapshotPtr->RetireNext           = CFE_SB_Global.RetiredSnapshots[Slot];
+        CFE_SB_Global.RetiredSnapshots[Slot] = OldSnapshotPtr;
+    }
 
-        case CFE_SB_SEND_INV_MSGID_EID:
-            *ReqBit    = CFE_SB_SEND_INV_MSGID_EID_BIT;
-            *EventType = CFE_EVS_EventType_ERROR;
+    CFE_SB_ReleaseRetiredRouteData();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_FillRouteDest(CFE_SB_RouteDest_t *RouteDestPtr, CFE_SB_DestinationD_t *DestPtr)
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+
+    memset(RouteDestPtr, 0, sizeof(*RouteDestPtr));
+
+    /* The pipe table does not move, so the entry can be kept for as long as the pipe ID matches */
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
+
+    RouteDestPtr->PipeDscPtr = PipeDscPtr;
+    RouteDestPtr->DestPtr    = DestPtr;
+    RouteDestPtr->PipeId     = DestPtr->PipeId;
+
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
+    {
+        RouteDestPtr->SysQueueId = PipeDscPtr->SysQueueId;
+        RouteDestPtr->UseRing    = ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_RING) != 0);
+        RouteDestPtr->IgnoreMine = ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE) != 0);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RetireDest(CFE_SB_DestinationD_t *DestPtr)
+{
+    uint32 Slot = CFE_SB_Global.RouteEpoch & 1;
+
+    /* The node is no longer in any route list, so its link can be reused here */
+    DestPtr->Next                    = CFE_SB_Global.RetiredDests[Slot];
+    CFE_SB_Global.RetiredDests[Slot] = DestPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReleaseRetiredRouteData(void)
+{
+    CFE_SB_RouteSnapshot_t *SnapshotPtr;
+    CFE_SB_DestinationD_t * DestPtr;
+    uint32                  Epoch;
+    uint32                  Slot;
+    uint32                  Pass;
+
+    /*
+     * Transmitters only register in the slot of the current epoch, so the count of
+     * the previous epoch drains even while new transmitters keep starting.  Once it
+     * is zero, nothing retired in the previous epoch can still be in use: it was
+     * unpublished or unmapped before the current epoch began.  The emptied slot is
+     * then used for the next epoch.  A second pass also releases the current epoch
+     * when no transmitter is reading at all.
+     */
+    for (Pass = 0; Pass < 2; ++Pass)
+    {
+        Epoch = CFE_SB_Global.RouteEpoch;
+        Slot  = (Epoch - 1) & 1;
+
+        if (CFE_ATOMIC_LOAD(&CFE_SB_Global.RouteReaderCount[Slot]) != 0)
+        {
+            break;
+        }
+
+        while (CFE_SB_Global.RetiredSnapshots[Slot] != NULL)
+        {
+            SnapshotPtr                          = CFE_SB_Global.RetiredSnapshots[Slot];
+            CFE_SB_Global.RetiredSnapshots[Slot] = SnapshotPtr->RetireNext;
+            CFE_SB_PutRouteSnapshotBlk(SnapshotPtr);
+        }
+
+        while (CFE_SB_Global.RetiredDests[Slot] != NULL)
+        {
+            DestPtr                          = CFE_SB_Global.RetiredDests[Slot];
+            CFE_SB_Global.RetiredDests[Slot] = DestPtr->Next;
+            DestPtr->Next                    = NULL;
+            CFE_SB_PutDestinationBlk(DestPtr);
+        }
+
+        CFE_SBR_ReleaseRemovedRoutes();
+
+        CFE_ATOMIC_STORE(&CFE_SB_Global.RouteEpoch, Epoch + 1);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+const CFE_SB_RouteSnapshot_t *CFE_SB_GetRouteSnapshot(CFE_SBR_RouteId_t RouteId)
+{
+    return CFE_ATOMIC_LOAD(&CFE_SB_Global.RouteSnapshot[CFE_SBR_RouteIdToValue(RouteId)]);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_RouteReadBegin(void)
+{
+    uint32 Epoch;
+    uint32 CurrentEpoch;
+
+    /*
+     * If the epoch advanced before the count was taken, the slot may already have
+     * been found empty, so take the count again in the slot of the new epoch.
+     */
+    do
+    {
+        Epoch = CFE_ATOMIC_LOAD(&CFE_SB_Global.RouteEpoch);
+        CFE_ATOMIC_ADD_FETCH(&CFE_SB_Global.RouteReaderCount[Epoch & 1], 1);
+
+        CurrentEpoch = CFE_ATOMIC_LOAD(&CFE_SB_Global.RouteEpoch);
+        if (CurrentEpoch != Epoch)
+        {
+            CFE_ATOMIC_SUB_FETCH(&CFE_SB_Global.RouteReaderCount[Epoch & 1], 1);
+        }
+    } while (CurrentEpoch != Epoch);
+
+    return Epoch;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RouteReadEnd(uint32 RouteEpoch)
+{
+    CFE_ATOMIC_SUB_FETCH(&CFE_SB_Global.RouteReaderCount[RouteEpoch & 1], 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_IncrDestBuffCount(CFE_SB_DestinationD_t *DestPtr)
+{
+    uint16 BuffCount;
+    bool   IsCounted;
+
+    IsCounted = false;
+    BuffCount = CFE_ATOMIC_LOAD(&DestPtr->BuffCount);
+    while (!IsCounted && BuffCount < DestPtr->MsgId2PipeLim)
+    {
+        /* On failure BuffCount is reloaded, and the limit must be checked again */
+        IsCounted = CFE_ATOMIC_COMPARE_EXCHANGE(&DestPtr->BuffCount, &BuffCount, (uint16)(BuffCount + 1));
+    }
+
+    return IsCounted;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_DecrDestBuffCount(CFE_SB_DestinationD_t *DestPtr)
+{
+    uint16 BuffCount;
+
+    /* The count may already be zero if the destination was unsubscribed and resubscribed */
+    BuffCount = CFE_ATOMIC_LOAD(&DestPtr->BuffCount);
+    while (BuffCount > 0 &&
+           !CFE_ATOMIC_COMPARE_EXCHANGE(&DestPtr->BuffCount, &BuffCount, (uint16)(BuffCount - 1)))
+    {
+        /* BuffCount was reloaded, try again */
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_DecrRouteDestBuffCount(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId)
+{
+    const CFE_SB_RouteSnapshot_t *SnapshotPtr;
+    CFE_SB_DestinationD_t *       DestPtr;
+    uint32                        RouteEpoch;
+    uint32                        i;
+
+    RouteEpoch = CFE_SB_RouteReadBegin();
+
+    SnapshotPtr = CFE_SB_GetRouteSnapshot(RouteId);
+    if (SnapshotPtr == &CFE_SB_Global.LockedRouteSnapshot)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
+        if (DestPtr != NULL)
+        {
+            CFE_SB_DecrDestBuffCount(DestPtr);
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+    else if (SnapshotPtr != NULL)
+    {
+        for (i = 0; i < SnapshotPtr->NumDests; ++i)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(SnapshotPtr->Dests[i].PipeId, PipeId))
+            {
+                CFE_SB_DecrDestBuffCount(SnapshotPtr->Dests[i].DestPtr);
+                break;
+            }
+        }
+    }
+
+    CFE_SB_RouteReadEnd(RouteEpoch);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_SB_IncrPipeQueueDepth(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    uint16 Depth;
+    uint16 PeakDepth;
+
+    Depth = CFE_ATOMIC_ADD_FETCH(&PipeDscPtr->CurrentQueueDepth, 1);
+
+    PeakDepth = CFE_ATOMIC_LOAD(&PipeDscPtr->PeakQueueDepth);
+    while (Depth > PeakDepth && !CFE_ATOMIC_COMPARE_EXCHANGE(&PipeDscPtr->PeakQueueDepth, &PeakDepth, Depth))
+    {
+        /* PeakDepth was reloaded, try again */
+    }
+
+    return Depth;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_DecrPipeQueueDepth(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    uint16 Depth;
+
+    Depth = CFE_ATOMIC_LOAD(&PipeDscPtr->CurrentQueueDepth);
+    while (Depth > 0 &&
+           !CFE_ATOMIC_COMPARE_EXCHANGE(&PipeDscPtr->CurrentQueueDepth, &Depth, (uint16)(Depth - 1)))
+    {
+        /* Depth was reloaded, try again */
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int64 CFE_SB_GetLatencyTime(void)
+{
+    OS_time_t TimeNow;
+
+    CFE_PSP_GetTime(&TimeNow);
+
+    return OS_TimeGetTotalMicroseconds(TimeNow);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_RecordPipeLatency(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_BufferD_t *BufDscPtr, int64 ReceiveTime)
+{
+    uint32 Latency;
+    uint32 Value;
+    uint32 Bucket;
+
+    /* The histogram is kept in 32 bits, which covers latencies of up to about 71 minutes */
+    Latency = (uint32)(ReceiveTime - BufDscPtr->TransmitTime);
+
+    /* Bucket N holds latencies from 2^N up to 2^(N+1) microseconds */
+    Value  = Latency;
+    Bucket = 0;
+    while (Value > 1 && Bucket < (CFE_SB_PIPE_LATENCY_BUCKETS - 1))
+    {
+        Value >>= 1;
+        ++Bucket;
+    }
+
+    ++PipeDscPtr->LatencyHist[Bucket];
+
+    if (Latency > PipeDscPtr->MaxLatency)
+    {
+        PipeDscPtr->MaxLatency = Latency;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReleasePipeBuffers(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    if (PipeDscPtr->LastBuffer != NULL)
+    {
+        /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
+        PipeDscPtr->LastBuffer = NULL;
+    }
+
+    /* Same for any additional buffers that were returned by a batched receive */
+    while (PipeDscPtr->NumBatchBuffers > 0)
+    {
+        --PipeDscPtr->NumBatchBuffers;
+        CFE_SB_DecrBufUseCnt(PipeDscPtr->BatchBuffers[PipeDscPtr->NumBatchBuffers]);
+        PipeDscPtr->BatchBuffers[PipeDscPtr->NumBatchBuffers] = NULL;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
+{
+    CFE_SB_BufferLink_t *NextLink;
+    CFE_SB_BufferD_t *   DscPtr;
+
+    /*
+     * First go through the "ZeroCopy" tracking list and find all nodes
+     * with a matching AppID.  This needs to be done while locked to
+     * prevent other tasks from changing the list at the same time.
+     */
+    if (CFE_RESOURCEID_TEST_DEFINED(AppId))
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        /* Get start of list */
+        NextLink = CFE_SB_TrackingListGetNext(&CFE_SB_Global.ZeroCopyList);
+        while (!CFE_SB_TrackingListIsEnd(&CFE_SB_Global.ZeroCopyList, NextLink))
+        {
+            /* Get buffer descriptor pointer */
+            /* NOTE: casting via void* here rather than CFE_SB_BufferD_t* avoids a false
+             * alignment warning on platforms with strict alignment requirements */
+            DscPtr = (void *)NextLink;
+
+            /* Read the next link now in case this node gets moved */
+            NextLink = CFE_SB_TrackingListGetNext(NextLink);
+
+            /* Check if it is a zero-copy buffer owned by this app */
+            if (CFE_RESOURCEID_TEST_EQUAL(DscPtr->AppId, AppId))
+            {
+                /* If so, decrement the use count as the app has now gone away */
+                CFE_SB_DecrBufUseCnt(DscPtr);
+            }
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr)
+{
+    cpuaddr BufDscAddr;
+
+    /*
+     * Calculate descriptor pointer from buffer pointer -
+     * The buffer is just a member (offset) in the descriptor
+     */
+    BufDscAddr = (cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content);
+    *BufDscPtr = (CFE_SB_BufferD_t *)BufDscAddr;
+
+    /*
+     * Check that the descriptor is actually a "zero copy" type,
+     */
+    if (!CFE_RESOURCEID_TEST_DEFINED((*BufDscPtr)->AppId))
+    {
+        return CFE_SB_BUFFER_INVALID;
+    }
+
+    /* Basic sanity check passed */
+    return CFE_SUCCESS;
+}
+
+/******************************************************************
+ *
+ * MESSAGE TRANSACTION IMPLEMENTATION FUNCTIONS
+ *
+ ******************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_Init(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *PipeSet, uint16 MaxPipes,
+                            const void *RefMemPtr)
+{
+    memset(TxnPtr, 0, offsetof(CFE_SB_TransmitTxn_State_t, DestSet));
+    TxnPtr->PipeSet  = PipeSet;
+    TxnPtr->MaxPipes = MaxPipes;
+
+    /* The reference pointer is kept just for (potential) reporting in events, etc.
+     * It is not dereferenced from here. */
+    TxnPtr->RefMemPtr = RefMemPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_SetTimeout(CFE_SB_MessageTxn_State_t *TxnPtr, int32 Timeout)
+{
+    TxnPtr->UserTimeoutParam = Timeout;
+    if (Timeout > 0)
+    {
+        /* Convert to an absolute timeout */
+        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_TIMED;
+        CFE_PSP_GetTime(&TxnPtr->AbsTimeout);
+        TxnPtr->AbsTimeout = OS_TimeAdd(TxnPtr->AbsTimeout, OS_TimeFromTotalMilliseconds(Timeout));
+    }
+    else if (Timeout == CFE_SB_POLL)
+    {
+        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_POLL;
+    }
+    else if (Timeout == CFE_SB_PEND_FOREVER)
+    {
+        TxnPtr->TimeoutMode = CFE_SB_MessageTxn_TimeoutMode_PEND;
+    }
+    else
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_GetEventDetails(const CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_SB_PipeSetEntry_t *ContextPtr,
+                                       uint16 EventId, CFE_ES_TaskId_t TskId, char *EvtMsg, size_t EvtMsgSize,
+                                       CFE_EVS_EventType_Enum_t *EventType, int32 *ReqBit)
+{
+    char  FullName[(OS_MAX_API_NAME * 2)];
+    char  PipeName[OS_MAX_API_NAME];
+    int32 LocalOsStatus;
+
+    if (ContextPtr == NULL)
+    {
+        LocalOsStatus = INT32_MIN; /* should not be used; do not alias any actual OS status */
+    }
+    else
+    {
+        LocalOsStatus = ContextPtr->OsStatus;
+        if (ContextPtr->PendingEventId == CFE_SB_BAD_PIPEID_EID)
+        {
+            /* do not attempt to map to a pipe name if reporting a bad pipeID event - use its ID */
+            snprintf(PipeName, sizeof(PipeName), "%lu", CFE_RESOURCEID_TO_ULONG(ContextPtr->PipeId));
+        }
+        else
+        {
+            CFE_SB_GetPipeName(PipeName, sizeof(PipeName), ContextPtr->PipeId);
+        }
+    }
+
+    switch (EventId)
+    {
+        case CFE_SB_SEND_BAD_ARG_EID:
+            *ReqBit    = CFE_SB_SEND_BAD_ARG_EID_BIT;
+            *EventType = CFE_EVS_EventType_ERROR;
+
+            snprintf(EvtMsg, EvtMsgSize, "Send Err:Bad input argument,Arg 0x%lx,App %s",
+                     (unsigned long)TxnPtr->RefMemPtr, CFE_SB_GetAppTskName(TskId, FullName));
+            break;
+
+        case CFE_SB_SEND_INV_MSGID_EID:
+            *ReqBit    = CFE_SB_SEND_INV_MSGID_EID_BIT;
+            *EventType = CFE_EVS_EventType_ERROR;
 
             snprintf(EvtMsg, EvtMsgSize, "Send Err:Invalid MsgId(0x%x)in msg,App %s",
                      (unsigned int)CFE_SB_MsgIdToValue(TxnPtr->RoutingMsgId), CFE_SB_GetAppTskName(TskId, FullName));
@@ -776,23 +1463,19 @@ void CFE_SB_MessageTxn_ReportEvents(const CFE_SB_MessageTxn_State_t *TxnPtr)
          * receive side has two - these differeniate between a bad passed-in
          * arg vs some other internal error such as queue access.
          */
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
         if (TxnPtr->IsTransmit)
         {
-            CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+            CFE_ATOMIC_ADD_FETCH(&CFE_SB_Global.Counters.MsgSendErrorCounter, 1);
         }
         else if (TxnPtr->Status == CFE_SB_BAD_ARGUMENT)
         {
-            ++CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter;
+            CFE_ATOMIC_ADD_FETCH(&CFE_SB_Global.Counters.MsgReceiveErrorCounter, 1);
         }
         else
         {
             /* For any other unexpected error (e.g. CFE_SB_Q_RD_ERR_EID) */
-            ++CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter;
+            CFE_ATOMIC_ADD_FETCH(&CFE_SB_Global.Counters.InternalErrorCounter, 1);
         }
-
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
     }
 }
 
@@ -917,31 +1600,150 @@ CFE_SB_MessageTxn_State_t *CFE_SB_TransmitTxn_Init(CFE_SB_TransmitTxn_State_t *T
     return &TxnPtr->MessageTxn_State;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_TransmitTxn_IsDeliveryDue(CFE_SB_DestinationD_t *DestPtr, int64 TransmitTime)
+{
+    uint32 Decimation;
+    uint32 MinInterval;
+    uint32 Count;
+    uint32 NextCount;
+    uint32 LastDelivery;
+    uint32 LastDeliveryEpoch;
+    uint32 Epoch;
+    uint64 Elapsed;
+    bool   IsDue;
+
+    IsDue = true;
+
+    /* Only the message that finds the count at 0 is delivered, concurrent senders each get their own count */
+    Decimation = CFE_ATOMIC_LOAD(&DestPtr->Decimation);
+    if (Decimation > 1)
+    {
+        Count = CFE_ATOMIC_LOAD(&DestPtr->DecimationCount);
+        do
+        {
+            NextCount = (Count + 1 < Decimation) ? (Count + 1) : 0;
+        } while (!CFE_ATOMIC_COMPARE_EXCHANGE(&DestPtr->DecimationCount, &Count, NextCount));
+
+        IsDue = (Count == 0);
+    }
+
+    /*
+     * The last delivery is kept as two 32 bit halves, as the transmit path can only update
+     * pointer sized items atomically.  The low half alone wraps about every 71 minutes, so
+     * the high half (the epoch) is needed to tell an idle destination from a recent delivery.
+     *
+     * The epoch is written before the low half and read after it, so a sender never pairs a
+     * new low half with an old epoch.  If senders race for the same slot, only one of them
+     * gets it.
+     */
+    MinInterval = CFE_ATOMIC_LOAD(&DestPtr->MinInterval);
+    if (IsDue && MinInterval != 0)
+    {
+        Epoch             = (uint32)((uint64)TransmitTime >> 32);
+        LastDelivery      = CFE_ATOMIC_LOAD(&DestPtr->LastDelivery);
+        LastDeliveryEpoch = CFE_ATOMIC_LOAD(&DestPtr->LastDeliveryEpoch);
+
+        Elapsed = ((uint64)(Epoch - LastDeliveryEpoch) << 32) + (uint32)TransmitTime - LastDelivery;
+        if (Elapsed >= MinInterval)
+        {
+            CFE_ATOMIC_STORE(&DestPtr->LastDeliveryEpoch, Epoch);
+            IsDue = CFE_ATOMIC_COMPARE_EXCHANGE(&DestPtr->LastDelivery, &LastDelivery, (uint32)TransmitTime);
+        }
+        else
+        {
+            IsDue = false;
+        }
+    }
+
+    return IsDue;
+}
+
 /*----------------------------------------------------------------
  *
  * Local Helper function
  * Not invoked outside of this unit
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
+void CFE_SB_TransmitTxn_AddDestination(CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_SB_RouteDest_t *RouteDestPtr,
+                                       CFE_ES_AppId_t AppId, int64 TransmitTime)
 {
     CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_DestinationD_t *DestPtr;
     CFE_SB_PipeSetEntry_t *ContextPtr;
-    CFE_ES_AppId_t         AppId;
-    bool                   IsAcceptable;
-    CFE_Status_t           Status;
+
+    ContextPtr = NULL;
+
+    if (CFE_ATOMIC_LOAD(&RouteDestPtr->DestPtr->Active) == CFE_SB_ACTIVE) /* destination is active */
+    {
+        PipeDscPtr = RouteDestPtr->PipeDscPtr;
+    }
+    else
+    {
+        PipeDscPtr = NULL;
+    }
+
+    /* The pipe may have been deleted since the snapshot was built */
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, RouteDestPtr->PipeId))
+    {
+        /* Messages held back by the delivery rate are skipped before any accounting, they never reach the pipe */
+        if ((!RouteDestPtr->IgnoreMine || !CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId)) &&
+            CFE_SB_TransmitTxn_IsDeliveryDue(RouteDestPtr->DestPtr, TransmitTime))
+        {
+            ContextPtr = &TxnPtr->PipeSet[TxnPtr->NumPipes];
+            ++TxnPtr->NumPipes;
+        }
+    }
+
+    if (ContextPtr != NULL)
+    {
+        memset(ContextPtr, 0, sizeof(*ContextPtr));
+
+        ContextPtr->PipeId     = RouteDestPtr->PipeId;
+        ContextPtr->SysQueueId = RouteDestPtr->SysQueueId;
+        ContextPtr->UseRing    = RouteDestPtr->UseRing;
+        ContextPtr->IsUrgent   = RouteDestPtr->DestPtr->IsUrgent;
+
+        /* if Msg limit exceeded, log event, increment counter */
+        /* and go to next destination */
+        if (!CFE_SB_IncrDestBuffCount(RouteDestPtr->DestPtr))
+        {
+            ContextPtr->PendingEventId = CFE_SB_MSGID_LIM_ERR_EID;
+            CFE_ATOMIC_ADD_FETCH(&CFE_SB_Global.Counters.MsgLimitErrorCounter, 1);
+            CFE_ATOMIC_ADD_FETCH(&PipeDscPtr->SendErrors, 1);
+            ++TxnPtr->NumPipeErrs;
+        }
+        else
+        {
+            ContextPtr->QueueDepth = CFE_SB_IncrPipeQueueDepth(PipeDscPtr);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_ResolveDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr,
+                                            CFE_ES_AppId_t *AppIdPtr)
+{
+    const CFE_SB_RouteSnapshot_t *SnapshotPtr;
+    CFE_SB_DestinationD_t *       DestPtr;
+    CFE_SB_RouteDest_t            RouteDest;
+    uint32                        RouteEpoch;
+    uint32                        i;
 
     /*
-     * get app id for loopback testing  -
-     * This is only used if one or more of the destinations has its "IGNOREMINE" option set,
-     * but it should NOT be gotten while locked.  So since we do not know (yet) if we need it,
-     * it is better to get it and not need it than need it and not have it.
+     * The route is read without the lock.  Any destination data retired by a
+     * concurrent subscribe/unsubscribe is kept until this read is finished.
      */
-    CFE_ES_GetAppID(&AppId);
-
-    /* take semaphore to prevent a task switch during processing */
-    CFE_SB_LockSharedData(__func__, __LINE__);
+    RouteEpoch = CFE_SB_RouteReadBegin();
 
     /* Get the routing id */
     BufDscPtr->DestRouteId = CFE_SBR_GetRouteId(TxnPtr->RoutingMsgId);
@@ -949,80 +1751,85 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
     /* For an invalid route / no subscribers this whole logic can be skipped */
     if (CFE_SBR_IsValidRouteId(BufDscPtr->DestRouteId))
     {
-        /* If this is the origination, then update the message content (while locked) before actually sending */
+        /* If this is the origination, then update the message content before actually sending */
         if (TxnPtr->IsEndpoint)
         {
-            CFE_SBR_IncrementSequenceCounter(BufDscPtr->DestRouteId);
-
-            /* Set the sequence count from the route */
-            CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_GetSequenceCounter(BufDscPtr->DestRouteId));
+            /* Set the sequence count from the route, the increment is atomic so each sender gets its own value */
+            CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg,
+                                     CFE_SBR_IncrementSequenceCounter(BufDscPtr->DestRouteId));
         }
 
         /* Send the packet to all destinations  */
-        DestPtr = CFE_SBR_GetDestListHeadPtr(BufDscPtr->DestRouteId);
-        while (DestPtr != NULL && TxnPtr->NumPipes < TxnPtr->MaxPipes)
+        SnapshotPtr = CFE_SB_GetRouteSnapshot(BufDscPtr->DestRouteId);
+        if (SnapshotPtr == &CFE_SB_Global.LockedRouteSnapshot)
         {
-            ContextPtr = NULL;
-
-            if (DestPtr->Active == CFE_SB_ACTIVE) /* destination is active */
+            /*
+             * No snapshot could be allocated for this route, so walk the list itself while locked.
+             * Whether the sender is needed is not known until then, and it should NOT be gotten
+             * while locked, so get it anyway.
+             */
+            if (!CFE_RESOURCEID_TEST_DEFINED(*AppIdPtr))
             {
-                PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
+                CFE_ES_GetAppID(AppIdPtr);
             }
-            else
+
+            CFE_SB_LockSharedData(__func__, __LINE__);
+
+            DestPtr = CFE_SBR_GetDestListHeadPtr(BufDscPtr->DestRouteId);
+            while (DestPtr != NULL && TxnPtr->NumPipes < TxnPtr->MaxPipes)
             {
-                PipeDscPtr = NULL;
+                CFE_SB_FillRouteDest(&RouteDest, DestPtr);
+                CFE_SB_TransmitTxn_AddDestination(TxnPtr, &RouteDest, *AppIdPtr, BufDscPtr->TransmitTime);
+                DestPtr = DestPtr->Next;
             }
 
-            if (CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
+            CFE_SB_UnlockSharedData(__func__, __LINE__);
+        }
+        else if (SnapshotPtr != NULL)
+        {
+            /* get app id for loopback testing, only if a destination of the route will check it */
+            if (SnapshotPtr->HasIgnoreMine && !CFE_RESOURCEID_TEST_DEFINED(*AppIdPtr))
             {
-                if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE) == 0 ||
-                    !CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
-                {
-                    ContextPtr = &TxnPtr->PipeSet[TxnPtr->NumPipes];
-                    ++TxnPtr->NumPipes;
-                }
+                CFE_ES_GetAppID(AppIdPtr);
             }
 
-            if (ContextPtr != NULL)
+            for (i = 0; i < SnapshotPtr->NumDests && TxnPtr->NumPipes < TxnPtr->MaxPipes; ++i)
             {
-                memset(ContextPtr, 0, sizeof(*ContextPtr));
-
-                ContextPtr->PipeId     = DestPtr->PipeId;
-                ContextPtr->SysQueueId = PipeDscPtr->SysQueueId;
-
-                /* if Msg limit exceeded, log event, increment counter */
-                /* and go to next destination */
-                if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
-                {
-                    ContextPtr->PendingEventId = CFE_SB_MSGID_LIM_ERR_EID;
-                    ++CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter;
-                    ++PipeDscPtr->SendErrors;
-                    ++TxnPtr->NumPipeErrs;
-                }
-                else
-                {
-                    CFE_SB_IncrBufUseCnt(BufDscPtr);
-                    ++DestPtr->BuffCount;
-
-                    ++PipeDscPtr->CurrentQueueDepth;
-                    if (PipeDscPtr->CurrentQueueDepth > PipeDscPtr->PeakQueueDepth)
-                    {
-                        PipeDscPtr->PeakQueueDepth = PipeDscPtr->CurrentQueueDepth;
-                    }
-                }
+                CFE_SB_TransmitTxn_AddDestination(TxnPtr, &SnapshotPtr->Dests[i], *AppIdPtr,
+                                                  BufDscPtr->TransmitTime);
             }
-
-            DestPtr = DestPtr->Next;
         }
     }
     else
     {
         /* if there have been no subscriptions for this pkt, */
         /* increment the dropped pkt cnt, send event and return success */
-        CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter++;
+        CFE_ATOMIC_ADD_FETCH(&CFE_SB_Global.Counters.NoSubscribersCounter, 1);
         CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_SEND_NO_SUBS_EID, CFE_SUCCESS);
     }
 
+    CFE_SB_RouteReadEnd(RouteEpoch);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_TrackBuffer(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    uint32 i;
+
+    /* Each destination that will get the buffer holds a reference to it */
+    for (i = 0; i < TxnPtr->NumPipes; ++i)
+    {
+        if (TxnPtr->PipeSet[i].PendingEventId == 0)
+        {
+            CFE_SB_IncrBufUseCnt(BufDscPtr);
+        }
+    }
+
     /*
      * Remove this from whatever list it was in
      *
@@ -1037,11 +1844,21 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
 
     /* track the buffer as an in-transit message */
     CFE_SB_TrackingListAdd(&CFE_SB_Global.InTransitList, &BufDscPtr->Link);
+}
 
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_Originate(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    bool         IsAcceptable;
+    CFE_Status_t Status;
 
     /*
-     * Lastly, if this is the origination point, now that all headers should
+     * If this is the origination point, now that all headers should
      * have known values (including sequence) - invoke the mission-specific
      * message origination action.  This may update timestamps and/or compute
      * any required error control fields.
@@ -1057,6 +1874,30 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    CFE_ES_AppId_t AppId;
+
+    /* The sender is looked up only if the route has an IGNOREMINE destination */
+    AppId = CFE_ES_APPID_UNDEFINED;
+
+    CFE_SB_TransmitTxn_ResolveDestinations(TxnPtr, BufDscPtr, &AppId);
+
+    /* The tracking lists are still protected by the lock */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+    CFE_SB_TransmitTxn_TrackBuffer(TxnPtr, BufDscPtr);
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Lastly, now that the destinations are known, do the origination action */
+    CFE_SB_TransmitTxn_Originate(TxnPtr, BufDscPtr);
+}
+
 /*----------------------------------------------------------------
  *
  * Local Helper function
@@ -1099,9 +1940,8 @@ int32 CFE_SB_MessageTxn_GetOsTimeout(const CFE_SB_MessageTxn_State_t *TxnPtr)
  *-----------------------------------------------------------------*/
 bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg)
 {
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_BufferD_t *     BufDscPtr;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_SB_BufferD_t *BufDscPtr;
 
     BufDscPtr = Arg;
 
@@ -1111,8 +1951,16 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
      * of "FindDestinations" assuming this write will be successful - which
      * is the expected/typical result here.
      */
-    ContextPtr->OsStatus =
-        OS_QueuePut(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+    if (ContextPtr->UseRing)
+    {
+        ContextPtr->OsStatus =
+            CFE_SB_PipeRing_Put(ContextPtr->PipeId, BufDscPtr, ContextPtr->IsUrgent, ContextPtr->QueueDepth);
+    }
+    else
+    {
+        ContextPtr->OsStatus = OS_QueuePut(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr),
+                                           CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+    }
 
     /*
      * If it succeeded, nothing else to do.  But if it fails then we must undo the
@@ -1122,35 +1970,33 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
     {
         ++TxnPtr->NumPipeErrs;
 
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
         if (ContextPtr->OsStatus == OS_QUEUE_FULL)
         {
             ContextPtr->PendingEventId = CFE_SB_Q_FULL_ERR_EID;
-            CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
+            CFE_ATOMIC_ADD_FETCH(&CFE_SB_Global.Counters.PipeOverflowErrorCounter, 1);
         }
         else
         {
             /* Unexpected error while writing to queue. */
             ContextPtr->PendingEventId = CFE_SB_Q_WR_ERR_EID;
-            CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
+            CFE_ATOMIC_ADD_FETCH(&CFE_SB_Global.Counters.InternalErrorCounter, 1);
         }
 
+        /* The depth, buffer and use counts are all atomic, so this does not need the lock */
         PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
-        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId) && PipeDscPtr->CurrentQueueDepth > 0)
-        {
-            --PipeDscPtr->CurrentQueueDepth;
-        }
-
-        DestPtr = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, ContextPtr->PipeId);
-        if (DestPtr != NULL && DestPtr->BuffCount > 0)
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId))
         {
-            DestPtr->BuffCount--;
+            CFE_SB_DecrPipeQueueDepth(PipeDscPtr);
         }
 
-        CFE_SB_DecrBufUseCnt(BufDscPtr);
+        CFE_SB_DecrRouteDestBuffCount(BufDscPtr->DestRouteId, ContextPtr->PipeId);
 
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
+        CFE_SB_DecrBufUseCntUnlocked(BufDscPtr);
+    }
+    else
+    {
+        /* If a task is waiting on this pipe as part of a set, it needs to be woken */
+        CFE_SB_PipeSet_Wake(CFE_SB_LocatePipeDescByID(ContextPtr->PipeId));
     }
 
     /* always keep going when sending (broadcast) */
@@ -1188,7 +2034,7 @@ void CFE_SB_MessageTxn_ProcessPipes(CFE_SB_MessageTxn_PipeHandler_t HandlerFunc,
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t *BufPtr)
+CFE_SB_BufferD_t *CFE_SB_TransmitTxn_SetupBuffer(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t *BufPtr)
 {
     int32             Status;
     CFE_SB_BufferD_t *BufDscPtr;
@@ -1199,12 +2045,32 @@ void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer
     {
         /* There is currently no event defined for this */
         CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, Status);
-        return;
+        return NULL;
     }
 
     /* Save passed-in routing parameters into the descriptor */
-    BufDscPtr->ContentSize = CFE_SB_MessageTxn_GetContentSize(TxnPtr);
-    BufDscPtr->MsgId       = CFE_SB_MessageTxn_GetRoutingMsgId(TxnPtr);
+    BufDscPtr->ContentSize  = CFE_SB_MessageTxn_GetContentSize(TxnPtr);
+    BufDscPtr->MsgId        = CFE_SB_MessageTxn_GetRoutingMsgId(TxnPtr);
+    BufDscPtr->TransmitTime = CFE_SB_GetLatencyTime();
+
+    return BufDscPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_SB_BufferD_t *BufDscPtr;
+
+    BufDscPtr = CFE_SB_TransmitTxn_SetupBuffer(TxnPtr, BufPtr);
+    if (BufDscPtr == NULL)
+    {
+        return;
+    }
 
     /* Convert the route to a set of pipes/destinations */
     CFE_SB_TransmitTxn_FindDestinations(TxnPtr, BufDscPtr);
@@ -1217,9 +2083,90 @@ void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer
      * Decrement the buffer UseCount - This means that the caller
      * should not use the buffer anymore after this call.
      */
+    CFE_SB_DecrBufUseCntUnlocked(BufDscPtr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitTxn_ExecuteBatch(CFE_SB_TransmitTxn_State_t *TxnSet, CFE_SB_BufferD_t **BufDscSet, uint32 NumTxns)
+{
+    bool                       IsWritten[CFE_SB_TRANSMIT_BATCH_SIZE][CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+    CFE_SB_MessageTxn_State_t *TxnPtr;
+    CFE_SB_MessageTxn_State_t *NextTxnPtr;
+    CFE_SB_PipeSetEntry_t *    ContextPtr;
+    CFE_SB_PipeSetEntry_t *    NextContextPtr;
+    CFE_ES_AppId_t             AppId;
+    uint32                     i;
+    uint32                     j;
+    uint32                     k;
+    uint32                     m;
+
+    /* All buffers in the batch come from the same sender, so it is looked up at most once */
+    AppId = CFE_ES_APPID_UNDEFINED;
+
+    /* Convert each route to a set of pipes/destinations, this does not need the lock */
+    for (i = 0; i < NumTxns; ++i)
+    {
+        CFE_SB_TransmitTxn_ResolveDestinations(&TxnSet[i].MessageTxn_State, BufDscSet[i], &AppId);
+    }
+
+    /* Move all the buffers to the in-transit list under a single lock */
     CFE_SB_LockSharedData(__func__, __LINE__);
-    CFE_SB_DecrBufUseCnt(BufDscPtr);
+    for (i = 0; i < NumTxns; ++i)
+    {
+        CFE_SB_TransmitTxn_TrackBuffer(&TxnSet[i].MessageTxn_State, BufDscSet[i]);
+    }
     CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    for (i = 0; i < NumTxns; ++i)
+    {
+        CFE_SB_TransmitTxn_Originate(&TxnSet[i].MessageTxn_State, BufDscSet[i]);
+    }
+
+    /*
+     * Write the buffers grouped by destination pipe: at the first buffer for a
+     * given pipe, write every buffer in the batch that goes to the same pipe.
+     * The batch is scanned in order so the per-pipe message order is preserved.
+     */
+    memset(IsWritten, 0, sizeof(IsWritten));
+    for (i = 0; i < NumTxns; ++i)
+    {
+        TxnPtr = &TxnSet[i].MessageTxn_State;
+        for (j = 0; j < TxnPtr->NumPipes; ++j)
+        {
+            ContextPtr = &TxnPtr->PipeSet[j];
+            if (ContextPtr->PendingEventId == 0 && !IsWritten[i][j])
+            {
+                for (k = i; k < NumTxns; ++k)
+                {
+                    NextTxnPtr = &TxnSet[k].MessageTxn_State;
+                    for (m = 0; m < NextTxnPtr->NumPipes; ++m)
+                    {
+                        NextContextPtr = &NextTxnPtr->PipeSet[m];
+                        if (NextContextPtr->PendingEventId == 0 && !IsWritten[k][m] &&
+                            CFE_RESOURCEID_TEST_EQUAL(NextContextPtr->PipeId, ContextPtr->PipeId))
+                        {
+                            CFE_SB_TransmitTxn_PipeHandler(NextTxnPtr, NextContextPtr, BufDscSet[k]);
+                            IsWritten[k][m] = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /*
+     * Decrement the buffer UseCounts - This means that the caller
+     * should not use the buffers anymore after this call.
+     */
+    for (i = 0; i < NumTxns; ++i)
+    {
+        CFE_SB_DecrBufUseCntUnlocked(BufDscSet[i]);
+    }
 }
 
 /******************************************************************
@@ -1234,13 +2181,43 @@ void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveTxn_Init(CFE_SB_ReceiveTxn_State_t *TxnPtr, const void *RefMemPtr)
+CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveTxn_Init(CFE_SB_ReceiveTxn_State_t *TxnPtr, const void *RefMemPtr)
+{
+    CFE_SB_MessageTxn_Init(&TxnPtr->MessageTxn_State, &TxnPtr->Source, 1, RefMemPtr);
+    TxnPtr->MessageTxn_State.IsTransmit = false;
+
+    /* No matter what, the mem pointer from the caller should not be NULL */
+    /* note that the event ID is different between send and recv */
+    if (RefMemPtr == NULL)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(&TxnPtr->MessageTxn_State, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+    }
+
+    return &TxnPtr->MessageTxn_State;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_MessageTxn_SetEndpoint(CFE_SB_MessageTxn_State_t *TxnPtr, bool IsEndpoint)
+{
+    TxnPtr->IsEndpoint = IsEndpoint;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveSetTxn_Init(CFE_SB_ReceiveSetTxn_State_t *TxnPtr, const void *RefMemPtr)
 {
-    CFE_SB_MessageTxn_Init(&TxnPtr->MessageTxn_State, &TxnPtr->Source, 1, RefMemPtr);
+    CFE_SB_MessageTxn_Init(&TxnPtr->MessageTxn_State, TxnPtr->Sources, CFE_PLATFORM_SB_MAX_PIPES_PER_SET, RefMemPtr);
     TxnPtr->MessageTxn_State.IsTransmit = false;
 
-    /* No matter what, the mem pointer from the caller should not be NULL */
-    /* note that the event ID is different between send and recv */
     if (RefMemPtr == NULL)
     {
         CFE_SB_MessageTxn_SetEventAndStatus(&TxnPtr->MessageTxn_State, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
@@ -1255,9 +2232,10 @@ CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveTxn_Init(CFE_SB_ReceiveTxn_State_t *Txn
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_MessageTxn_SetEndpoint(CFE_SB_MessageTxn_State_t *TxnPtr, bool IsEndpoint)
+void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t PipeId)
 {
-    TxnPtr->IsEndpoint = IsEndpoint;
+    TxnPtr->NumPipes = 0;
+    CFE_SB_ReceiveTxn_AddPipeId(TxnPtr, PipeId);
 }
 
 /*----------------------------------------------------------------
@@ -1266,16 +2244,32 @@ void CFE_SB_MessageTxn_SetEndpoint(CFE_SB_MessageTxn_State_t *TxnPtr, bool IsEnd
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t PipeId)
+void CFE_SB_ReceiveTxn_AddPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t PipeId)
 {
     CFE_SB_PipeD_t *       PipeDscPtr;
     CFE_SB_PipeSetEntry_t *ContextPtr;
+    uint16                 i;
 
-    /* For now, there is just one of these */
-    ContextPtr = TxnPtr->PipeSet;
+    if (TxnPtr->NumPipes >= TxnPtr->MaxPipes)
+    {
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+        return;
+    }
+
+    /* A pipe may only appear once */
+    for (i = 0; i < TxnPtr->NumPipes; ++i)
+    {
+        if (CFE_RESOURCEID_TEST_EQUAL(TxnPtr->PipeSet[i].PipeId, PipeId))
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, CFE_SB_RCV_BAD_ARG_EID, CFE_SB_BAD_ARGUMENT);
+            return;
+        }
+    }
+
+    ContextPtr = &TxnPtr->PipeSet[TxnPtr->NumPipes];
     memset(ContextPtr, 0, sizeof(*ContextPtr));
     ContextPtr->PipeId = PipeId;
-    TxnPtr->NumPipes   = 1;
+    ++TxnPtr->NumPipes;
 
     PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
 
@@ -1291,6 +2285,7 @@ void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeI
     else
     {
         ContextPtr->SysQueueId = PipeDscPtr->SysQueueId;
+        ContextPtr->UseRing    = ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_RING) != 0);
 
         /*
          * Un-reference any previous buffer from the last call.
@@ -1307,12 +2302,7 @@ void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeI
          * in a future version of CFE to decouple these actions, to allow for
          * multiple workers to service the same pipe.
          */
-        if (PipeDscPtr->LastBuffer != NULL)
-        {
-            /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
-            CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
-            PipeDscPtr->LastBuffer = NULL;
-        }
+        CFE_SB_ReleasePipeBuffers(PipeDscPtr);
     }
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
@@ -1329,8 +2319,10 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
 {
     CFE_SB_PipeD_t *       PipeDscPtr;
     CFE_SB_DestinationD_t *DestPtr;
+    int64                  ReceiveTime;
 
-    PipeDscPtr = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+    PipeDscPtr  = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+    ReceiveTime = CFE_SB_GetLatencyTime();
 
     /* Now re-lock to store the buffer in the pipe descriptor */
     CFE_SB_LockSharedData(__func__, __LINE__);
@@ -1364,18 +2356,17 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
         /*
         ** DestPtr would be NULL if the msg is unsubscribed to while it is on
         ** the pipe. The BuffCount may be zero if the msg is unsubscribed to and
-        ** then resubscribed to while it is on the pipe. Both of these cases are
-        ** considered nominal and are handled by the code below.
+        ** then resubscribed to while it is on the pipe, or if the route was
+        ** removed and reused for another msg subscribed to on this pipe. These
+        ** cases are considered nominal and are handled by the code below.
         */
-        if (DestPtr != NULL && DestPtr->BuffCount > 0)
+        if (DestPtr != NULL)
         {
-            DestPtr->BuffCount--;
+            CFE_SB_DecrDestBuffCount(DestPtr);
         }
 
-        if (PipeDscPtr->CurrentQueueDepth > 0)
-        {
-            --PipeDscPtr->CurrentQueueDepth;
-        }
+        CFE_SB_DecrPipeQueueDepth(PipeDscPtr);
+        CFE_SB_RecordPipeLatency(PipeDscPtr, BufDscPtr, ReceiveTime);
     }
     else
     {
@@ -1391,6 +2382,35 @@ void CFE_SB_ReceiveTxn_ExportReference(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReceiveTxn_ReadPipe(CFE_SB_PipeSetEntry_t *ContextPtr, CFE_SB_BufferD_t **BufDscPtrP, int32 OsTimeout)
+{
+    size_t BufDscSize;
+
+    /* Read the buffer descriptor address from the queue.  */
+    if (ContextPtr->UseRing)
+    {
+        ContextPtr->OsStatus = CFE_SB_PipeRing_Get(ContextPtr->PipeId, BufDscPtrP, OsTimeout);
+        BufDscSize           = sizeof(*BufDscPtrP);
+    }
+    else
+    {
+        ContextPtr->OsStatus =
+            OS_QueueGet(ContextPtr->SysQueueId, BufDscPtrP, sizeof(*BufDscPtrP), &BufDscSize, OsTimeout);
+    }
+
+    /* The size should always match.  If it does not, the caller generates CFE_SB_Q_RD_ERR_EID. */
+    if (ContextPtr->OsStatus != OS_SUCCESS || BufDscSize != sizeof(*BufDscPtrP))
+    {
+        *BufDscPtrP = NULL;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Local Helper function
@@ -1401,22 +2421,18 @@ bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pip
 {
     CFE_SB_BufferD_t * BufDscPtr;
     CFE_SB_BufferD_t **ParentBufDscPtrP;
-    size_t             BufDscSize;
 
     ParentBufDscPtrP = Arg;
 
-    /* Read the buffer descriptor address from the queue.  */
-    ContextPtr->OsStatus = OS_QueueGet(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize,
-                                       CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
+    CFE_SB_ReceiveTxn_ReadPipe(ContextPtr, &BufDscPtr, CFE_SB_MessageTxn_GetOsTimeout(TxnPtr));
 
     /*
      * translate the return value -
      *
      * CFE functions have their own set of RC values should not directly return OSAL codes
-     * The size should always match.  If it does not, then generate CFE_SB_Q_RD_ERR_EID.
      */
 
-    if (ContextPtr->OsStatus == OS_SUCCESS && BufDscPtr != NULL && BufDscSize == sizeof(BufDscPtr))
+    if (ContextPtr->OsStatus == OS_SUCCESS && BufDscPtr != NULL)
     {
         CFE_SB_ReceiveTxn_ExportReference(TxnPtr, ContextPtr, BufDscPtr, ParentBufDscPtrP);
     }
@@ -1446,6 +2462,35 @@ bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pip
     return false;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_ReceiveTxn_IsAcceptable(const CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    bool         IsAcceptable;
+    CFE_Status_t Status;
+
+    if (TxnPtr->IsEndpoint)
+    {
+        Status = CFE_MSG_VerificationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize, &IsAcceptable);
+        if (Status != CFE_SUCCESS)
+        {
+            /* This typically should not happen - only if VerificationAction got bad arguments */
+            IsAcceptable = false;
+        }
+    }
+    else
+    {
+        /* If no verification being done at this stage - consider everything "good" */
+        IsAcceptable = true;
+    }
+
+    return IsAcceptable;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1456,8 +2501,6 @@ const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnP
 {
     CFE_SB_BufferD_t *     BufDscPtr;
     const CFE_SB_Buffer_t *Result;
-    bool                   IsAcceptable;
-    CFE_Status_t           Status;
 
     Result = NULL;
 
@@ -1480,22 +2523,7 @@ const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnP
             break;
         }
 
-        if (TxnPtr->IsEndpoint)
-        {
-            Status = CFE_MSG_VerificationAction(&BufDscPtr->Content.Msg, BufDscPtr->AllocatedSize, &IsAcceptable);
-            if (Status != CFE_SUCCESS)
-            {
-                /* This typically should not happen - only if VerificationAction got bad arguments */
-                IsAcceptable = false;
-            }
-        }
-        else
-        {
-            /* If no verification being done at this stage - consider everything "good" */
-            IsAcceptable = true;
-        }
-
-        if (IsAcceptable)
+        if (CFE_SB_ReceiveTxn_IsAcceptable(TxnPtr, BufDscPtr))
         {
             /*
              * Replicate the buffer descriptor MsgId and ContentSize in the transaction.
@@ -1525,3 +2553,322 @@ const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnP
 
     return Result;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_ReceiveSetTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg)
+{
+    CFE_SB_ReceiveSetTxn_Ready_t *ReadyPtr;
+    CFE_SB_BufferD_t *            BufDscPtr;
+    bool                          IsEmpty;
+
+    ReadyPtr = Arg;
+    IsEmpty  = false;
+
+    /* Never wait on a single pipe of a set, the waiting is done on the set as a whole */
+    CFE_SB_ReceiveTxn_ReadPipe(ContextPtr, &BufDscPtr, OS_CHECK);
+
+    if (ContextPtr->OsStatus == OS_SUCCESS && BufDscPtr != NULL)
+    {
+        CFE_SB_ReceiveTxn_ExportReference(TxnPtr, ContextPtr, BufDscPtr, &ReadyPtr->BufDscPtr);
+        ReadyPtr->ContextPtr = ContextPtr;
+    }
+    else if (ContextPtr->OsStatus == OS_QUEUE_EMPTY)
+    {
+        IsEmpty = true;
+    }
+    else
+    {
+        /* off-nominal condition, report an error event */
+        CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
+        ContextPtr->PendingEventId = CFE_SB_Q_RD_ERR_EID;
+    }
+
+    /* Go on to the next pipe in priority order only if this one is empty */
+    return IsEmpty;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReceiveSetTxn_ReadReady(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_ReceiveSetTxn_Ready_t *ReadyPtr)
+{
+    ReadyPtr->BufDscPtr  = NULL;
+    ReadyPtr->ContextPtr = NULL;
+
+    CFE_SB_MessageTxn_ProcessPipes(CFE_SB_ReceiveSetTxn_PipeHandler, TxnPtr, ReadyPtr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ReceiveSetTxn_Wait(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetWaiter_t *WaiterPtr,
+                               CFE_SB_ReceiveSetTxn_Ready_t *ReadyPtr)
+{
+    int32 OsTimeout;
+    int32 OsStatus;
+
+    while (ReadyPtr->BufDscPtr == NULL && CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        OsTimeout = CFE_SB_MessageTxn_GetOsTimeout(TxnPtr);
+        if (OsTimeout == OS_CHECK)
+        {
+            /* timeout has already expired */
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_TIME_OUT);
+            break;
+        }
+
+        /*
+         * Tell the writers to wake this task, then check the pipes once more
+         * so a message written just before the flag was set is not missed.
+         */
+        CFE_ATOMIC_STORE(&WaiterPtr->Parked, 1);
+        CFE_SB_ReceiveSetTxn_ReadReady(TxnPtr, ReadyPtr);
+
+        if (ReadyPtr->BufDscPtr != NULL || !CFE_SB_MessageTxn_IsOK(TxnPtr))
+        {
+            CFE_ATOMIC_STORE(&WaiterPtr->Parked, 0);
+            break;
+        }
+
+        /*
+         * On success, go around again.  The wakeup may be left over from a
+         * writer that saw the flag from an earlier wait, so the pipes may
+         * still be empty.
+         */
+        OsStatus = CFE_SB_PipeSet_Wait(WaiterPtr, OsTimeout);
+        if (OsStatus == OS_SEM_TIMEOUT)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_TIME_OUT);
+        }
+        else if (OsStatus != OS_SUCCESS)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_PIPE_RD_ERR);
+            TxnPtr->PipeSet[0].PendingEventId = CFE_SB_Q_RD_ERR_EID;
+            TxnPtr->PipeSet[0].OsStatus       = OsStatus;
+        }
+        else
+        {
+            CFE_SB_ReceiveSetTxn_ReadReady(TxnPtr, ReadyPtr);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+const CFE_SB_Buffer_t *CFE_SB_ReceiveSetTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr,
+                                                    CFE_SB_PipeId_t *          ReadyPipeIdPtr)
+{
+    CFE_SB_ReceiveSetTxn_Ready_t Ready;
+    CFE_SB_PipeSetWaiter_t *     WaiterPtr;
+    const CFE_SB_Buffer_t *      Result;
+    CFE_SB_PipeD_t *             PipeDscPtr;
+    CFE_Status_t                 Status;
+
+    Result    = NULL;
+    WaiterPtr = NULL;
+
+    /* A waiter is only needed if this may block */
+    if (CFE_SB_MessageTxn_IsOK(TxnPtr) && TxnPtr->TimeoutMode != CFE_SB_MessageTxn_TimeoutMode_POLL)
+    {
+        Status = CFE_SB_PipeSet_Attach(TxnPtr, &WaiterPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, Status);
+        }
+    }
+
+    while (CFE_SB_MessageTxn_IsOK(TxnPtr))
+    {
+        CFE_SB_ReceiveSetTxn_ReadReady(TxnPtr, &Ready);
+
+        if (Ready.BufDscPtr == NULL && WaiterPtr != NULL)
+        {
+            CFE_SB_ReceiveSetTxn_Wait(TxnPtr, WaiterPtr, &Ready);
+        }
+
+        /* If nothing received, then quit */
+        if (Ready.BufDscPtr == NULL)
+        {
+            /* normal if using CFE_SB_POLL, otherwise the status was already set */
+            CFE_SB_MessageTxn_SetEventAndStatus(TxnPtr, 0, CFE_SB_NO_MESSAGE);
+
+            TxnPtr->RoutingMsgId = CFE_SB_INVALID_MSG_ID;
+            TxnPtr->ContentSize  = 0;
+            Result               = NULL;
+            break;
+        }
+
+        if (CFE_SB_ReceiveTxn_IsAcceptable(TxnPtr, Ready.BufDscPtr))
+        {
+            /* Same as CFE_SB_ReceiveTxn_Execute(), replicate the descriptor MsgId and ContentSize */
+            TxnPtr->RoutingMsgId = Ready.BufDscPtr->MsgId;
+            TxnPtr->ContentSize  = Ready.BufDscPtr->ContentSize;
+            Result               = &Ready.BufDscPtr->Content;
+
+            if (ReadyPipeIdPtr != NULL)
+            {
+                *ReadyPipeIdPtr = Ready.ContextPtr->PipeId;
+            }
+            break;
+        }
+
+        /* Report an event indicating the buffer is being dropped */
+        CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, Ready.ContextPtr, CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID);
+
+        /* Drop the buffer from the pipe it was read from, then look at the whole set again */
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(Ready.ContextPtr->PipeId);
+        CFE_SB_LockSharedData(__func__, __LINE__);
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, Ready.ContextPtr->PipeId))
+        {
+            CFE_SB_ReleasePipeBuffers(PipeDscPtr);
+        }
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    if (WaiterPtr != NULL)
+    {
+        CFE_SB_PipeSet_Detach(TxnPtr, WaiterPtr);
+    }
+
+    return Result;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_ReceiveTxn_ExecuteBatch(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t **BufArray, uint32 MaxCount)
+{
+    CFE_SB_BufferD_t *     DrainSet[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH - 1];
+    CFE_SB_PipeSetEntry_t *ContextPtr;
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_BufferD_t *     BufDscPtr;
+    size_t                 BufDscSize;
+    int32                  OsStatus;
+    int64                  ReceiveTime;
+    uint32                 NumDrained;
+    uint32                 NumReceived;
+    uint32                 i;
+
+    NumDrained  = 0;
+    NumReceived = 0;
+
+    if (MaxCount > CFE_PLATFORM_SB_MAX_RECEIVE_BATCH)
+    {
+        MaxCount = CFE_PLATFORM_SB_MAX_RECEIVE_BATCH;
+    }
+
+    /* The first buffer is received the normal way, which waits according to the timeout */
+    BufArray[0] = (CFE_SB_Buffer_t *)CFE_SB_ReceiveTxn_Execute(TxnPtr);
+    if (BufArray[0] != NULL)
+    {
+        NumReceived = 1;
+    }
+
+    /*
+     * Then pull whatever else is already on the queue.  This never waits, and
+     * stops at the first unsuccessful read, which normally means the queue is empty.
+     */
+    ContextPtr = TxnPtr->PipeSet;
+    while (NumReceived > 0 && (NumDrained + 1) < MaxCount)
+    {
+        if (ContextPtr->UseRing)
+        {
+            OsStatus   = CFE_SB_PipeRing_Get(ContextPtr->PipeId, &BufDscPtr, OS_CHECK);
+            BufDscSize = sizeof(BufDscPtr);
+        }
+        else
+        {
+            OsStatus = OS_QueueGet(ContextPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, OS_CHECK);
+        }
+
+        if (OsStatus != OS_SUCCESS || BufDscPtr == NULL || BufDscSize != sizeof(BufDscPtr))
+        {
+            break;
+        }
+
+        DrainSet[NumDrained] = BufDscPtr;
+        ++NumDrained;
+    }
+
+    if (NumDrained > 0)
+    {
+        PipeDscPtr  = CFE_SB_LocatePipeDescByID(ContextPtr->PipeId);
+        ReceiveTime = CFE_SB_GetLatencyTime();
+
+        /* One lock for all drained buffers, rather than one per buffer as in ExportReference */
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        for (i = 0; i < NumDrained; ++i)
+        {
+            BufDscPtr = DrainSet[i];
+
+            if (CFE_SB_PipeDescIsMatch(PipeDscPtr, ContextPtr->PipeId) &&
+                PipeDscPtr->NumBatchBuffers < (CFE_PLATFORM_SB_MAX_RECEIVE_BATCH - 1))
+            {
+                /*
+                 * The reference that was held by the queue is handed over to the pipe
+                 * descriptor, and released on the next receive call for this pipe.
+                 */
+                PipeDscPtr->BatchBuffers[PipeDscPtr->NumBatchBuffers] = BufDscPtr;
+                ++PipeDscPtr->NumBatchBuffers;
+
+                /* nominally NULL if the msg was unsubscribed while it was on the pipe */
+                DestPtr = CFE_SB_GetDestPtr(BufDscPtr->DestRouteId, ContextPtr->PipeId);
+                if (DestPtr != NULL)
+                {
+                    CFE_SB_DecrDestBuffCount(DestPtr);
+                }
+
+                CFE_SB_DecrPipeQueueDepth(PipeDscPtr);
+                CFE_SB_RecordPipeLatency(PipeDscPtr, BufDscPtr, ReceiveTime);
+            }
+            else
+            {
+                /* Pipe was deleted in the meantime, drop the queue reference */
+                CFE_SB_DecrBufUseCnt(BufDscPtr);
+                DrainSet[i] = NULL;
+            }
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    for (i = 0; i < NumDrained; ++i)
+    {
+        BufDscPtr = DrainSet[i];
+        if (BufDscPtr != NULL)
+        {
+            if (CFE_SB_ReceiveTxn_IsAcceptable(TxnPtr, BufDscPtr))
+            {
+                BufArray[NumReceived] = &BufDscPtr->Content;
+                ++NumReceived;
+            }
+            else
+            {
+                /* The buffer stays referenced by the pipe until the next receive, and is then dropped */
+                CFE_SB_MessageTxn_ReportSingleEvent(TxnPtr, ContextPtr, CFE_SB_RCV_MESSAGE_INTEGRITY_FAIL_EID);
+            }
+        }
+    }
+
+    return NumReceived;
+}
@@ -81,6 +81,10 @@
 #define CFE_SB_CMD_PIPE_DEPTH                32
 #define CFE_SB_CMD_PIPE_NAME                 "SB_CMD_PIPE"
 #define CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER 8
+#define CFE_SB_TRANSMIT_BATCH_SIZE           8    /* buffers per batch transaction, bounds stack use */
+#define CFE_SB_PIPE_RING_DETACH_WAIT         1000 /* msec to wait for ring users when deleting a pipe */
+
+#define CFE_SB_PIPEOPTS_FIXED (CFE_SB_PIPEOPTS_RING | CFE_SB_PIPEOPTS_PRIORITY) /* only set at pipe creation */
 
 #define CFE_SB_PIPE_OVERFLOW (-1)
 #define CFE_SB_PIPE_WR_ERR   (-2)
@@ -153,11 +157,76 @@ typedef struct CFE_SB_BufferD
     size_t AllocatedSize; /**< Total size of this descriptor (including descriptor itself) */
     size_t ContentSize;   /**< Actual size of message content currently stored in the buffer */
 
-    uint16 UseCount; /**< Number of active references to this buffer in the system */
+    uint16 UseCount; /**< Number of active references to this buffer in the system, only updated atomically */
+
+    int64 TransmitTime; /**< PSP time of the transmit in microseconds, for the pipe latency and delivery rate */
+
+    struct CFE_SB_BufferPool *OwnerPool; /**< Producer pool the buffer goes back to, NULL for the SB memory pool */
 
     CFE_SB_Buffer_t Content; /* Variably sized content field, Keep last */
 } CFE_SB_BufferD_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_PipeRingSlot_t
+**
+**  Purpose:
+**     This structure defines one entry in the ring of a ring buffer pipe.
+**     The sequence number tells whether the slot is free for a writer or
+**     holds an entry for the reader, see CFE_SB_PipeRing_Write().
+*/
+
+typedef struct
+{
+    uint32            Seq;
+    CFE_SB_BufferD_t *BufDscPtr;
+} CFE_SB_PipeRingSlot_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_PipeRing_t
+**
+**  Purpose:
+**     This structure defines the ring of buffer descriptor pointers used in
+**     place of the OSAL queue by pipes created with CFE_SB_PIPEOPTS_RING.
+**     It is allocated from the SB memory pool, with as many slots as needed.
+**
+**     Pipes created with CFE_SB_PIPEOPTS_PRIORITY have a second ring for the
+**     urgent lane, which is linked from the normal ring and shares its wakeup
+**     semaphore.  It never changes while the normal ring is attached.
+**
+**     A wakeup threshold set by CFE_SB_SetPipeWakeup() only applies to the
+**     normal ring, writes to the urgent lane always wake the reader.
+*/
+
+typedef struct CFE_SB_PipeRing
+{
+    osal_id_t               WakeupSemId;     /**< Given by a writer only if the reader is waiting */
+    uint32                  Mask;            /**< Number of slots minus 1, slot count is a power of 2 */
+    uint32                  WritePos;        /**< Next position to be claimed by a writer */
+    uint32                  ReadPos;         /**< Next position to be read, only used by the reader */
+    uint32                  ReaderParked;    /**< Set while the reader is (about to start) waiting */
+    uint32                  WakeupThreshold; /**< Writes needed to wake the reader, 0 or 1 wakes on every write */
+    uint32                  WakeupDelay;     /**< Longest wait in msec while writes are held back, 0 if none */
+    uint32                  ParkedWrites;    /**< Writes since the reader parked, only counted with a threshold */
+    struct CFE_SB_PipeRing *UrgentLane;      /**< Ring of the urgent lane, NULL if the pipe has none */
+    CFE_SB_PipeRingSlot_t   Slots[];
+} CFE_SB_PipeRing_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_PipeSetWaiter_t
+**
+**  Purpose:
+**     This structure holds the wakeup semaphore of a task that is waiting on a
+**     set of pipes in CFE_SB_ReceiveBufferFromSet().  Each pipe of the set refers
+**     to it while the task waits, so a transmit to any of them wakes the task.
+*/
+
+typedef struct
+{
+    osal_id_t WakeupSemId; /**< Given by a writer only if the waiter is parked, created on first use */
+    bool      InUse;       /**< Set while a task is waiting on a set with this entry */
+    uint32    Parked;      /**< Set while the waiter is (about to start) waiting */
+} CFE_SB_PipeSetWaiter_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_PipeD_t
 **
@@ -168,18 +237,114 @@ typedef struct CFE_SB_BufferD
 
 typedef struct
 {
-    CFE_SB_PipeId_t   PipeId;
-    CFE_ES_AppId_t    AppId;
-    osal_id_t         SysQueueId;
-    uint8             Opts;
-    uint8             Spare;
-    uint16            SendErrors;
-    uint16            MaxQueueDepth;
-    uint16            CurrentQueueDepth;
-    uint16            PeakQueueDepth;
-    CFE_SB_BufferD_t *LastBuffer;
+    CFE_SB_PipeId_t    PipeId;
+    CFE_ES_AppId_t     AppId;
+    osal_id_t          SysQueueId;
+    uint8              Opts;
+    uint8              Spare;
+    uint16             SendErrors;
+    uint16             MaxQueueDepth;
+    uint16             CurrentQueueDepth;
+    uint16             PeakQueueDepth;
+    uint16             NumBatchBuffers;
+    uint32             SetWaiter;
+    CFE_SB_PipeRing_t *Ring;
+    CFE_SB_BufferD_t * LastBuffer;
+    CFE_SB_BufferD_t * BatchBuffers[CFE_PLATFORM_SB_MAX_RECEIVE_BATCH - 1];
+    uint32             MaxLatency;
+    uint32             LatencyHist[CFE_SB_PIPE_LATENCY_BUCKETS];
+
+    /*
+     * Tasks using the ring, counted without the lock by tasks that may hold a stale pipe ID.
+     * Must stay last, it is not cleared when the descriptor is reused (see CFE_SB_CreatePipeEx()).
+     */
+    uint32 RingUsers;
 } CFE_SB_PipeD_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_RouteDest_t
+**
+**  Purpose:
+**     This structure holds what a transmitter needs to deliver to one
+**     destination of a route, so the fan out does not need to follow the
+**     destination list or locate each pipe by ID.
+**
+**     The buffer count and active state change while the route is in use,
+**     so they stay in the destination descriptor that all snapshots share.
+*/
+typedef struct
+{
+    CFE_SB_PipeD_t *       PipeDscPtr; /**< Pipe table entry, still to be matched against PipeId */
+    CFE_SB_DestinationD_t *DestPtr;    /**< Destination descriptor */
+    CFE_SB_PipeId_t        PipeId;     /**< Pipe of the destination */
+    osal_id_t              SysQueueId; /**< OSAL queue of the pipe */
+    bool                   UseRing;    /**< Pipe uses a ring buffer instead of the queue */
+    bool                   IgnoreMine; /**< Pipe has the IGNOREMINE option, so the sender must be checked */
+} CFE_SB_RouteDest_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_RouteSnapshot_t
+**
+**  Purpose:
+**     This structure is an immutable copy of the destination list of a route.
+**     A new snapshot is built and published whenever the destination list
+**     changes, so that transmitters can fan out without holding the SB lock.
+**
+**     The snapshot is allocated from the SB memory pool with room for only
+**     NumDests entries in Dests.  The entries are contiguous, so a route with
+**     many destinations is read with one pass over a few cache lines.  The
+**     snapshot starts at the pool alignment, which can be raised to the cache
+**     line size with CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN.
+**
+**     The AppId of the sender is only needed by IGNOREMINE destinations, so
+**     HasIgnoreMine lets a transmitter skip looking it up for every other route.
+*/
+typedef struct CFE_SB_RouteSnapshot
+{
+    struct CFE_SB_RouteSnapshot *RetireNext; /**< Link in the retired list, while awaiting release */
+    uint32                       NumDests;
+    bool                         HasIgnoreMine; /**< At least one destination has IgnoreMine set */
+    CFE_SB_RouteDest_t           Dests[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
+} CFE_SB_RouteSnapshot_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_BufFreeList_t
+**
+**  Purpose:
+**     This structure defines the list of free message buffers kept for one
+**     block size of the SB memory pool.  The buffers are linked through the
+**     Next pointer of their tracking list link, which is unused while free.
+**     MaxFree is set from the block size, see CFE_PLATFORM_SB_BUF_CACHE_BYTES.
+*/
+typedef struct
+{
+    CFE_SB_BufferLink_t *Head;
+    uint32               NumFree;
+    uint32               MaxFree; /**< Most buffers the list keeps, 0 if it keeps none */
+} CFE_SB_BufFreeList_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_BufferPool_t
+**
+**  Purpose:
+**     This structure defines a producer buffer pool, see CFE_SB_CreateBufferPool().
+**     Its buffers are allocated from the SB memory pool when the pool is created,
+**     and once the last reference to one is dropped it goes back to the free
+**     list here instead.  Like CFE_SB_BufFreeList_t the free buffers are linked
+**     through their tracking list link, and the list is protected by the SB lock.
+**
+**     A deleted pool keeps its slot, with a reserved ID, until all of its buffers
+**     still in use have come back, so those buffers never refer to a reused slot.
+*/
+typedef struct CFE_SB_BufferPool
+{
+    CFE_SB_BufferPoolId_t PoolId;
+    CFE_ES_AppId_t        AppId;      /**< App that created the pool, the only one that may use it */
+    CFE_SB_BufferLink_t * FreeHead;   /**< Buffers ready to be taken */
+    uint16                NumBuffers; /**< Buffers that belong to the pool, free or in use */
+    uint16                NumFree;    /**< Buffers on the free list */
+} CFE_SB_BufferPool_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_BufParams_t
 **
@@ -190,6 +355,9 @@ typedef struct
 {
     CFE_ES_MemHandle_t PoolHdl;
     CFE_ES_STATIC_POOL_TYPE(CFE_PLATFORM_SB_BUF_MEMORY_BYTES) Partition;
+
+    /* Free message buffers, one list per block size in CFE_SB_MemPoolDefSize */
+    CFE_SB_BufFreeList_t FreeList[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
 } CFE_SB_MemParams_t;
 
 /*******************************************************************************/
@@ -208,12 +376,13 @@ typedef struct
 /**
  * \brief Temporary holding buffer for records being written to a file.
  *
- * This is shared/reused between all file types (msg map, route info, pipe info).
+ * This is shared/reused between all file types (msg map, route info, pipe info, pipe latency).
  */
 typedef union
 {
     CFE_SB_BackgroundRouteInfoBuffer_t RouteInfo;
     CFE_SB_PipeInfoEntry_t             PipeInfo;
+    CFE_SB_PipeLatencyEntry_t          PipeLatency;
     CFE_SB_MsgMapFileEntry_t           MsgMapInfo;
 } CFE_SB_BackgroundFileBuffer_t;
 
@@ -228,6 +397,45 @@ typedef struct
     CFE_SB_BackgroundFileBuffer_t Buffer;    /**< Temporary holding area for file record */
 } CFE_SB_BackgroundFileStateInfo_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_MaskSub_t
+**
+**  Purpose:
+**     This structure defines a mask subscription, made with CFE_SB_SubscribeMask().
+**     A message ID matches when its value is equal to MsgIdValue in all the bits
+**     set in Mask.  The entry is unused while PipeId is undefined.
+*/
+typedef struct
+{
+    CFE_SB_PipeId_t     PipeId;
+    CFE_SB_MsgId_Atom_t MsgIdValue; /**< Only holds the bits set in Mask */
+    CFE_SB_MsgId_Atom_t Mask;
+    uint16              MsgLim;
+} CFE_SB_MaskSub_t;
+
+/******************************************************************************
+**  Typedef:  CFE_SB_Counters_t
+**
+**  Purpose:
+**     Counters updated on the transmit and receive paths without the SB lock.
+**     All accesses must be atomic.  The values are copied into the telemetry
+**     payloads only when the housekeeping or statistics packet is sent.
+*/
+typedef struct
+{
+    uint32 NoSubscribersCounter;
+    uint32 MsgSendErrorCounter;
+    uint32 MsgReceiveErrorCounter;
+    uint32 InternalErrorCounter;
+    uint32 PipeOverflowErrorCounter;
+    uint32 MsgLimitErrorCounter;
+
+    uint32 SBBuffersInUse;
+    uint32 PeakSBBuffersInUse;
+    uint32 MemInUse;
+    uint32 PeakMemInUse;
+} CFE_SB_Counters_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_Global_t
 **
@@ -243,6 +451,7 @@ typedef struct
     CFE_SB_PipeD_t               PipeTbl[CFE_PLATFORM_SB_MAX_PIPES];
     CFE_SB_HousekeepingTlm_t     HKTlmMsg;
     CFE_SB_StatsTlm_t            StatTlmMsg;
+    CFE_SB_Counters_t            Counters;
     CFE_SB_PipeId_t              CmdPipe;
     CFE_SB_MemParams_t           Mem;
     CFE_SB_AllSubscriptionsTlm_t PrevSubMsg;
@@ -257,6 +466,33 @@ typedef struct
 
     /* A list of buffers currently issued to apps for zero-copy */
     CFE_SB_BufferLink_t ZeroCopyList;
+
+    /* Published destination snapshot of each route, read by transmitters without the lock */
+    CFE_SB_RouteSnapshot_t *RouteSnapshot[CFE_PLATFORM_SB_MAX_MSG_IDS];
+
+    /* Placeholder published when a snapshot cannot be allocated, transmitters then use the lock */
+    CFE_SB_RouteSnapshot_t LockedRouteSnapshot;
+
+    /* Current route epoch, and the number of transmitters reading route snapshots in each epoch by parity */
+    uint32 RouteEpoch;
+    uint32 RouteReaderCount[2];
+
+    /* Unpublished snapshots and removed destinations that a transmitter may still be reading, by epoch parity */
+    CFE_SB_RouteSnapshot_t *RetiredSnapshots[2];
+    CFE_SB_DestinationD_t * RetiredDests[2];
+
+    /* Mask subscriptions, matched against the message ID of each route that is created */
+    CFE_SB_MaskSub_t MaskSubs[CFE_PLATFORM_SB_MAX_MASK_SUBS];
+
+    /* Number of mask subscriptions in use */
+    uint32 NumMaskSubs;
+
+    /* Tasks waiting on sets of pipes, the SetWaiter of each pipe in a set is the entry number plus 1 */
+    CFE_SB_PipeSetWaiter_t PipeSetWaiters[CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS];
+
+    /* Producer buffer pools, see CFE_SB_CreateBufferPool() */
+    CFE_SB_BufferPool_t BufferPools[CFE_PLATFORM_SB_MAX_BUFFER_POOLS];
+    CFE_ResourceId_t    LastBufferPoolId;
 } CFE_SB_Global_t;
 
 /******************************************************************************
@@ -266,6 +502,9 @@ typedef struct
 {
     CFE_SB_PipeId_t PipeId;
     osal_id_t       SysQueueId;
+    bool            UseRing;
+    bool            IsUrgent;
+    uint16          QueueDepth;
     uint16          PendingEventId;
     int32           OsStatus;
 } CFE_SB_PipeSetEntry_t;
@@ -335,6 +574,28 @@ typedef struct
     CFE_SB_PipeSetEntry_t Source;
 } CFE_SB_ReceiveTxn_State_t;
 
+/**
+ * \brief Tracks the status of a receive transaction on a set of pipes
+ *
+ * The pipes are kept in priority order, the first entry is read first.
+ *
+ */
+typedef struct
+{
+    CFE_SB_MessageTxn_State_t MessageTxn_State;
+
+    CFE_SB_PipeSetEntry_t Sources[CFE_PLATFORM_SB_MAX_PIPES_PER_SET];
+} CFE_SB_ReceiveSetTxn_State_t;
+
+/**
+ * \brief Result of reading a set of pipes, the argument to CFE_SB_ReceiveSetTxn_PipeHandler()
+ */
+typedef struct
+{
+    CFE_SB_BufferD_t *     BufDscPtr;  /**< Buffer that was read, NULL if none */
+    CFE_SB_PipeSetEntry_t *ContextPtr; /**< Pipe the buffer was read from */
+} CFE_SB_ReceiveSetTxn_Ready_t;
+
 typedef bool (*CFE_SB_MessageTxn_PipeHandler_t)(CFE_SB_MessageTxn_State_t *, CFE_SB_PipeSetEntry_t *, void *);
 
 /*
@@ -478,6 +739,19 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
  */
 int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Add to a counter in CFE_SB_Global.Counters and raise its high water mark
+ *
+ * Both updates are atomic, so this may be invoked without holding the
+ * SB global lock.
+ *
+ * @param CounterPtr  Pointer to the counter
+ * @param PeakPtr     Pointer to the high water mark of the counter
+ * @param Amount      Amount to add to the counter
+ */
+void CFE_SB_AddCounterWithPeak(uint32 *CounterPtr, uint32 *PeakPtr, uint32 Amount);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Increment the UseCount of a buffer
@@ -485,12 +759,25 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId);
  * UseCount is a variable in the CFE_SB_BufferD_t and is used to
  * determine when a buffer may be returned to the memory pool.
  *
- * @note This must only be invoked while holding the SB global lock
+ * The increment is atomic, so this may be invoked without holding the
+ * SB global lock, as long as the caller already holds a reference.
  *
  * @param bd  Pointer to the buffer descriptor.
  */
 void CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically decrement the UseCount of a buffer
+ *
+ * The UseCount is never decremented below zero.  This does not return the
+ * buffer to the memory pool, that is left to the caller.
+ *
+ * @param bd  Pointer to the buffer descriptor.
+ * @returns true if this dropped the last reference to the buffer
+ */
+bool CFE_SB_DropBufUseCnt(CFE_SB_BufferD_t *bd);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Decrement the UseCount of a buffer
@@ -507,6 +794,21 @@ void CFE_SB_IncrBufUseCnt(CFE_SB_BufferD_t *bd);
  */
 void CFE_SB_DecrBufUseCnt(CFE_SB_BufferD_t *bd);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Decrement the UseCount of a buffer, without holding the lock
+ *
+ * Same as CFE_SB_DecrBufUseCnt(), but for callers that do not hold the
+ * SB global lock.  The decrement is atomic, and the lock is only taken
+ * if this dropped the last reference and the buffer must be returned to
+ * the memory pool.
+ *
+ * @note This must NOT be invoked while holding the SB global lock
+ *
+ * @param bd  Pointer to the buffer descriptor.
+ */
+void CFE_SB_DecrBufUseCntUnlocked(CFE_SB_BufferD_t *bd);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * SB internal function to validate a given MsgId.
@@ -583,6 +885,205 @@ CFE_SB_DestinationD_t *CFE_SB_GetDestinationBlk(void);
  */
 int32 CFE_SB_PutDestinationBlk(CFE_SB_DestinationD_t *Dest);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * This function gets a route snapshot from the SB memory pool.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @param NumDests Number of destinations the snapshot must hold
+ * @return Pointer to the route snapshot, or NULL on failure
+ */
+CFE_SB_RouteSnapshot_t *CFE_SB_GetRouteSnapshotBlk(uint32 NumDests);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * This function returns a route snapshot to the SB memory pool.
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @param SnapshotPtr Pointer to the route snapshot
+ */
+void CFE_SB_PutRouteSnapshotBlk(CFE_SB_RouteSnapshot_t *SnapshotPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * This function gets a pipe ring from the SB memory pool.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @param NumSlots Number of slots the ring must hold
+ * @return Pointer to the pipe ring, or NULL on failure
+ */
+CFE_SB_PipeRing_t *CFE_SB_GetPipeRingBlk(uint32 NumSlots);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * This function returns a pipe ring to the SB memory pool.
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @param RingPtr Pointer to the pipe ring
+ */
+void CFE_SB_PutPipeRingBlk(CFE_SB_PipeRing_t *RingPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Initializes a pipe ring
+ *
+ * \param[out] RingPtr     Pipe ring, allocated via CFE_SB_GetPipeRingBlk()
+ * \param[in]  NumSlots    Number of slots in the ring, as returned by CFE_SB_PipeRing_GetNumSlots()
+ * \param[in]  WakeupSemId Binary semaphore used to wake the reader
+ */
+void CFE_SB_PipeRing_Init(CFE_SB_PipeRing_t *RingPtr, uint32 NumSlots, osal_id_t WakeupSemId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the number of slots to allocate for a pipe ring
+ *
+ * \param[in] Depth Requested pipe depth
+ * \returns Depth rounded up to the next power of 2
+ */
+uint32 CFE_SB_PipeRing_GetNumSlots(uint16 Depth);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Writes a buffer descriptor into a pipe ring
+ *
+ * May be invoked by any number of tasks concurrently, and never blocks.  If the reader
+ * is waiting for the ring, it is woken up.
+ *
+ * \param[inout] RingPtr   Pipe ring
+ * \param[in]    BufDscPtr Buffer descriptor to write
+ * \returns OS_SUCCESS, or OS_QUEUE_FULL if no slot is free
+ */
+int32 CFE_SB_PipeRing_Write(CFE_SB_PipeRing_t *RingPtr, CFE_SB_BufferD_t *BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Reads the next buffer descriptor from a pipe ring
+ *
+ * This never blocks.  Only one task may read from a given ring.
+ *
+ * \param[inout] RingPtr Pipe ring
+ * \returns The buffer descriptor, or NULL if the ring is empty
+ */
+CFE_SB_BufferD_t *CFE_SB_PipeRing_Read(CFE_SB_PipeRing_t *RingPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Writes a buffer descriptor to a ring buffer pipe
+ *
+ * Equivalent of OS_QueuePut() for pipes created with CFE_SB_PIPEOPTS_RING.  This does
+ * not need the SB global lock, the ring is kept from being freed while it is in use.
+ *
+ * The ring may have more slots than the depth the pipe was created with, so the
+ * pipe is full once its depth, counting this buffer, goes over that depth.
+ *
+ * \param[in] PipeId     Pipe to write to
+ * \param[in] BufDscPtr  Buffer descriptor to write
+ * \param[in] IsUrgent   Write to the urgent lane, ignored if the pipe does not have one
+ * \param[in] QueueDepth Depth of the pipe counting this buffer, from CFE_SB_IncrPipeQueueDepth()
+ * \returns OS_SUCCESS, OS_QUEUE_FULL, or OS_ERR_INVALID_ID if the pipe no longer exists
+ */
+int32 CFE_SB_PipeRing_Put(CFE_SB_PipeId_t PipeId, CFE_SB_BufferD_t *BufDscPtr, bool IsUrgent, uint16 QueueDepth);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Reads a buffer descriptor from a ring buffer pipe
+ *
+ * Equivalent of OS_QueueGet() for pipes created with CFE_SB_PIPEOPTS_RING.  If the ring
+ * is empty, this waits on the wakeup semaphore of the ring according to OsTimeout.  This
+ * does not need the SB global lock, the ring is kept from being freed while it is in use.
+ * The urgent lane, if the pipe has one, is always read before the normal lane.  If the
+ * pipe has a wakeup threshold, no single wait is longer than its wakeup delay.
+ *
+ * \param[in]  PipeId     Pipe to read from
+ * \param[out] BufDscPtrP Buffer descriptor that was read, NULL if none
+ * \param[in]  OsTimeout  OS_CHECK, OS_PEND, or a timeout in milliseconds
+ * \returns OS_SUCCESS, OS_QUEUE_EMPTY, OS_QUEUE_TIMEOUT, or another OSAL error code
+ */
+int32 CFE_SB_PipeRing_Get(CFE_SB_PipeId_t PipeId, CFE_SB_BufferD_t **BufDscPtrP, int32 OsTimeout);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Detaches the ring from a pipe that is being deleted
+ *
+ * After this returns, no other task is using the ring anymore and it may be
+ * released via CFE_SB_PipeRing_Destroy().  The pipe descriptor must already be
+ * marked as reserved, so no new writer or reader can find it.
+ *
+ * Waits at most #CFE_SB_PIPE_RING_DETACH_WAIT msec for the tasks that found the
+ * ring before it was detached.  If one of them is still using it after that,
+ * the ring is left allocated rather than freed under that task, and a syslog
+ * message is written.
+ *
+ * \param[inout] PipeDscPtr Pipe descriptor
+ * \returns The ring that was attached to the pipe, or NULL if none or still in use
+ */
+CFE_SB_PipeRing_t *CFE_SB_PipeRing_Detach(CFE_SB_PipeD_t *PipeDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Attaches a pipe set waiter to every pipe of a receive transaction
+ *
+ * Claims a free entry in the pipe set waiter table, creating its wakeup semaphore if
+ * this is the first use of the entry, and refers each pipe of the transaction to it.
+ * Takes the SB global lock.
+ *
+ * \param[in]  TxnPtr     Receive transaction, with all of its pipes set
+ * \param[out] WaiterPtrP Waiter that was attached, NULL on failure
+ * \returns CFE_SUCCESS, CFE_SB_PIPE_SET_BUSY if a pipe already has a waiter or no entry is
+ *          free, or CFE_SB_PIPE_RD_ERR if the semaphore could not be created
+ */
+CFE_Status_t CFE_SB_PipeSet_Attach(const CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetWaiter_t **WaiterPtrP);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Detaches a pipe set waiter from the pipes of a receive transaction
+ *
+ * Undoes CFE_SB_PipeSet_Attach(), after which the entry may be claimed by another task.
+ * Takes the SB global lock.
+ *
+ * \param[in]    TxnPtr    Receive transaction, as passed to CFE_SB_PipeSet_Attach()
+ * \param[inout] WaiterPtr Waiter to detach
+ */
+void CFE_SB_PipeSet_Detach(const CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetWaiter_t *WaiterPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Wakes the task waiting on a set that includes the given pipe
+ *
+ * Called after a buffer descriptor is written to the pipe.  This does not need the SB
+ * global lock, and only involves the OS if the waiter is actually parked.
+ *
+ * \param[in] PipeDscPtr Pipe descriptor, may be NULL
+ */
+void CFE_SB_PipeSet_Wake(CFE_SB_PipeD_t *PipeDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Waits for a transmit to any pipe of the set
+ *
+ * The caller must have set the Parked flag of the waiter, and checked all the pipes
+ * once more afterwards.  The flag is clear again when this returns.  A successful
+ * return may also be left over from an earlier wait, so the pipes may still be empty.
+ *
+ * \param[inout] WaiterPtr Waiter attached to the pipes
+ * \param[in]    OsTimeout OS_PEND or a timeout in milliseconds
+ * \returns OS_SUCCESS, OS_SEM_TIMEOUT, or another OSAL error code
+ */
+int32 CFE_SB_PipeSet_Wait(CFE_SB_PipeSetWaiter_t *WaiterPtr, int32 OsTimeout);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Releases a pipe ring
+ *
+ * Drops any buffers still in the ring, deletes the wakeup semaphore and returns the
+ * ring to the SB memory pool.  The ring of the urgent lane, if any, is released too.
+ *
+ * \param[in] RingPtr Pipe ring, as returned by CFE_SB_PipeRing_Detach()
+ */
+void CFE_SB_PipeRing_Destroy(CFE_SB_PipeRing_t *RingPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief For SB buffer tracking, get first/next position in a list
@@ -594,135 +1095,493 @@ static inline CFE_SB_BufferLink_t *CFE_SB_TrackingListGetNext(CFE_SB_BufferLink_
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief For SB buffer tracking, checks if this current position represents the end of the list
+ * \brief For SB buffer tracking, checks if this current position represents the end of the list
+ */
+static inline bool CFE_SB_TrackingListIsEnd(const CFE_SB_BufferLink_t *List, const CFE_SB_BufferLink_t *Node)
+{
+    /* Normally list nodes should never have NULL, buf if they do, do not follow it */
+    return (Node == NULL || Node == List);
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief For SB buffer tracking, reset link state to default
+ *
+ * This turns the node into a singleton/lone object (not in a list)
+ * or resets the head link to be empty.
+ */
+void CFE_SB_TrackingListReset(CFE_SB_BufferLink_t *Link);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief For SB buffer tracking, removes a node from a tracking list
+ *
+ * Extracts a single node from whatever list it is in.  After this the
+ * node becomes a singleton owned by the caller.  It may be put into
+ * another list or freed.
+ */
+void CFE_SB_TrackingListRemove(CFE_SB_BufferLink_t *Node);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief For SB buffer tracking, adds a node to a tracking list
+ *
+ * Extracts a single node from the list its in.  After this the
+ * node becomes a singleton owned by the caller.  It must put it
+ * in another list or free it.
+ */
+void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets the free list index for a message buffer allocation size
+ *
+ * Finds the smallest block size of the SB memory pool that can hold an allocation
+ * of the given size.  The free list with the same index keeps buffers of that size.
+ *
+ * \param[in] AllocSize Total size of the buffer, including the descriptor
+ * \returns Index of the free list, or #CFE_PLATFORM_ES_POOL_MAX_BUCKETS if no free list applies
+ */
+uint32 CFE_SB_GetBufFreeListIndex(size_t AllocSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Refills an empty message buffer free list from the SB memory pool
+ *
+ * Allocates up to #CFE_PLATFORM_SB_BUF_CACHE_REFILL buffers of the block size
+ * of the list, but no more than the list keeps and at least one, stopping at
+ * the first allocation that fails.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] ListIdx Index of the free list to refill
+ */
+void CFE_SB_RefillBufFreeList(uint32 ListIdx);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Allocates a new buffer descriptor from the SB memory pool.
+ *
+ * Requests a buffer from the SB buffer pool. The SB buffer pool is a
+ * preallocated block of memory of size #CFE_PLATFORM_SB_BUF_MEMORY_BYTES. It is used
+ * by the SB to dynamically allocate memory to hold the message and a buffer
+ * descriptor associated with the message during the sending of a message.
+ *
+ * The buffer is taken from the free list for its block size when possible,
+ * which is refilled from the pool in batches when it runs empty.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] MaxMsgSize Maximum message content size that the buffer must be capable of holding
+ * \returns Pointer to buffer descriptor, or NULL on failure.
+ */
+CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Returns a buffer to SB memory pool
+ *
+ * This function will return a block of memory back to the SB memory pool,
+ * so it can be re-used for a future message.  The buffer is kept on the free
+ * list for its block size instead, unless that list is already full.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ * \param[in] bd Pointer to descriptor to return
+ */
+void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Allocates the buffers of a producer buffer pool
+ *
+ * Gets NumBuffers buffers from the SB memory pool, clears them, and puts them on
+ * the free list of the producer pool.  If the SB memory pool runs out, the buffers
+ * already obtained are returned to it again.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[inout] PoolPtr    Producer pool to fill, must be empty
+ * \param[in]    MsgSize    Message content size that each buffer must be capable of holding
+ * \param[in]    NumBuffers Number of buffers to allocate
+ * \returns true if all buffers were allocated, false if none were
+ */
+bool CFE_SB_FillBufferPool(CFE_SB_BufferPool_t *PoolPtr, size_t MsgSize, uint16 NumBuffers);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Takes a buffer descriptor from a producer buffer pool
+ *
+ * The descriptor is initialized as by CFE_SB_GetBufferFromPool(), but the
+ * message content is left as it was when the buffer was last released.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[inout] PoolPtr Producer pool to take the buffer from
+ * \returns Pointer to buffer descriptor, or NULL if all buffers of the pool are in use.
+ */
+CFE_SB_BufferD_t *CFE_SB_GetBufferFromBufferPool(CFE_SB_BufferPool_t *PoolPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Deletes a producer buffer pool
+ *
+ * Returns the free buffers of the pool to the SB memory pool.  If some buffers
+ * are still in use, the slot is kept with a reserved ID, and each of them is
+ * returned to the SB memory pool by CFE_SB_ReturnBufferToPool() when its last
+ * reference is dropped.  The last one frees the slot.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[inout] PoolPtr Producer pool to delete, must be in use
+ */
+void CFE_SB_ReleaseBufferPool(CFE_SB_BufferPool_t *PoolPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Perform basic sanity check on the Zero Copy handle
+ *
+ * \param[in]  BufPtr pointer to the content buffer
+ * \param[out] BufDscPtr Will be set to actual buffer descriptor
+ *
+ * \returns CFE_SUCCESS if validation passed, or error code.
+ */
+int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Add a destination node
+ *
+ * Private function that will add a destination node to the linked list
+ *
+ * \note Assumes destination pointer is valid
+ *
+ * \param[in] RouteId The route ID to add destination node to
+ * \param[in] NewNode Pointer to the destination to add
+ */
+int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNode);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Remove a destination node
+ *
+ * Private function that will remove a destination node from the linked list
+ *
+ * \note Assumes destination pointer is valid and in route
+ *
+ * \param[in] RouteId      The route ID to remove destination node from
+ * \param[in] NodeToRemove Pointer to the destination to remove
+ */
+void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NodeToRemove);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Remove a destination
+ *
+ * Private function that will remove a destination by removing the node,
+ * returning the block, and decrementing counters.  The route is removed
+ * as well if this was its last destination.
+ *
+ * \note Assumes destination pointer is valid and in route
+ *
+ * \param[in] RouteId The route ID to remove destination from
+ * \param[in] DestPtr Pointer to the destination to remove
+ */
+void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Remove a route that has no destinations
+ *
+ * Does nothing if the route still has a destination.  Otherwise the route
+ * is removed so its message ID no longer counts against the limit of
+ * #CFE_PLATFORM_SB_MAX_MSG_IDS.  The route is reused once it is released
+ * by CFE_SB_ReleaseRetiredRouteData().
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] RouteId The route ID, must be valid
+ */
+void CFE_SB_RemoveRouteIfUnused(CFE_SBR_RouteId_t RouteId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Add a route for a message ID
+ *
+ * Adds the route through CFE_SBR_AddRoute(), first releasing removed routes
+ * so they can be reused, and updates the message ID counters.  The route is
+ * added without destinations.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in]  MsgId         Message ID of the route to add, must not have a route
+ * \param[out] CollisionsPtr Number of collisions (if not null)
+ *
+ * \return The route ID, or an invalid route ID if all routes are in use
+ */
+CFE_SBR_RouteId_t CFE_SB_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Add a destination
+ *
+ * Allocates and initializes a destination for the pipe, adds it to the route,
+ * and increments the subscription counters.  The caller must have checked that
+ * the pipe is not already a destination of the route, and that the route is not
+ * at #CFE_PLATFORM_SB_MAX_DEST_PER_PKT destinations.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] RouteId The route ID to add the destination to
+ * \param[in] PipeId  The pipe of the destination
+ * \param[in] MsgLim  Max number of messages of the route allowed on the pipe at any time
+ * \param[in] Scope   Local subscription or broadcasted to peers
+ *
+ * \return Pointer to the destination, or NULL if no destination could be allocated
+ */
+CFE_SB_DestinationD_t *CFE_SB_AddDest(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId, uint16 MsgLim, uint8 Scope);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Add the destinations of all matching mask subscriptions to a route
+ *
+ * Pipes that are already a destination of the route are skipped, as are all
+ * remaining mask subscriptions once the route is at #CFE_PLATFORM_SB_MAX_DEST_PER_PKT
+ * destinations or a destination cannot be allocated.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] RouteId The route ID, must be valid
+ */
+void CFE_SB_AddMaskDests(CFE_SBR_RouteId_t RouteId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Add routes for the message IDs matched by a mask subscription
+ *
+ * Adds a route, with the destinations of all matching mask subscriptions, for
+ * each valid message ID that the mask subscription matches and that has no
+ * route yet.  Transmitters then find every matching message ID through the
+ * normal route lookup and never need to check the mask subscriptions.
+ *
+ * Stops at the first route that cannot be added.  The routes added up to then
+ * are kept, the caller removes them along with the mask subscription.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] MaskSubPtr The mask subscription, already in the table
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ * \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+ * \retval #CFE_SB_MAX_MSGS_MET \copybrief CFE_SB_MAX_MSGS_MET
+ */
+int32 CFE_SB_AddMaskRoutes(const CFE_SB_MaskSub_t *MaskSubPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Remove all mask subscriptions of a pipe
+ *
+ * Only removes the mask subscriptions, not the destinations they added.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] PipeId The pipe ID
+ */
+void CFE_SB_RemoveMaskSubs(CFE_SB_PipeId_t PipeId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get destination pointer for PipeId from RouteId
+ *
+ * Private function that will return the destination pointer related to the
+ * given PipeId and RouteId if it exists
+ *
+ * \param[in] RouteId The route ID to search
+ * \param[in] PipeId  The pipe ID to search for
+ *
+ * \returns Then destination pointer for a match, NULL otherwise
+ */
+CFE_SB_DestinationD_t *CFE_SB_GetDestPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Publish a new destination snapshot for a route
+ *
+ * Builds an immutable copy of the current destination list of the route and
+ * makes it visible to transmitters in a single atomic store.  The previously
+ * published snapshot is retired, and released once no transmitter can still
+ * be reading it.
+ *
+ * If no snapshot can be allocated, a placeholder is published instead which
+ * directs transmitters to read the destination list under the SB lock.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] RouteId The route ID to publish
+ */
+void CFE_SB_PublishRouteSnapshot(CFE_SBR_RouteId_t RouteId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Fill in the route snapshot entry for a destination
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[out] RouteDestPtr Entry to fill in
+ * \param[in]  DestPtr      Destination descriptor, must be in a route
+ */
+void CFE_SB_FillRouteDest(CFE_SB_RouteDest_t *RouteDestPtr, CFE_SB_DestinationD_t *DestPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Retire a destination descriptor that was removed from a route
+ *
+ * The descriptor may still be referenced from a snapshot that a transmitter
+ * is reading, so it is only returned to the memory pool by a later call to
+ * CFE_SB_ReleaseRetiredRouteData().
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in] DestPtr Pointer to the destination, already removed from its route
+ */
+void CFE_SB_RetireDest(CFE_SB_DestinationD_t *DestPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Release retired route snapshots, destinations and routes
+ *
+ * Data is retired in the current route epoch.  Once no transmitter that
+ * started in the previous epoch is still reading routes, the data retired in
+ * that epoch is returned to the memory pool, removed routes from that epoch
+ * become available for reuse, and the epoch advances.  Transmitters starting
+ * meanwhile do not hold this up, so the release does not depend on a moment
+ * with no transmitter at all.  When no transmitter is reading, everything
+ * retired so far is released.
+ *
+ * @note This must only be invoked while holding the SB global lock
  */
-static inline bool CFE_SB_TrackingListIsEnd(const CFE_SB_BufferLink_t *List, const CFE_SB_BufferLink_t *Node)
-{
-    /* Normally list nodes should never have NULL, buf if they do, do not follow it */
-    return (Node == NULL || Node == List);
-}
+void CFE_SB_ReleaseRetiredRouteData(void);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief For SB buffer tracking, reset link state to default
+ * \brief Get the published destination snapshot for a route
  *
- * This turns the node into a singleton/lone object (not in a list)
- * or resets the head link to be empty.
+ * This may be invoked without holding the SB global lock, but only
+ * between CFE_SB_RouteReadBegin() and CFE_SB_RouteReadEnd().
+ *
+ * \param[in] RouteId The route ID, must be valid
+ *
+ * \returns Pointer to the snapshot, or NULL if the route has no destinations
  */
-void CFE_SB_TrackingListReset(CFE_SB_BufferLink_t *Link);
+const CFE_SB_RouteSnapshot_t *CFE_SB_GetRouteSnapshot(CFE_SBR_RouteId_t RouteId);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief For SB buffer tracking, removes a node from a tracking list
+ * \brief Begin reading route snapshots without the SB global lock
  *
- * Extracts a single node from whatever list it is in.  After this the
- * node becomes a singleton owned by the caller.  It may be put into
- * another list or freed.
+ * Snapshots and destinations retired after this call will not be released
+ * until the matching CFE_SB_RouteReadEnd().  The caller must not block on
+ * another task while in this state.
+ *
+ * \returns The route epoch the caller is registered in, to pass to CFE_SB_RouteReadEnd()
  */
-void CFE_SB_TrackingListRemove(CFE_SB_BufferLink_t *Node);
+uint32 CFE_SB_RouteReadBegin(void);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief For SB buffer tracking, adds a node to a tracking list
+ * \brief Finish reading route snapshots
  *
- * Extracts a single node from the list its in.  After this the
- * node becomes a singleton owned by the caller.  It must put it
- * in another list or free it.
+ * After this call the caller must not use any snapshot or destination
+ * pointer obtained since the matching CFE_SB_RouteReadBegin().
+ *
+ * \param[in] RouteEpoch The route epoch returned by the matching CFE_SB_RouteReadBegin()
  */
-void CFE_SB_TrackingListAdd(CFE_SB_BufferLink_t *List, CFE_SB_BufferLink_t *Node);
+void CFE_SB_RouteReadEnd(uint32 RouteEpoch);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief Allocates a new buffer descriptor from the SB memory pool.
+ * \brief Count a buffer queued to a destination
  *
- * Requests a buffer from the SB buffer pool. The SB buffer pool is a
- * preallocated block of memory of size #CFE_PLATFORM_SB_BUF_MEMORY_BYTES. It is used
- * by the SB to dynamically allocate memory to hold the message and a buffer
- * descriptor associated with the message during the sending of a message.
+ * Increments the destination buffer count unless it has already reached the
+ * message limit of the destination.  This is atomic, so it may be invoked
+ * without holding the SB global lock.
  *
- * @note This must only be invoked while holding the SB global lock
+ * \param[in] DestPtr Pointer to the destination
  *
- * \param[in] MaxMsgSize Maximum message content size that the buffer must be capable of holding
- * \returns Pointer to buffer descriptor, or NULL on failure.
+ * \returns true if the count was incremented, false if the limit was reached
  */
-CFE_SB_BufferD_t *CFE_SB_GetBufferFromPool(size_t MaxMsgSize);
+bool CFE_SB_IncrDestBuffCount(CFE_SB_DestinationD_t *DestPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief Returns a buffer to SB memory pool
+ * \brief Count a buffer removed from a destination
  *
- * This function will return a block of memory back to the SB memory pool,
- * so it can be re-used for a future message
+ * Decrements the destination buffer count, if it is not already zero.
+ * This is atomic, so it may be invoked without holding the SB global lock.
  *
- * @note This must only be invoked while holding the SB global lock
- * \param[in] bd Pointer to descriptor to return
+ * \param[in] DestPtr Pointer to the destination
  */
-void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
+void CFE_SB_DecrDestBuffCount(CFE_SB_DestinationD_t *DestPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief Perform basic sanity check on the Zero Copy handle
+ * \brief Count a buffer removed from the destination of a pipe on a route
  *
- * \param[in]  BufPtr pointer to the content buffer
- * \param[out] BufDscPtr Will be set to actual buffer descriptor
+ * Finds the destination for the pipe in the published snapshot of the route,
+ * and decrements its buffer count.  If the route has no snapshot, the
+ * destination list is searched while holding the SB global lock instead.
+ * Nothing is done if the pipe is no longer subscribed.
  *
- * \returns CFE_SUCCESS if validation passed, or error code.
+ * @note This must NOT be invoked while holding the SB global lock
+ *
+ * \param[in] RouteId The route the buffer was sent on
+ * \param[in] PipeId  The pipe the buffer was counted for
  */
-int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr);
+void CFE_SB_DecrRouteDestBuffCount(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief Add a destination node
- *
- * Private function that will add a destination node to the linked list
+ * \brief Count a buffer queued to a pipe
  *
- * \note Assumes destination pointer is valid
+ * Increments the current depth of the pipe and updates its peak depth.
+ * This is atomic, so it may be invoked without holding the SB global lock.
  *
- * \param[in] RouteId The route ID to add destination node to
- * \param[in] NewNode Pointer to the destination to add
+ * \param[in] PipeDscPtr Pointer to the pipe descriptor
+ * \returns The depth of the pipe, counting the buffer
  */
-int32 CFE_SB_AddDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NewNode);
+uint16 CFE_SB_IncrPipeQueueDepth(CFE_SB_PipeD_t *PipeDscPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief Remove a destination node
+ * \brief Count a buffer removed from a pipe
  *
- * Private function that will remove a destination node from the linked list
- *
- * \note Assumes destination pointer is valid and in route
+ * Decrements the current depth of the pipe, if it is not already zero.
+ * This is atomic, so it may be invoked without holding the SB global lock.
  *
- * \param[in] RouteId      The route ID to remove destination node from
- * \param[in] NodeToRemove Pointer to the destination to remove
+ * \param[in] PipeDscPtr Pointer to the pipe descriptor
  */
-void CFE_SB_RemoveDestNode(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *NodeToRemove);
+void CFE_SB_DecrPipeQueueDepth(CFE_SB_PipeD_t *PipeDscPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief Remove a destination
- *
- * Private function that will remove a destination by removing the node,
- * returning the block, and decrementing counters
- *
- * \note Assumes destination pointer is valid and in route
+ * \brief Get the current time for the pipe latency
  *
- * \param[in] RouteId The route ID to remove destination from
- * \param[in] DestPtr Pointer to the destination to remove
+ * \returns The PSP time in microseconds
  */
-void CFE_SB_RemoveDest(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t *DestPtr);
+int64 CFE_SB_GetLatencyTime(void);
 
 /*---------------------------------------------------------------------------------------*/
 /**
- * \brief Get destination pointer for PipeId from RouteId
+ * \brief Count the latency of a buffer received from a pipe
  *
- * Private function that will return the destination pointer related to the
- * given PipeId and RouteId if it exists
+ * Adds the time since the buffer was transmitted to the latency histogram of the pipe.
  *
- * \param[in] RouteId The route ID to search
- * \param[in] PipeId  The pipe ID to search for
+ * @note This must only be invoked while holding the SB global lock
  *
- * \returns Then destination pointer for a match, NULL otherwise
+ * \param[inout] PipeDscPtr  Pointer to the pipe descriptor
+ * \param[in]    BufDscPtr   Buffer descriptor that was received
+ * \param[in]    ReceiveTime Time of the receive, as returned by CFE_SB_GetLatencyTime()
  */
-CFE_SB_DestinationD_t *CFE_SB_GetDestPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_PipeId_t PipeId);
+void CFE_SB_RecordPipeLatency(CFE_SB_PipeD_t *PipeDscPtr, const CFE_SB_BufferD_t *BufDscPtr, int64 ReceiveTime);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -1038,6 +1897,40 @@ CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveTxn_Init(CFE_SB_ReceiveTxn_State_t *Txn
  */
 void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t PipeId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Initialize a receive transaction on a set of pipes
+ *
+ * Same as CFE_SB_ReceiveTxn_Init(), but the transaction can hold up to
+ * CFE_PLATFORM_SB_MAX_PIPES_PER_SET pipes, which are added via CFE_SB_ReceiveTxn_AddPipeId().
+ *
+ * \param[out] TxnPtr    Transaction object to initialize
+ * \param[in]  RefMemPtr Pointer to user object/buffer being received (opaque)
+ */
+CFE_SB_MessageTxn_State_t *CFE_SB_ReceiveSetTxn_Init(CFE_SB_ReceiveSetTxn_State_t *TxnPtr, const void *RefMemPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Adds a Pipe ID to read for a receive transaction
+ *
+ * Pipes are read in the order they are added.  As with CFE_SB_ReceiveTxn_SetPipeId(),
+ * this releases the buffers from the previous receive on the pipe.
+ *
+ * \param[inout] TxnPtr  Transaction object
+ * \param[in]    PipeId  Pipe ID to read from
+ */
+void CFE_SB_ReceiveTxn_AddPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeId_t PipeId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Reads a buffer descriptor from the queue or ring of a pipe
+ *
+ * \param[inout] ContextPtr Pipe entry within transaction, the OsStatus is updated
+ * \param[out]   BufDscPtrP Buffer descriptor that was read, NULL if none or if the read was bad
+ * \param[in]    OsTimeout  OS_CHECK, OS_PEND, or a timeout in milliseconds
+ */
+void CFE_SB_ReceiveTxn_ReadPipe(CFE_SB_PipeSetEntry_t *ContextPtr, CFE_SB_BufferD_t **BufDscPtrP, int32 OsTimeout);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Pipe handler function for receive transactions
@@ -1071,6 +1964,21 @@ void CFE_SB_ReceiveTxn_SetPipeId(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeI
  */
 bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Pipe handler function for receive transactions on a set of pipes
+ *
+ * Polls the pipe without waiting.  This is only used via CFE_SB_MessageTxn_ProcessPipes(),
+ * but declared here so it can be unit tested.
+ *
+ * \param[inout] TxnPtr     Transaction object
+ * \param[in]    ContextPtr Pointer to pipe entry within transaction
+ * \param[inout] Arg        Opaque argument for API, should be a CFE_SB_ReceiveSetTxn_Ready_t*
+ * \returns true to go on to the next pipe if this one is empty, false otherwise
+ */
+bool CFE_SB_ReceiveSetTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr,
+                                      void *Arg);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Executes a receive transaction
@@ -1084,6 +1992,71 @@ bool CFE_SB_ReceiveTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pip
  */
 const CFE_SB_Buffer_t *CFE_SB_ReceiveTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Executes a receive transaction on a set of pipes
+ *
+ * Returns a buffer from the first pipe of the set that is not empty.  If all of them are
+ * empty, this waits according to the transaction timeout for a transmit to any of them,
+ * on the semaphore of a pipe set waiter rather than on any single pipe.
+ *
+ * \param[inout] TxnPtr         Transaction object
+ * \param[out]   ReadyPipeIdPtr Set to the pipe the buffer was read from, if not NULL
+ * \returns Pointer to buffer that was read
+ * \retval  NULL if no message was read (e.g. if a timeout occurred or polling empty queues)
+ */
+const CFE_SB_Buffer_t *CFE_SB_ReceiveSetTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr,
+                                                    CFE_SB_PipeId_t *          ReadyPipeIdPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Executes a batched receive transaction
+ *
+ * The first buffer is read exactly as CFE_SB_ReceiveTxn_Execute() does, including any
+ * wait according to the transaction timeout.  Once that succeeds, any further buffers that
+ * are already queued on the pipe are drained without waiting, and the references for all
+ * of them are stored in the pipe descriptor under a single acquisition of the SB lock.
+ *
+ * All references are held until the next receive on the same pipe, just as the single
+ * buffer returned by CFE_SB_ReceiveTxn_Execute() is.
+ *
+ * Buffers which fail verification are not returned, but remain referenced by the pipe
+ * descriptor until the next receive, at which point they are dropped.
+ *
+ * \param[inout] TxnPtr   Transaction object
+ * \param[out]   BufArray Array to store the received buffer pointers
+ * \param[in]    MaxCount Size of BufArray, limited to CFE_PLATFORM_SB_MAX_RECEIVE_BATCH
+ * \returns Number of buffers stored in BufArray, which is 0 if no message was read
+ */
+uint32 CFE_SB_ReceiveTxn_ExecuteBatch(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t **BufArray, uint32 MaxCount);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Checks the content of a received buffer
+ *
+ * If the transaction represents the endpoint, this invokes the verification action on the
+ * buffer content.  Otherwise all buffers are considered acceptable.
+ *
+ * \param[in] TxnPtr    Transaction object
+ * \param[in] BufDscPtr Buffer descriptor that was read from the pipe
+ * \returns true if the buffer may be passed to the receiver
+ */
+bool CFE_SB_ReceiveTxn_IsAcceptable(const CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Releases all buffers held by a pipe from previous receive calls
+ *
+ * Decrements the use count of the buffers that were returned by the last call to
+ * CFE_SB_ReceiveBuffer() or CFE_SB_ReceiveBufferBatch() on this pipe, which frees
+ * them if no other references remain.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[inout] PipeDscPtr Pipe descriptor
+ */
+void CFE_SB_ReleasePipeBuffers(CFE_SB_PipeD_t *PipeDscPtr);
+
 /*
  * Transmit Transaction implementation/helper functions
  * These functions are specific to the transmit-side operation
@@ -1133,6 +2106,9 @@ void CFE_SB_TransmitTxn_SetupFromMsg(CFE_SB_MessageTxn_State_t *TxnPtr, const CF
  * If no destinations are found, then this sets the transaction status to generate a
  * NO SUBSCRIBERS event, but it does not actually send the event from here.
  *
+ * The destinations are read from the published route snapshot, without holding the SB
+ * global lock.  The lock is only taken afterward to update the buffer tracking.
+ *
  * \sa CFE_SB_TransmitTxn_ReportEvents()
  *
  * \note This also increments the buffer use count for every destination found, in anticipation
@@ -1145,6 +2121,92 @@ void CFE_SB_TransmitTxn_SetupFromMsg(CFE_SB_MessageTxn_State_t *TxnPtr, const CF
  */
 void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Collect the destinations of a transmit transaction
+ *
+ * First step of CFE_SB_TransmitTxn_FindDestinations().  Looks up the route, adding it if the
+ * message ID only has mask subscribers, applies the sequence count if the transaction is an
+ * endpoint, and adds each destination of the route via CFE_SB_TransmitTxn_AddDestination().
+ *
+ * The sending application is only looked up if the route has a destination with the
+ * IGNOREMINE option.  The result is kept in the caller's variable, so that several
+ * transactions from the same sender need at most one lookup.
+ *
+ * \note This must be invoked WITHOUT holding the SB global lock
+ *
+ * \param[inout] TxnPtr    Transaction object
+ * \param[inout] BufDscPtr Buffer descriptor that is pending broadcast
+ * \param[inout] AppIdPtr  The sending application, CFE_ES_APPID_UNDEFINED until looked up
+ */
+void CFE_SB_TransmitTxn_ResolveDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr,
+                                            CFE_ES_AppId_t *AppIdPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Update the buffer tracking for a transmit transaction
+ *
+ * Second step of CFE_SB_TransmitTxn_FindDestinations().  Increments the buffer use count
+ * for every destination that will be written, and moves the buffer to the in-transit list.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[inout] TxnPtr    Transaction object
+ * \param[inout] BufDscPtr Buffer descriptor that is pending broadcast
+ */
+void CFE_SB_TransmitTxn_TrackBuffer(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Apply the message origination action for a transmit transaction
+ *
+ * Last step of CFE_SB_TransmitTxn_FindDestinations().  If the transaction is an endpoint,
+ * invokes the mission-specific origination action on the message content.
+ *
+ * \param[inout] TxnPtr    Transaction object
+ * \param[inout] BufDscPtr Buffer descriptor that is pending broadcast
+ */
+void CFE_SB_TransmitTxn_Originate(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_BufferD_t *BufDscPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Add a single destination to a transmit transaction
+ *
+ * Helper function for CFE_SB_TransmitTxn_FindDestinations().  If the destination is active
+ * and not excluded by the IGNOREMINE option, it is added to the pipe set of the transaction
+ * and the destination/pipe depth accounting is updated.  If the destination is already at
+ * its message limit, the pipe set entry is marked with a pending MSGID LIMIT event.
+ *
+ * The caller must ensure there is room for another entry in the pipe set.
+ *
+ * \note This does not need the SB global lock, as all updates are atomic.  It does not
+ * increment the buffer use count; that is done by the caller for each entry without a
+ * pending event.
+ *
+ * \param[inout] TxnPtr       Transaction object
+ * \param[in]    RouteDestPtr Route snapshot entry of the destination to add
+ * \param[in]    AppId        The sending application, only used if the destination has IgnoreMine set
+ * \param[in]    TransmitTime Time of the transmit, as returned by CFE_SB_GetLatencyTime()
+ */
+void CFE_SB_TransmitTxn_AddDestination(CFE_SB_MessageTxn_State_t *TxnPtr, const CFE_SB_RouteDest_t *RouteDestPtr,
+                                       CFE_ES_AppId_t AppId, int64 TransmitTime);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Check the delivery rate of a destination for a message being transmitted
+ *
+ * Helper function for CFE_SB_TransmitTxn_AddDestination().  Applies the decimation and
+ * then the minimum interval set by CFE_SB_SetDeliveryRate(), and updates their state if
+ * the message is to be delivered.  Destinations without a delivery rate get everything.
+ *
+ * \note This does not need the SB global lock, as all updates are atomic.
+ *
+ * \param[inout] DestPtr      Destination descriptor
+ * \param[in]    TransmitTime Time of the transmit, as returned by CFE_SB_GetLatencyTime()
+ * \returns true if the message should be delivered to the destination
+ */
+bool CFE_SB_TransmitTxn_IsDeliveryDue(CFE_SB_DestinationD_t *DestPtr, int64 TransmitTime);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Pipe handler function for transmit transactions
@@ -1162,6 +2224,20 @@ void CFE_SB_TransmitTxn_FindDestinations(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_
  */
 bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_PipeSetEntry_t *ContextPtr, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Validate a buffer for a transmit transaction
+ *
+ * Checks that the buffer is a valid zero copy buffer, and saves the routing parameters
+ * of the transaction into its descriptor.  On failure, the transaction status is set.
+ *
+ * \param[inout] TxnPtr    Transaction object
+ * \param[inout] BufPtr    Buffer object that is pending to be broadcast
+ *
+ * \returns Pointer to the buffer descriptor, or NULL if the buffer is not valid
+ */
+CFE_SB_BufferD_t *CFE_SB_TransmitTxn_SetupBuffer(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t *BufPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Executes the transmit transaction
@@ -1183,6 +2259,24 @@ bool CFE_SB_TransmitTxn_PipeHandler(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Pi
  */
 void CFE_SB_TransmitTxn_Execute(CFE_SB_MessageTxn_State_t *TxnPtr, CFE_SB_Buffer_t *BufPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Broadcast a set of buffers to their destinations
+ *
+ * Equivalent to CFE_SB_TransmitTxn_Execute() on each of the transactions in turn, but
+ * the SB global lock is only taken once for all buffer tracking, and once to release
+ * the buffers afterward.  Writes are grouped by destination pipe, and the order of the
+ * buffers written to each pipe follows the order of the set.
+ *
+ * All buffers must already have been validated via CFE_SB_TransmitTxn_SetupBuffer().
+ * Every buffer in the set is consumed by this call.
+ *
+ * \param[inout] TxnSet    Array of transaction objects
+ * \param[inout] BufDscSet Array of buffer descriptors, one per transaction
+ * \param[in]    NumTxns   Number of transactions, at most #CFE_SB_TRANSMIT_BATCH_SIZE
+ */
+void CFE_SB_TransmitTxn_ExecuteBatch(CFE_SB_TransmitTxn_State_t *TxnSet, CFE_SB_BufferD_t **BufDscSet, uint32 NumTxns);
+
 /*
  * Software Bus Message Handler Function prototypes
  */
@@ -1302,6 +2396,28 @@ int32 CFE_SB_WritePipeInfoCmd(const CFE_SB_WritePipeInfoCmd_t *data);
  */
 int32 CFE_SB_WriteMapInfoCmd(const CFE_SB_WriteMapInfoCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Command Message Handler function
+ *
+ * SB internal function to handle processing of 'Write Pipe Latency' Cmd
+ *
+ * \param[in] data Pointer to command structure
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_WritePipeLatencyCmd(const CFE_SB_WritePipeLatencyCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Command Message Handler function
+ *
+ * SB internal function to handle processing of 'Reset Pipe Latency' Cmd
+ *
+ * \param[in] data Pointer to command structure
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_ResetPipeLatencyCmd(const CFE_SB_ResetPipeLatencyCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Command Message Handler function
@@ -1450,6 +2566,19 @@ static inline bool CFE_SB_PipeDescIsMatch(const CFE_SB_PipeD_t *PipeDscPtr, CFE_
     return (PipeDscPtr != NULL && CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->PipeId, PipeID));
 }
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check if a mask subscription matches a message ID
+ *
+ * @param[in]   MaskSubPtr  pointer to the mask subscription, must be in use
+ * @param[in]   MsgId       the message ID to check
+ * @returns true if the message ID matches the mask subscription
+ */
+static inline bool CFE_SB_MaskSubIsMatch(const CFE_SB_MaskSub_t *MaskSubPtr, CFE_SB_MsgId_t MsgId)
+{
+    return ((CFE_SB_MsgIdToValue(MsgId) & MaskSubPtr->Mask) == MaskSubPtr->MsgIdValue);
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Checks if a table slot is used or not
@@ -1462,6 +2591,62 @@ static inline bool CFE_SB_PipeDescIsMatch(const CFE_SB_PipeD_t *PipeDscPtr, CFE_
  */
 bool CFE_SB_CheckPipeDescSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Locate the producer buffer pool table entry correlating with a given pool ID.
+ *
+ * As with CFE_SB_LocatePipeDescByID(), this only returns where the ID should
+ * reside.  The CFE_SB_BufferPoolIsMatch() function must be used to confirm
+ * that the returned entry is a positive match for the given ID.
+ *
+ * @param[in]   PoolId   the pool ID to locate
+ * @return pointer to pool table entry for the given pool ID, or NULL if out of range
+ */
+CFE_SB_BufferPool_t *CFE_SB_LocateBufferPoolByID(CFE_SB_BufferPoolId_t PoolId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check if a producer buffer pool table entry is in use or free/empty
+ *
+ * A deleted pool that still has buffers in use has a reserved ID, so it is in use
+ * but does not match any valid pool ID.
+ *
+ * @param[in]   PoolPtr   pointer to pool table entry
+ * @returns true if the entry is in use/configured, or false if it is free/empty
+ */
+static inline bool CFE_SB_BufferPoolIsUsed(const CFE_SB_BufferPool_t *PoolPtr)
+{
+    return CFE_RESOURCEID_TEST_DEFINED(PoolPtr->PoolId);
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check if a producer buffer pool table entry is a match for the given pool ID
+ *
+ * As this dereferences fields within the entry, global data must be
+ * locked prior to invoking this function.  The pointer may be NULL.
+ *
+ * @param[in]   PoolPtr   pointer to pool table entry
+ * @param[in]   PoolId    expected pool ID
+ * @returns true if the entry matches the given pool ID
+ */
+static inline bool CFE_SB_BufferPoolIsMatch(const CFE_SB_BufferPool_t *PoolPtr, CFE_SB_BufferPoolId_t PoolId)
+{
+    return (PoolPtr != NULL && CFE_RESOURCEID_TEST_EQUAL(PoolPtr->PoolId, PoolId));
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Checks if a producer buffer pool table slot is used or not
+ *
+ * Helper for allocating IDs,
+ * Used in conjunction with CFE_ResourceId_FindNext().
+ *
+ * @param CheckId generic slot ID to test
+ * @returns true if slot is currently in use/unavailable
+ */
+bool CFE_SB_CheckBufferPoolSlotUsed(CFE_ResourceId_t CheckId);
+
 /*
  * Helper functions for background file write requests (callbacks)
  */
@@ -1482,6 +2667,7 @@ bool CFE_SB_WriteMsgMapInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffe
 void CFE_SB_CollectRouteInfo(CFE_SBR_RouteId_t RouteId, void *ArgPtr);
 bool CFE_SB_WriteRouteInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
 bool CFE_SB_WritePipeInfoDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+bool CFE_SB_WritePipeLatencyDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
 void CFE_SB_BackgroundFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
                                        size_t BlockSize, size_t Position);
 
@@ -1491,4 +2677,6 @@ void CFE_SB_BackgroundFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event
 
 extern CFE_SB_Global_t CFE_SB_Global;
 
+extern const size_t CFE_SB_MemPoolDefSize[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+
 #endif /* CFE_SB_PRIV_H */
@@ -0,0 +1,531 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/******************************************************************************
+** File: cfe_sb_ring.c
+**
+** Purpose:
+**      This file contains the ring buffer used in place of the OSAL queue
+**      by pipes created with CFE_SB_PIPEOPTS_RING.
+**
+**      Writers claim a slot by advancing the write position with a compare
+**      and exchange, and then publish the entry through the sequence number
+**      of the slot, so any number of tasks may transmit to the pipe.  There
+**      is only ever one reader, the task that receives from the pipe.  The
+**      reader only waits on the wakeup semaphore when the ring is empty, and
+**      writers only give the semaphore when the reader is waiting.
+**
+**      Pipes created with CFE_SB_PIPEOPTS_PRIORITY have a second ring for
+**      the urgent lane, sharing the wakeup semaphore of the normal ring.  The
+**      reader parks on both rings, so a write to either one wakes it.
+**
+**      A ring with a wakeup threshold lets writes pile up while the reader is
+**      parked, and only wakes it once enough have arrived.  The first write
+**      that is held back gives the semaphore without unparking the reader,
+**      which then waits no longer than the wakeup delay for the rest, so held
+**      back writes are never delayed for longer than that.  A reader with
+**      nothing held back waits for its whole timeout.
+**
+******************************************************************************/
+
+/*
+**  Include Files
+*/
+
+#include "cfe_sb_module_all.h"
+#include "cfe_core_atomic.h"
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SB_PipeRing_GetNumSlots(uint16 Depth)
+{
+    uint32 NumSlots;
+
+    NumSlots = 1;
+    while (NumSlots < Depth)
+    {
+        NumSlots <<= 1;
+    }
+
+    return NumSlots;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeRing_Init(CFE_SB_PipeRing_t *RingPtr, uint32 NumSlots, osal_id_t WakeupSemId)
+{
+    uint32 i;
+
+    RingPtr->WakeupSemId     = WakeupSemId;
+    RingPtr->Mask            = NumSlots - 1;
+    RingPtr->WritePos        = 0;
+    RingPtr->ReadPos         = 0;
+    RingPtr->ReaderParked    = 0;
+    RingPtr->WakeupThreshold = 0;
+    RingPtr->WakeupDelay     = 0;
+    RingPtr->ParkedWrites    = 0;
+    RingPtr->UrgentLane      = NULL;
+
+    /* Each slot starts out free for the write position that maps to it on the first lap */
+    for (i = 0; i < NumSlots; ++i)
+    {
+        RingPtr->Slots[i].Seq       = i;
+        RingPtr->Slots[i].BufDscPtr = NULL;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeRing_WakeReader(CFE_SB_PipeRing_t *RingPtr)
+{
+    uint32 Threshold;
+    uint32 HeldWrites;
+
+    Threshold  = CFE_ATOMIC_LOAD(&RingPtr->WakeupThreshold);
+    HeldWrites = 0;
+
+    if (Threshold > 1)
+    {
+        HeldWrites = CFE_ATOMIC_ADD_FETCH(&RingPtr->ParkedWrites, 1);
+    }
+
+    if (HeldWrites == 1)
+    {
+        /* Only gets the reader to start its wakeup delay, it stays parked */
+        OS_BinSemGive(RingPtr->WakeupSemId);
+    }
+    else if ((Threshold <= 1 || HeldWrites >= Threshold) && CFE_ATOMIC_EXCHANGE(&RingPtr->ReaderParked, 0) != 0)
+    {
+        OS_BinSemGive(RingPtr->WakeupSemId);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_PipeRing_IsHolding(CFE_SB_PipeRing_t *RingPtr)
+{
+    /* Writes are held back until a writer unparks the reader from one of the lanes */
+    return (CFE_ATOMIC_LOAD(&RingPtr->WakeupDelay) != 0 && CFE_ATOMIC_LOAD(&RingPtr->ParkedWrites) != 0 &&
+            CFE_ATOMIC_LOAD(&RingPtr->ReaderParked) != 0 &&
+            (RingPtr->UrgentLane == NULL || CFE_ATOMIC_LOAD(&RingPtr->UrgentLane->ReaderParked) != 0));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_PipeRing_Write(CFE_SB_PipeRing_t *RingPtr, CFE_SB_BufferD_t *BufDscPtr)
+{
+    CFE_SB_PipeRingSlot_t *SlotPtr;
+    CFE_SB_PipeRingSlot_t *ClaimedSlotPtr;
+    uint32                 Pos;
+    uint32                 Seq;
+    bool                   IsFull;
+
+    ClaimedSlotPtr = NULL;
+    IsFull         = false;
+
+    Pos = CFE_ATOMIC_LOAD(&RingPtr->WritePos);
+    while (ClaimedSlotPtr == NULL && !IsFull)
+    {
+        SlotPtr = &RingPtr->Slots[Pos & RingPtr->Mask];
+        Seq     = CFE_ATOMIC_LOAD(&SlotPtr->Seq);
+
+        if (Seq == Pos)
+        {
+            /* Slot is free for this position, try to claim it (reloads Pos if another writer was first) */
+            if (CFE_ATOMIC_COMPARE_EXCHANGE(&RingPtr->WritePos, &Pos, Pos + 1))
+            {
+                ClaimedSlotPtr = SlotPtr;
+            }
+        }
+        else if ((int32)(Seq - Pos) < 0)
+        {
+            /* Slot still holds the entry from the previous lap, so the reader is a full ring behind */
+            IsFull = true;
+        }
+        else
+        {
+            /* Another writer already claimed this position */
+            Pos = CFE_ATOMIC_LOAD(&RingPtr->WritePos);
+        }
+    }
+
+    if (IsFull)
+    {
+        return OS_QUEUE_FULL;
+    }
+
+    ClaimedSlotPtr->BufDscPtr = BufDscPtr;
+    CFE_ATOMIC_STORE(&ClaimedSlotPtr->Seq, Pos + 1);
+
+    /* Only bother the OS if the reader actually went to sleep */
+    if (CFE_ATOMIC_LOAD(&RingPtr->ReaderParked) != 0)
+    {
+        CFE_SB_PipeRing_WakeReader(RingPtr);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferD_t *CFE_SB_PipeRing_Read(CFE_SB_PipeRing_t *RingPtr)
+{
+    CFE_SB_PipeRingSlot_t *SlotPtr;
+    CFE_SB_BufferD_t *     BufDscPtr;
+    uint32                 Pos;
+
+    BufDscPtr = NULL;
+    Pos       = RingPtr->ReadPos;
+    SlotPtr   = &RingPtr->Slots[Pos & RingPtr->Mask];
+
+    if (CFE_ATOMIC_LOAD(&SlotPtr->Seq) == (Pos + 1))
+    {
+        BufDscPtr = SlotPtr->BufDscPtr;
+
+        /* Hand the slot back to the writers, for the position that maps to it on the next lap */
+        CFE_ATOMIC_STORE(&SlotPtr->Seq, Pos + RingPtr->Mask + 1);
+        RingPtr->ReadPos = Pos + 1;
+    }
+
+    return BufDscPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferD_t *CFE_SB_PipeRing_ReadLanes(CFE_SB_PipeRing_t *RingPtr)
+{
+    CFE_SB_BufferD_t *BufDscPtr;
+
+    BufDscPtr = NULL;
+
+    /* The urgent lane always goes first */
+    if (RingPtr->UrgentLane != NULL)
+    {
+        BufDscPtr = CFE_SB_PipeRing_Read(RingPtr->UrgentLane);
+    }
+
+    if (BufDscPtr == NULL)
+    {
+        BufDscPtr = CFE_SB_PipeRing_Read(RingPtr);
+    }
+
+    return BufDscPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ * Not invoked outside of this unit
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeRing_SetParked(CFE_SB_PipeRing_t *RingPtr, uint32 Parked)
+{
+    CFE_ATOMIC_STORE(&RingPtr->ReaderParked, Parked);
+
+    if (RingPtr->UrgentLane != NULL)
+    {
+        CFE_ATOMIC_STORE(&RingPtr->UrgentLane->ReaderParked, Parked);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_PipeRing_Put(CFE_SB_PipeId_t PipeId, CFE_SB_BufferD_t *BufDscPtr, bool IsUrgent, uint16 QueueDepth)
+{
+    CFE_SB_PipeD_t *   PipeDscPtr;
+    CFE_SB_PipeRing_t *RingPtr;
+    int32              OsStatus;
+
+    OsStatus   = OS_ERR_INVALID_ID;
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        /*
+         * Registering as a user first keeps CFE_SB_PipeRing_Detach() from freeing the ring,
+         * the pipe is checked again below as it may have been deleted in the meantime
+         */
+        CFE_ATOMIC_ADD_FETCH(&PipeDscPtr->RingUsers, 1);
+
+        RingPtr = CFE_ATOMIC_LOAD(&PipeDscPtr->Ring);
+        if (RingPtr != NULL && CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+        {
+            if (IsUrgent && RingPtr->UrgentLane != NULL)
+            {
+                RingPtr = RingPtr->UrgentLane;
+            }
+
+            /* The ring has a power of two slots, which must not let in more than the depth of the pipe */
+            if (QueueDepth > PipeDscPtr->MaxQueueDepth)
+            {
+                OsStatus = OS_QUEUE_FULL;
+            }
+            else
+            {
+                OsStatus = CFE_SB_PipeRing_Write(RingPtr, BufDscPtr);
+            }
+        }
+
+        CFE_ATOMIC_SUB_FETCH(&PipeDscPtr->RingUsers, 1);
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_PipeRing_Get(CFE_SB_PipeId_t PipeId, CFE_SB_BufferD_t **BufDscPtrP, int32 OsTimeout)
+{
+    CFE_SB_PipeD_t *   PipeDscPtr;
+    CFE_SB_PipeRing_t *RingPtr;
+    int32              OsStatus;
+    int32              WaitTimeout;
+    int32              DelayMsec;
+    bool               IsDone;
+    bool               IsHeld;
+
+    *BufDscPtrP = NULL;
+    OsStatus    = OS_ERR_INVALID_ID;
+    PipeDscPtr  = CFE_SB_LocatePipeDescByID(PipeId);
+
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        /*
+         * Registering as a user first keeps CFE_SB_PipeRing_Detach() from freeing the ring,
+         * the pipe is checked again below as it may have been deleted in the meantime
+         */
+        CFE_ATOMIC_ADD_FETCH(&PipeDscPtr->RingUsers, 1);
+
+        IsDone = false;
+        IsHeld = false;
+        while (!IsDone)
+        {
+            RingPtr = CFE_ATOMIC_LOAD(&PipeDscPtr->Ring);
+            if (RingPtr == NULL || !CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+            {
+                /* Pipe was deleted, possibly while waiting */
+                OsStatus = OS_ERR_INVALID_ID;
+                IsDone   = true;
+            }
+            else
+            {
+                /* While writes are held back, the reader stays parked until the wakeup delay is over */
+                if (!IsHeld)
+                {
+                    *BufDscPtrP = CFE_SB_PipeRing_ReadLanes(RingPtr);
+
+                    if (*BufDscPtrP == NULL && OsTimeout != OS_CHECK)
+                    {
+                        /*
+                         * Tell the writers to wake this task, then check the rings once more
+                         * so an entry written just before the flag was set is not missed.
+                         */
+                        CFE_ATOMIC_STORE(&RingPtr->ParkedWrites, 0);
+                        CFE_SB_PipeRing_SetParked(RingPtr, 1);
+                        *BufDscPtrP = CFE_SB_PipeRing_ReadLanes(RingPtr);
+                    }
+                }
+
+                if (*BufDscPtrP != NULL)
+                {
+                    CFE_SB_PipeRing_SetParked(RingPtr, 0);
+                    OsStatus = OS_SUCCESS;
+                    IsDone   = true;
+                }
+                else if (OsTimeout == OS_CHECK)
+                {
+                    OsStatus = OS_QUEUE_EMPTY;
+                    IsDone   = true;
+                }
+                else
+                {
+                    /* With nothing held back there is no reason to wake up before the timeout */
+                    WaitTimeout = OsTimeout;
+                    DelayMsec   = (int32)CFE_ATOMIC_LOAD(&RingPtr->WakeupDelay);
+                    if (IsHeld && (OsTimeout == OS_PEND || OsTimeout > DelayMsec))
+                    {
+                        WaitTimeout = DelayMsec;
+                    }
+
+                    if (WaitTimeout == OS_PEND)
+                    {
+                        OsStatus = OS_BinSemTake(RingPtr->WakeupSemId);
+                    }
+                    else
+                    {
+                        OsStatus = OS_BinSemTimedWait(RingPtr->WakeupSemId, WaitTimeout);
+                    }
+
+                    if (OsStatus == OS_SEM_TIMEOUT && (IsHeld || WaitTimeout != OsTimeout))
+                    {
+                        /*
+                         * End of the wakeup delay, which is charged against the timeout of the
+                         * caller.  If that is used up as well, the held back entries are still
+                         * picked up, with a final check of the rings.
+                         */
+                        if (OsTimeout != OS_PEND)
+                        {
+                            OsTimeout -= WaitTimeout;
+                        }
+
+                        OsStatus = OS_SUCCESS;
+                        IsHeld   = false;
+                    }
+                    else if (OsStatus == OS_SEM_TIMEOUT)
+                    {
+                        OsStatus = OS_QUEUE_TIMEOUT;
+                        IsDone   = true;
+                    }
+                    else if (OsStatus != OS_SUCCESS)
+                    {
+                        IsDone = true;
+                    }
+                    else
+                    {
+                        /*
+                         * Go around again.  A wakeup from the first held back write starts the
+                         * wakeup delay.  Any other wakeup may be left over from a writer that
+                         * saw the flag from an earlier wait, so the ring may still be empty.
+                         */
+                        IsHeld = (!IsHeld && CFE_SB_PipeRing_IsHolding(RingPtr));
+                    }
+                }
+            }
+        }
+
+        CFE_ATOMIC_SUB_FETCH(&PipeDscPtr->RingUsers, 1);
+    }
+
+    return OsStatus;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_PipeRing_t *CFE_SB_PipeRing_Detach(CFE_SB_PipeD_t *PipeDscPtr)
+{
+    CFE_SB_PipeRing_t *RingPtr;
+    OS_time_t          StartTime;
+    OS_time_t          TimeNow;
+    int64              WaitMsec;
+
+    RingPtr = CFE_ATOMIC_EXCHANGE(&PipeDscPtr->Ring, NULL);
+
+    if (RingPtr != NULL)
+    {
+        /* The reader may be waiting on the ring, it will see that the ring is gone once woken */
+        OS_BinSemGive(RingPtr->WakeupSemId);
+
+        /*
+         * Any remaining users found the ring before it was detached, and are about to finish.
+         * A task delay may take longer than asked for, so the wait is bounded by the clock.
+         */
+        CFE_PSP_GetTime(&StartTime);
+        WaitMsec = 0;
+        while (CFE_ATOMIC_LOAD(&PipeDscPtr->RingUsers) != 0 && WaitMsec < CFE_SB_PIPE_RING_DETACH_WAIT)
+        {
+            OS_TaskDelay(1);
+            CFE_PSP_GetTime(&TimeNow);
+            WaitMsec = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(TimeNow, StartTime));
+        }
+
+        if (CFE_ATOMIC_LOAD(&PipeDscPtr->RingUsers) != 0)
+        {
+            /* Leaking the ring (and its semaphore) is better than freeing it under a task */
+            CFE_ES_WriteToSysLog("%s: Pipe ring still in use after %d msec, not freed\n", __func__,
+                                 CFE_SB_PIPE_RING_DETACH_WAIT);
+            RingPtr = NULL;
+        }
+    }
+
+    return RingPtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_PipeRing_Destroy(CFE_SB_PipeRing_t *RingPtr)
+{
+    CFE_SB_BufferD_t *BufDscPtr;
+    osal_id_t         WakeupSemId;
+
+    WakeupSemId = RingPtr->WakeupSemId;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    /* Drop the reference held by each entry still in the rings */
+    BufDscPtr = CFE_SB_PipeRing_ReadLanes(RingPtr);
+    while (BufDscPtr != NULL)
+    {
+        CFE_SB_DecrBufUseCnt(BufDscPtr);
+        BufDscPtr = CFE_SB_PipeRing_ReadLanes(RingPtr);
+    }
+
+    if (RingPtr->UrgentLane != NULL)
+    {
+        CFE_SB_PutPipeRingBlk(RingPtr->UrgentLane);
+    }
+
+    CFE_SB_PutPipeRingBlk(RingPtr);
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    OS_BinSemDelete(WakeupSemId);
+}
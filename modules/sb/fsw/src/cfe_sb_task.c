@@ -29,6 +29,7 @@
 /* Include Files */
 
 #include "cfe_sb_module_all.h"
+#include "cfe_core_atomic.h"
 #include "cfe_version.h"
 #include "cfe_config.h" /* For version string construction */
 #include "cfe_es_msg.h" /* needed for local use of CFE_ES_RestartCmd_t */
@@ -345,14 +346,26 @@ int32 CFE_SB_DisableSubReportingCmd(const CFE_SB_DisableSubReportingCmd_t *data)
  *-----------------------------------------------------------------*/
 int32 CFE_SB_SendHKTlmCmd(const CFE_SB_SendHkCmd_t *data)
 {
+    CFE_SB_HousekeepingTlm_Payload_t *HkPtr       = &CFE_SB_Global.HKTlmMsg.Payload;
+    CFE_SB_Counters_t *               CountersPtr = &CFE_SB_Global.Counters;
+
     CFE_SB_LockSharedData(__FILE__, __LINE__);
 
-    CFE_SB_Global.HKTlmMsg.Payload.MemInUse = CFE_SB_Global.StatTlmMsg.Payload.MemInUse;
-    CFE_SB_Global.HKTlmMsg.Payload.UnmarkedMem =
-        CFE_PLATFORM_SB_BUF_MEMORY_BYTES - CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse;
+    /* Catch up on any route data left retired because a transmitter was reading at the time */
+    CFE_SB_ReleaseRetiredRouteData();
 
     CFE_SB_UnlockSharedData(__FILE__, __LINE__);
 
+    /* The transmit and receive paths only update the atomic counters, collect them now */
+    HkPtr->NoSubscribersCounter     = CFE_ATOMIC_LOAD(&CountersPtr->NoSubscribersCounter);
+    HkPtr->MsgSendErrorCounter      = CFE_ATOMIC_LOAD(&CountersPtr->MsgSendErrorCounter);
+    HkPtr->MsgReceiveErrorCounter   = CFE_ATOMIC_LOAD(&CountersPtr->MsgReceiveErrorCounter);
+    HkPtr->InternalErrorCounter     = CFE_ATOMIC_LOAD(&CountersPtr->InternalErrorCounter);
+    HkPtr->PipeOverflowErrorCounter = CFE_ATOMIC_LOAD(&CountersPtr->PipeOverflowErrorCounter);
+    HkPtr->MsgLimitErrorCounter     = CFE_ATOMIC_LOAD(&CountersPtr->MsgLimitErrorCounter);
+    HkPtr->MemInUse                 = CFE_ATOMIC_LOAD(&CountersPtr->MemInUse);
+    HkPtr->UnmarkedMem              = CFE_PLATFORM_SB_BUF_MEMORY_BYTES - CFE_ATOMIC_LOAD(&CountersPtr->PeakMemInUse);
+
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_SB_Global.HKTlmMsg.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_SB_Global.HKTlmMsg.TelemetryHeader), true);
 
@@ -378,6 +391,13 @@ void CFE_SB_ResetCounters(void)
     CFE_SB_Global.HKTlmMsg.Payload.SubscribeErrorCounter         = 0;
     CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter      = 0;
     CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter          = 0;
+
+    CFE_ATOMIC_STORE(&CFE_SB_Global.Counters.NoSubscribersCounter, 0);
+    CFE_ATOMIC_STORE(&CFE_SB_Global.Counters.MsgSendErrorCounter, 0);
+    CFE_ATOMIC_STORE(&CFE_SB_Global.Counters.MsgReceiveErrorCounter, 0);
+    CFE_ATOMIC_STORE(&CFE_SB_Global.Counters.InternalErrorCounter, 0);
+    CFE_ATOMIC_STORE(&CFE_SB_Global.Counters.PipeOverflowErrorCounter, 0);
+    CFE_ATOMIC_STORE(&CFE_SB_Global.Counters.MsgLimitErrorCounter, 0);
 }
 
 /*----------------------------------------------------------------
@@ -418,8 +438,8 @@ int32 CFE_SB_EnableRouteCmd(const CFE_SB_EnableRouteCmd_t *data)
         }
         else
         {
-            DestPtr->Active = CFE_SB_ACTIVE;
-            PendingEventID  = CFE_SB_ENBL_RTE2_EID;
+            CFE_ATOMIC_STORE(&DestPtr->Active, CFE_SB_ACTIVE);
+            PendingEventID = CFE_SB_ENBL_RTE2_EID;
             CFE_SB_Global.HKTlmMsg.Payload.CommandCounter++;
         }
     }
@@ -485,8 +505,8 @@ int32 CFE_SB_DisableRouteCmd(const CFE_SB_DisableRouteCmd_t *data)
         }
         else
         {
-            DestPtr->Active = CFE_SB_INACTIVE;
-            PendingEventID  = CFE_SB_DSBL_RTE2_EID;
+            CFE_ATOMIC_STORE(&DestPtr->Active, CFE_SB_INACTIVE);
+            PendingEventID = CFE_SB_DSBL_RTE2_EID;
             CFE_SB_Global.HKTlmMsg.Payload.CommandCounter++;
         }
     }
@@ -526,9 +546,19 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
     uint32                   PipeStatCount;
     CFE_SB_PipeD_t *         PipeDscPtr;
     CFE_SB_PipeDepthStats_t *PipeStatPtr;
+    CFE_SBR_MapStats_t       MapStats;
 
     CFE_SB_LockSharedData(__FILE__, __LINE__);
 
+    /* Collect data on the message map, average is reported in hundredths */
+    CFE_SBR_GetMapStats(&MapStats);
+    CFE_SB_Global.StatTlmMsg.Payload.MsgMapMaxProbeLength = MapStats.MaxProbeLength;
+    CFE_SB_Global.StatTlmMsg.Payload.MsgMapAvgProbeLength = 0;
+    if (MapStats.NumEntries > 0)
+    {
+        CFE_SB_Global.StatTlmMsg.Payload.MsgMapAvgProbeLength = (MapStats.TotalProbeLength * 100) / MapStats.NumEntries;
+    }
+
     /* Collect data on pipes */
     PipeDscCount  = CFE_PLATFORM_SB_MAX_PIPES;
     PipeStatCount = CFE_MISSION_SB_MAX_PIPES;
@@ -556,6 +586,12 @@ int32 CFE_SB_SendStatsCmd(const CFE_SB_SendSbStatsCmd_t *data)
 
     CFE_SB_UnlockSharedData(__FILE__, __LINE__);
 
+    /* Collect the buffer counters kept by the transmit path */
+    CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse     = CFE_ATOMIC_LOAD(&CFE_SB_Global.Counters.SBBuffersInUse);
+    CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_ATOMIC_LOAD(&CFE_SB_Global.Counters.PeakSBBuffersInUse);
+    CFE_SB_Global.StatTlmMsg.Payload.MemInUse           = CFE_ATOMIC_LOAD(&CFE_SB_Global.Counters.MemInUse);
+    CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse       = CFE_ATOMIC_LOAD(&CFE_SB_Global.Counters.PeakMemInUse);
+
     while (PipeStatCount > 0)
     {
         memset(PipeStatPtr, 0, sizeof(*PipeStatPtr));
@@ -964,6 +1000,155 @@ int32 CFE_SB_WritePipeInfoCmd(const CFE_SB_WritePipeInfoCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SB_WritePipeLatencyDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_SB_BackgroundFileStateInfo_t *BgFilePtr;
+    CFE_SB_PipeLatencyEntry_t *       LatencyBufferPtr;
+    CFE_SB_PipeD_t *                  PipeDscPtr;
+    osal_id_t                         SysQueueId = OS_OBJECT_ID_UNDEFINED;
+    bool                              PipeIsValid;
+
+    BgFilePtr   = (CFE_SB_BackgroundFileStateInfo_t *)Meta;
+    PipeDscPtr  = NULL;
+    PipeIsValid = false;
+
+    LatencyBufferPtr = &BgFilePtr->Buffer.PipeLatency;
+
+    if (RecordNum < CFE_PLATFORM_SB_MAX_PIPES)
+    {
+        PipeDscPtr = &CFE_SB_Global.PipeTbl[RecordNum];
+
+        CFE_SB_LockSharedData(__FILE__, __LINE__);
+
+        PipeIsValid = CFE_SB_PipeDescIsUsed(PipeDscPtr);
+
+        if (PipeIsValid)
+        {
+            memset(LatencyBufferPtr, 0, sizeof(*LatencyBufferPtr));
+
+            /*
+             * Take a "snapshot" of the histogram while locked, so the
+             * buckets and the maximum are consistent with each other
+             */
+            LatencyBufferPtr->PipeId     = CFE_SB_PipeDescGetID(PipeDscPtr);
+            LatencyBufferPtr->AppId      = PipeDscPtr->AppId;
+            LatencyBufferPtr->MaxLatency = PipeDscPtr->MaxLatency;
+            memcpy(LatencyBufferPtr->Buckets, PipeDscPtr->LatencyHist, sizeof(LatencyBufferPtr->Buckets));
+
+            SysQueueId = PipeDscPtr->SysQueueId;
+        }
+
+        CFE_SB_UnlockSharedData(__FILE__, __LINE__);
+    }
+
+    if (PipeIsValid)
+    {
+        /* As in the pipe info dump, names are gathered while unlocked */
+        OS_GetResourceName(SysQueueId, LatencyBufferPtr->PipeName, sizeof(LatencyBufferPtr->PipeName));
+        CFE_ES_GetAppName(LatencyBufferPtr->AppName, LatencyBufferPtr->AppId, sizeof(LatencyBufferPtr->AppName));
+
+        *Buffer  = LatencyBufferPtr;
+        *BufSize = sizeof(*LatencyBufferPtr);
+    }
+    else
+    {
+        *Buffer  = NULL;
+        *BufSize = 0;
+    }
+
+    /* Check for EOF (last entry)  */
+    return (RecordNum >= (CFE_PLATFORM_SB_MAX_PIPES - 1));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_WritePipeLatencyCmd(const CFE_SB_WritePipeLatencyCmd_t *data)
+{
+    const CFE_SB_WriteFileInfoCmd_Payload_t *CmdPtr;
+    CFE_SB_BackgroundFileStateInfo_t *       StatePtr;
+    int32                                    Status;
+
+    StatePtr = &CFE_SB_Global.BackgroundFile;
+    CmdPtr   = &data->Payload;
+
+    /* If any dump was already pending, do not overwrite the current request */
+    if (!CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_SB_PIPELATENCY;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description),
+                 "SB Pipe Latency Histograms");
+
+        StatePtr->FileWrite.GetData = CFE_SB_WritePipeLatencyDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_SB_BackgroundFileEventHandler;
+
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, CmdPtr->Filename,
+                                             sizeof(StatePtr->FileWrite.FileName), sizeof(CmdPtr->Filename),
+                                             CFE_PLATFORM_SB_DEFAULT_PIPE_LATENCY_FILENAME,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+    else
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_SB_BackgroundFileEventHandler(StatePtr, CFE_FS_FileWriteEvent_CREATE_ERROR, Status, 0, 0, 0);
+    }
+
+    CFE_SB_IncrCmdCtr(Status);
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_ResetPipeLatencyCmd(const CFE_SB_ResetPipeLatencyCmd_t *data)
+{
+    CFE_SB_PipeD_t *PipeDscPtr;
+    uint32          i;
+
+    /* Receivers record under the lock, so clearing under it cannot lose a partial update */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    PipeDscPtr = CFE_SB_Global.PipeTbl;
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_PIPES; ++i)
+    {
+        PipeDscPtr->MaxLatency = 0;
+        memset(PipeDscPtr->LatencyHist, 0, sizeof(PipeDscPtr->LatencyHist));
+        ++PipeDscPtr;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    CFE_EVS_SendEvent(CFE_SB_RESET_PIPE_LATENCY_EID, CFE_EVS_EventType_INFORMATION, "Pipe latency reset");
+    CFE_SB_Global.HKTlmMsg.Payload.CommandCounter++;
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -48,6 +48,34 @@
 #error CFE_PLATFORM_SB_MAX_DEST_PER_PKT cannot be less than 1!
 #endif
 
+#if CFE_PLATFORM_SB_MAX_RECEIVE_BATCH < 2
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be less than 2!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_RECEIVE_BATCH > 65535
+#error CFE_PLATFORM_SB_MAX_RECEIVE_BATCH cannot be greater than 65535!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_MASK_SUBS < 1
+#error CFE_PLATFORM_SB_MAX_MASK_SUBS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_PIPES_PER_SET < 1
+#error CFE_PLATFORM_SB_MAX_PIPES_PER_SET cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_PIPES_PER_SET > CFE_PLATFORM_SB_MAX_PIPES
+#error CFE_PLATFORM_SB_MAX_PIPES_PER_SET cannot be greater than CFE_PLATFORM_SB_MAX_PIPES!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS < 1
+#error CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_BUFFER_POOLS < 1
+#error CFE_PLATFORM_SB_MAX_BUFFER_POOLS cannot be less than 1!
+#endif
+
 #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID < 1
 #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
@@ -64,6 +92,26 @@
 #error CFE_PLATFORM_SB_BUF_MEMORY_BYTES cannot be greater than UINT32_MAX (4 Gigabytes)!
 #endif
 
+#if CFE_PLATFORM_SB_BUF_CACHE_DEPTH < 0
+#error CFE_PLATFORM_SB_BUF_CACHE_DEPTH cannot be less than 0!
+#endif
+
+#if CFE_PLATFORM_SB_BUF_CACHE_DEPTH > 65535
+#error CFE_PLATFORM_SB_BUF_CACHE_DEPTH cannot be greater than 65535!
+#endif
+
+#if CFE_PLATFORM_SB_BUF_CACHE_REFILL < 1
+#error CFE_PLATFORM_SB_BUF_CACHE_REFILL cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_BUF_CACHE_DEPTH > 0 && CFE_PLATFORM_SB_BUF_CACHE_REFILL > CFE_PLATFORM_SB_BUF_CACHE_DEPTH
+#error CFE_PLATFORM_SB_BUF_CACHE_REFILL cannot be greater than CFE_PLATFORM_SB_BUF_CACHE_DEPTH!
+#endif
+
+#if CFE_PLATFORM_SB_BUF_CACHE_BYTES < 0
+#error CFE_PLATFORM_SB_BUF_CACHE_BYTES cannot be less than 0!
+#endif
+
 /*
  * Legacy time formats no longer supported in core cFE, this will pass
  * if default is selected or if both defines are removed
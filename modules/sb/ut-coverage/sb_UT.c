@@ -98,6 +98,10 @@ const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_PIPE_INFO_CC =
     { SB_UT_CC_DISPATCH(CMD,CFE_SB_WRITE_PIPE_INFO_CC,WritePipeInfoCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_MAP_INFO_CC =
     { SB_UT_CC_DISPATCH(CMD,CFE_SB_WRITE_MAP_INFO_CC,WriteMapInfoCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_WRITE_PIPE_LATENCY_CC =
+    { SB_UT_CC_DISPATCH(CMD,CFE_SB_WRITE_PIPE_LATENCY_CC,WritePipeLatencyCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_RESET_PIPE_LATENCY_CC =
+    { SB_UT_CC_DISPATCH(CMD,CFE_SB_RESET_PIPE_LATENCY_CC,ResetPipeLatencyCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_ENABLE_ROUTE_CC =
     { SB_UT_CC_DISPATCH(CMD,CFE_SB_ENABLE_ROUTE_CC,EnableRouteCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_SB_CMD_DISABLE_ROUTE_CC =
@@ -220,6 +224,13 @@ void SB_ResetUnitTest(void)
 {
     UT_InitData();
     CFE_SB_EarlyInit();
+
+    /*
+     * Have the pool stub carve distinct blocks out of the SB partition, since
+     * SB keeps free buffers and pipe rings linked through pool memory.
+     */
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), CFE_SB_Global.Mem.Partition.Data,
+                     sizeof(CFE_SB_Global.Mem.Partition.Data), false);
 }
 
 /*
@@ -315,7 +326,8 @@ void Test_SB_AppInit_Sub1Fail(void)
 */
 void Test_SB_AppInit_Sub2Fail(void)
 {
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, -1);
+    /* Each subscription also allocates a route snapshot after the destination */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 3, -1);
     UtAssert_INT32_EQ(CFE_SB_AppInit(), CFE_SB_BUF_ALOC_ERR);
 
     CFE_UtAssert_EVENTCOUNT(4);
@@ -330,7 +342,8 @@ void Test_SB_AppInit_Sub2Fail(void)
 */
 void Test_SB_AppInit_Sub3Fail(void)
 {
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 3, -1);
+    /* Each subscription also allocates a route snapshot after the destination */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 5, -1);
     UtAssert_INT32_EQ(CFE_SB_AppInit(), CFE_SB_BUF_ALOC_ERR);
 
     CFE_UtAssert_EVENTCOUNT(5);
@@ -347,7 +360,7 @@ void Test_SB_AppInit_GetPoolFail(void)
 {
     int32 ForcedRtnVal = -1;
 
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 4, ForcedRtnVal);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 7, ForcedRtnVal);
 
     UtAssert_INT32_EQ(CFE_SB_AppInit(), ForcedRtnVal);
 
@@ -482,6 +495,9 @@ void Test_SB_Cmds(void)
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoDef);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoAlreadyPending);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_MapInfoDataGetter);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_PipeLatencyDef);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_PipeLatencyDataGetter);
+    SB_UT_ADD_SUBTEST(Test_SB_Cmds_ResetPipeLatency);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteValParam);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteNonExist);
     SB_UT_ADD_SUBTEST(Test_SB_Cmds_EnRouteInvParam);
@@ -537,9 +553,24 @@ void Test_SB_Cmds_RstCtrs(void)
 
     memset(&ResetCounters, 0, sizeof(ResetCounters));
 
+    /* The counters kept by the transmit and receive paths are reset as well */
+    CFE_SB_Global.Counters.NoSubscribersCounter     = 1;
+    CFE_SB_Global.Counters.MsgSendErrorCounter      = 2;
+    CFE_SB_Global.Counters.MsgReceiveErrorCounter   = 3;
+    CFE_SB_Global.Counters.InternalErrorCounter     = 4;
+    CFE_SB_Global.Counters.PipeOverflowErrorCounter = 5;
+    CFE_SB_Global.Counters.MsgLimitErrorCounter     = 6;
+
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(ResetCounters.SBBuf), sizeof(ResetCounters.Cmd),
                     UT_TPID_CFE_SB_CMD_RESET_COUNTERS_CC);
 
+    UtAssert_ZERO(CFE_SB_Global.Counters.NoSubscribersCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MsgSendErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MsgReceiveErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.InternalErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.PipeOverflowErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MsgLimitErrorCounter);
+
     CFE_UtAssert_EVENTCOUNT(1);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_CMD1_RCVD_EID);
@@ -581,8 +612,15 @@ void Test_SB_Cmds_Stats(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
+    /* Buffer counters are collected when the packet is sent */
+    CFE_SB_Global.Counters.PeakSBBuffersInUse = 7;
+    CFE_SB_Global.Counters.PeakMemInUse       = 700;
+
     CFE_SB_ProcessCmdPipePkt(&SendSbStats.SBBuf);
 
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse, 7);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse, 700);
+
     /* No subs event and command processing event */
     CFE_UtAssert_EVENTCOUNT(5);
 
@@ -591,6 +629,16 @@ void Test_SB_Cmds_Stats(void)
     UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(SendSbStats.SBBuf), 0, UT_TPID_CFE_SB_CMD_SEND_SB_STATS_CC);
     CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
 
+    /* Message map statistics are reported once the map has entries */
+    CFE_SB_Global.StatTlmMsg.Payload.MsgMapMaxProbeLength = 0xFFFF;
+    CFE_SB_Global.StatTlmMsg.Payload.MsgMapAvgProbeLength = 0xFFFF;
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_CMD_MID, PipeId1));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_SendStatsCmd(&SendSbStats.Cmd));
+    UtAssert_UINT32_LT(CFE_SB_Global.StatTlmMsg.Payload.MsgMapMaxProbeLength, CFE_PLATFORM_SB_MAX_MSG_IDS);
+    UtAssert_UINT32_LT(CFE_SB_Global.StatTlmMsg.Payload.MsgMapAvgProbeLength, CFE_PLATFORM_SB_MAX_MSG_IDS * 100);
+
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId3));
@@ -849,6 +897,147 @@ void Test_SB_Cmds_PipeInfoDataGetter(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId3));
 }
 
+/*
+** Test write pipe latency command default / nominal path
+*/
+void Test_SB_Cmds_PipeLatencyDef(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t              SBBuf;
+        CFE_SB_WritePipeLatencyCmd_t Cmd;
+    } WritePipeLatency;
+
+    memset(&WritePipeLatency, 0, sizeof(WritePipeLatency));
+
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(WritePipeLatency.SBBuf), sizeof(WritePipeLatency.Cmd),
+                    UT_TPID_CFE_SB_CMD_WRITE_PIPE_LATENCY_CC);
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_INT32_EQ(CFE_SB_Global.BackgroundFile.FileWrite.FileSubType, CFE_FS_SubType_SB_PIPELATENCY);
+
+    /* Also test with a bad file name - should generate CFE_SB_SND_RTG_ERR1_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(WritePipeLatency.SBBuf), sizeof(WritePipeLatency.Cmd),
+                    UT_TPID_CFE_SB_CMD_WRITE_PIPE_LATENCY_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_RTG_ERR1_EID);
+
+    /* A request that is already pending is not overwritten */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), 1, true);
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(WritePipeLatency.SBBuf), sizeof(WritePipeLatency.Cmd),
+                    UT_TPID_CFE_SB_CMD_WRITE_PIPE_LATENCY_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SND_RTG_ERR1_EID);
+
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(WritePipeLatency.SBBuf), 0,
+                    UT_TPID_CFE_SB_CMD_WRITE_PIPE_LATENCY_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
+}
+
+/*
+** Test recording of pipe latency and the write pipe latency data getter
+*/
+void Test_SB_Cmds_PipeLatencyDataGetter(void)
+{
+    CFE_SB_PipeId_t                  PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t *                 PipeDscPtr;
+    CFE_SB_BufferD_t                 BufDsc;
+    CFE_SB_PipeLatencyEntry_t *      EntryPtr;
+    void *                           LocalBuffer;
+    size_t                           LocalBufSize;
+    CFE_SB_BackgroundFileStateInfo_t State;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, 10, "TestPipe1"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId1);
+
+    memset(&BufDsc, 0, sizeof(BufDsc));
+    BufDsc.TransmitTime = 0xFFFFFFF0;
+
+    /* Below 2 microseconds all goes to the first bucket */
+    CFE_SB_RecordPipeLatency(PipeDscPtr, &BufDsc, 0xFFFFFFF0);
+    CFE_SB_RecordPipeLatency(PipeDscPtr, &BufDsc, 0xFFFFFFF1);
+    UtAssert_UINT32_EQ(PipeDscPtr->LatencyHist[0], 2);
+
+    /* 16 to 31 microseconds goes to bucket 4, measured across the 32 bit boundary of the time */
+    CFE_SB_RecordPipeLatency(PipeDscPtr, &BufDsc, 0x10000000F);
+    UtAssert_UINT32_EQ(PipeDscPtr->LatencyHist[4], 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->MaxLatency, 31);
+
+    /* Anything beyond the range of the histogram goes to the last bucket */
+    BufDsc.TransmitTime = 0;
+    CFE_SB_RecordPipeLatency(PipeDscPtr, &BufDsc, 0x80000000);
+    UtAssert_UINT32_EQ(PipeDscPtr->LatencyHist[CFE_SB_PIPE_LATENCY_BUCKETS - 1], 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->MaxLatency, 0x80000000);
+
+    /* A shorter latency does not lower the maximum */
+    CFE_SB_RecordPipeLatency(PipeDscPtr, &BufDsc, 3);
+    UtAssert_UINT32_EQ(PipeDscPtr->LatencyHist[1], 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->MaxLatency, 0x80000000);
+
+    memset(&State, 0, sizeof(State));
+    LocalBuffer  = NULL;
+    LocalBufSize = 0;
+
+    /* Note that CFE_SB_CreatePipe() fills entry 1 first, so entry 0 is unused */
+    UtAssert_BOOL_FALSE(CFE_SB_WritePipeLatencyDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_ZERO(LocalBufSize);
+
+    UtAssert_BOOL_FALSE(CFE_SB_WritePipeLatencyDataGetter(&State, 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_ADDRESS_EQ(LocalBuffer, &State.Buffer.PipeLatency);
+    UtAssert_EQ(size_t, LocalBufSize, sizeof(CFE_SB_PipeLatencyEntry_t));
+    EntryPtr = LocalBuffer;
+    CFE_UtAssert_RESOURCEID_EQ(EntryPtr->PipeId, PipeId1);
+    UtAssert_UINT32_EQ(EntryPtr->MaxLatency, 0x80000000);
+    UtAssert_UINT32_EQ(EntryPtr->Buckets[0], 2);
+    UtAssert_UINT32_EQ(EntryPtr->Buckets[1], 1);
+    UtAssert_UINT32_EQ(EntryPtr->Buckets[4], 1);
+    UtAssert_UINT32_EQ(EntryPtr->Buckets[CFE_SB_PIPE_LATENCY_BUCKETS - 1], 1);
+
+    UtAssert_BOOL_TRUE(
+        CFE_SB_WritePipeLatencyDataGetter(&State, CFE_PLATFORM_SB_MAX_PIPES - 1, &LocalBuffer, &LocalBufSize));
+    UtAssert_ZERO(LocalBufSize);
+
+    UtAssert_BOOL_TRUE(
+        CFE_SB_WritePipeLatencyDataGetter(&State, CFE_PLATFORM_SB_MAX_PIPES, &LocalBuffer, &LocalBufSize));
+    UtAssert_ZERO(LocalBufSize);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+}
+
+/*
+** Test reset pipe latency command
+*/
+void Test_SB_Cmds_ResetPipeLatency(void)
+{
+    union
+    {
+        CFE_SB_Buffer_t              SBBuf;
+        CFE_SB_ResetPipeLatencyCmd_t Cmd;
+    } ResetPipeLatency;
+    CFE_SB_PipeId_t PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t *PipeDscPtr;
+
+    memset(&ResetPipeLatency, 0, sizeof(ResetPipeLatency));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, 10, "TestPipe1"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId1);
+
+    PipeDscPtr->MaxLatency     = 100;
+    PipeDscPtr->LatencyHist[6] = 1;
+
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(ResetPipeLatency.SBBuf), sizeof(ResetPipeLatency.Cmd),
+                    UT_TPID_CFE_SB_CMD_RESET_PIPE_LATENCY_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RESET_PIPE_LATENCY_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CommandCounter, 1);
+    UtAssert_ZERO(PipeDscPtr->MaxLatency);
+    UtAssert_ZERO(PipeDscPtr->LatencyHist[6]);
+
+    UT_CallTaskPipe(CFE_SB_ProcessCmdPipePkt, CFE_MSG_PTR(ResetPipeLatency.SBBuf), 0,
+                    UT_TPID_CFE_SB_CMD_RESET_PIPE_LATENCY_CC);
+    CFE_UtAssert_EVENTSENT(CFE_SB_LEN_ERR_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+}
+
 /*
 ** Test background file write event generator
 */
@@ -1333,8 +1522,22 @@ void Test_SB_Cmds_SendHK(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgIdCmd, sizeof(MsgIdCmd), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
+    /* Counters kept by the transmit and receive paths are collected when the packet is sent */
+    CFE_SB_Global.Counters.NoSubscribersCounter     = 3;
+    CFE_SB_Global.Counters.PipeOverflowErrorCounter = 300;
+    CFE_SB_Global.Counters.MemInUse                 = 100;
+    CFE_SB_Global.Counters.PeakMemInUse             = 200;
+
     CFE_SB_ProcessCmdPipePkt(&Housekeeping.SBBuf);
 
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter, 3);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter, 300);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MemInUse, 100);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.UnmarkedMem, CFE_PLATFORM_SB_BUF_MEMORY_BYTES - 200);
+
+    /* The packet itself had no subscribers */
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.NoSubscribersCounter, 4);
+
     CFE_UtAssert_EVENTCOUNT(1);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_SEND_NO_SUBS_EID);
@@ -1637,6 +1840,16 @@ void Test_SB_EarlyInit_NoErrors(void)
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.PeakSubscriptionsInUse);
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse);
     UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse);
+    UtAssert_ZERO(CFE_SB_Global.Counters.NoSubscribersCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MsgSendErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MsgReceiveErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.InternalErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.PipeOverflowErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MsgLimitErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MemInUse);
+    UtAssert_ZERO(CFE_SB_Global.Counters.PeakMemInUse);
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+    UtAssert_ZERO(CFE_SB_Global.Counters.PeakSBBuffersInUse);
 }
 
 /*
@@ -1651,6 +1864,8 @@ void Test_CreatePipe_API(void)
     SB_UT_ADD_SUBTEST(Test_CreatePipe_SamePipeName);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_EmptyPipeName);
     SB_UT_ADD_SUBTEST(Test_CreatePipe_PipeName_NullPtr);
+    SB_UT_ADD_SUBTEST(Test_CreatePipe_Ring);
+    SB_UT_ADD_SUBTEST(Test_CreatePipe_Priority);
 }
 
 /*
@@ -1840,7 +2055,103 @@ void Test_CreatePipe_PipeName_NullPtr(void)
 }
 
 /*
+** Test create pipe with the ring buffer option
+*/
+void Test_CreatePipe_Ring(void)
+{
+    CFE_SB_PipeId_t    PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t *   PipeDscPtr;
+    CFE_SB_PipeRing_t *RingPtr;
+    OS_time_t          DetachTimes[3];
+    uint8              Opts;
+
+    CFE_UtAssert_SUCCESS(CFE_SB_CreatePipeEx(&PipeId, 5, "RingPipe", CFE_SB_PIPEOPTS_RING));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UtAssert_NOT_NULL(PipeDscPtr->Ring);
+    UtAssert_UINT32_EQ(PipeDscPtr->Ring->Mask, 7);
+    UtAssert_UINT32_EQ(PipeDscPtr->MaxQueueDepth, 5);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 1);
+
+    /* The ring option cannot be changed after creation */
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeOpts(PipeId, CFE_SB_PIPEOPTS_IGNOREMINE));
+    CFE_UtAssert_SUCCESS(CFE_SB_GetPipeOpts(PipeId, &Opts));
+    UtAssert_UINT8_EQ(Opts, CFE_SB_PIPEOPTS_IGNOREMINE | CFE_SB_PIPEOPTS_RING);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_DeletePipe(PipeId));
+    UtAssert_NULL(PipeDscPtr->Ring);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 1);
+
+    /* A ring that is still in use when the wait for its users ends is not freed, the wait going by the clock */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipeEx(&PipeId, 5, "RingPipe", CFE_SB_PIPEOPTS_RING));
+    PipeDscPtr            = CFE_SB_LocatePipeDescByID(PipeId);
+    RingPtr               = PipeDscPtr->Ring;
+    PipeDscPtr->RingUsers = 1;
+    DetachTimes[0]        = OS_TimeFromTotalSeconds(1000);
+    DetachTimes[1]        = OS_TimeAdd(DetachTimes[0], OS_TimeFromTotalMilliseconds(10));
+    DetachTimes[2]        = OS_TimeAdd(DetachTimes[0], OS_TimeFromTotalMilliseconds(CFE_SB_PIPE_RING_DETACH_WAIT));
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), DetachTimes, sizeof(DetachTimes), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_DeletePipe(PipeId));
+    UtAssert_NULL(PipeDscPtr->Ring);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 2);
+    UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 1);
+    PipeDscPtr->RingUsers = 0;
+    CFE_SB_PipeRing_Destroy(RingPtr);
+
+    /* Semaphore creation fails, the queue is deleted again */
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_CreatePipeEx(&PipeId, 5, "RingPipe", CFE_SB_PIPEOPTS_RING), CFE_SB_PIPE_CR_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CR_PIPE_RING_ERR_EID);
+    UtAssert_STUB_COUNT(OS_QueueDelete, 3);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 2);
+
+    /* Ring allocation fails, the queue and semaphore are deleted again */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    UtAssert_INT32_EQ(CFE_SB_CreatePipeEx(&PipeId, 5, "RingPipe", CFE_SB_PIPEOPTS_RING), CFE_SB_BUF_ALOC_ERR);
+    UtAssert_STUB_COUNT(OS_QueueDelete, 4);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 3);
+
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.CreatePipeErrorCounter, 2);
+}
+
+/*
+** Test create pipe with the priority option
+*/
+void Test_CreatePipe_Priority(void)
+{
+    CFE_SB_PipeId_t PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t *PipeDscPtr;
+    uint8           Opts;
+
+    /* Both lanes are rings that share the wakeup semaphore */
+    CFE_UtAssert_SUCCESS(CFE_SB_CreatePipeEx(&PipeId, 5, "PrioPipe", CFE_SB_PIPEOPTS_PRIORITY));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UtAssert_NOT_NULL(PipeDscPtr->Ring);
+    UtAssert_NOT_NULL(PipeDscPtr->Ring->UrgentLane);
+    UtAssert_UINT32_EQ(PipeDscPtr->Ring->UrgentLane->Mask, 7);
+    UtAssert_NULL(PipeDscPtr->Ring->UrgentLane->UrgentLane);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 1);
+
+    /* The ring and priority options cannot be changed after creation */
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeOpts(PipeId, 0));
+    CFE_UtAssert_SUCCESS(CFE_SB_GetPipeOpts(PipeId, &Opts));
+    UtAssert_UINT8_EQ(Opts, CFE_SB_PIPEOPTS_PRIORITY | CFE_SB_PIPEOPTS_RING);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_DeletePipe(PipeId));
+    UtAssert_NULL(PipeDscPtr->Ring);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 1);
+
+    /* Urgent lane allocation fails, the normal ring is returned to the pool */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, -1);
+    UtAssert_INT32_EQ(CFE_SB_CreatePipeEx(&PipeId, 5, "PrioPipe", CFE_SB_PIPEOPTS_PRIORITY), CFE_SB_BUF_ALOC_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_CR_PIPE_RING_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 3);
+    UtAssert_STUB_COUNT(OS_QueueDelete, 2);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 2);
+}
 
+/*
 ** Function for calling SB delete pipe API test functions
 */
 void Test_DeletePipe_API(void)
@@ -1969,6 +2280,7 @@ void Test_PipeOpts_API(void)
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts_BadID);
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts_BadPtr);
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts);
+    SB_UT_ADD_SUBTEST(Test_SetPipeWakeup);
 }
 
 /*
@@ -2148,7 +2460,8 @@ void Test_SetPipeOpts_NotOwner(void)
 */
 void Test_SetPipeOpts(void)
 {
-    CFE_SB_PipeId_t PipeID = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t       PipeID = CFE_SB_INVALID_PIPE;
+    CFE_SB_RouteId_Atom_t RouteIdx;
 
     CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeID, 4, "TestPipe1"));
 
@@ -2159,6 +2472,16 @@ void Test_SetPipeOpts(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
     UtAssert_INT32_EQ(CFE_SB_SetPipeOpts(PipeID, 0), CFE_ES_ERR_RESOURCEID_NOT_VALID);
 
+    /* Changing IGNOREMINE rebuilds the snapshots of the routes of the pipe */
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_CMD_MID, PipeID));
+    RouteIdx = CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(SB_UT_CMD_MID));
+    UtAssert_BOOL_FALSE(CFE_SB_Global.RouteSnapshot[RouteIdx]->HasIgnoreMine);
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeOpts(PipeID, CFE_SB_PIPEOPTS_IGNOREMINE));
+    UtAssert_BOOL_TRUE(CFE_SB_Global.RouteSnapshot[RouteIdx]->HasIgnoreMine);
+    UtAssert_BOOL_TRUE(CFE_SB_Global.RouteSnapshot[RouteIdx]->Dests[0].IgnoreMine);
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeOpts(PipeID, 0));
+    UtAssert_BOOL_FALSE(CFE_SB_Global.RouteSnapshot[RouteIdx]->HasIgnoreMine);
+
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeID));
 }
 
@@ -2207,6 +2530,62 @@ void Test_GetPipeOpts(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeID));
 }
 
+/*
+** Set the wakeup threshold of a pipe
+*/
+void Test_SetPipeWakeup(void)
+{
+    CFE_SB_PipeId_t    PipeID     = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t    RingPipeID = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeD_t *   PipeDscPtr;
+    CFE_SB_PipeRing_t *RingPtr;
+    CFE_ES_AppId_t     OrigOwner;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeID, 4, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipeEx(&RingPipeID, 4, "RingPipe", CFE_SB_PIPEOPTS_RING));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(RingPipeID);
+    RingPtr    = PipeDscPtr->Ring;
+
+    /* A threshold needs a delay, only ring pipes owned by the caller are accepted */
+    UtAssert_INT32_EQ(CFE_SB_SetPipeWakeup(RingPipeID, 2, 0), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SETPIPEWAKEUP_ERR_EID);
+    UT_ClearEventHistory();
+    UtAssert_INT32_EQ(CFE_SB_SetPipeWakeup(SB_UT_ALTERNATE_INVALID_PIPEID, 2, 1000), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SETPIPEWAKEUP_ERR_EID);
+    UT_ClearEventHistory();
+    UtAssert_INT32_EQ(CFE_SB_SetPipeWakeup(PipeID, 2, 1000), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SETPIPEWAKEUP_ERR_EID);
+    OrigOwner         = PipeDscPtr->AppId;
+    PipeDscPtr->AppId = UT_SB_AppID_Modify(OrigOwner, 1);
+    UtAssert_INT32_EQ(CFE_SB_SetPipeWakeup(RingPipeID, 2, 1000), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SETPIPEWAKEUP_OWNER_ERR_EID);
+    PipeDscPtr->AppId = OrigOwner;
+    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.PipeOptsErrorCounter, 4);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_SB_SetPipeWakeup(RingPipeID, 2, 1000), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_ZERO(RingPtr->WakeupThreshold);
+
+    /* Delay is rounded up to milliseconds */
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeWakeup(RingPipeID, 8, 1500));
+    CFE_UtAssert_EVENTSENT(CFE_SB_SETPIPEWAKEUP_EID);
+    UtAssert_UINT32_EQ(RingPtr->WakeupThreshold, 8);
+    UtAssert_UINT32_EQ(RingPtr->WakeupDelay, 2);
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeWakeup(RingPipeID, 8, 3000));
+    UtAssert_UINT32_EQ(RingPtr->WakeupDelay, 3);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 0);
+
+    /* A waiting reader is woken to pick up the new settings, a count of 1 turns coalescing off */
+    RingPtr->ReaderParked = 1;
+    CFE_UtAssert_SUCCESS(CFE_SB_SetPipeWakeup(RingPipeID, 1, 0));
+    UtAssert_ZERO(RingPtr->WakeupThreshold);
+    UtAssert_ZERO(RingPtr->WakeupDelay);
+    UtAssert_ZERO(RingPtr->ReaderParked);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeID));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(RingPipeID));
+}
+
 /*
 ** Function for calling SB subscribe API test functions
 */
@@ -2224,6 +2603,9 @@ void Test_Subscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Subscribe_PipeNonexistent);
     SB_UT_ADD_SUBTEST(Test_Subscribe_SubscriptionReporting);
     SB_UT_ADD_SUBTEST(Test_Subscribe_InvalidPipeOwner);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_Mask);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_MaskErrors);
+    SB_UT_ADD_SUBTEST(Test_Subscribe_DeliveryRate);
 }
 
 /*
@@ -2577,6 +2959,226 @@ void Test_Subscribe_InvalidPipeOwner(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test API to subscribe to a masked set of message IDs
+*/
+void Test_Subscribe_Mask(void)
+{
+    CFE_SB_PipeId_t        PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t        PipeId2 = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_Atom_t    Mask    = ~((CFE_SB_MsgId_Atom_t)0x7);
+    CFE_SB_MsgId_t         MsgId   = SB_UT_TLM_MID3;
+    CFE_SBR_RouteId_t      RouteId;
+    CFE_SB_DestinationD_t *DestPtr;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_MSG_Size_t         Size      = sizeof(TlmPkt);
+    uint16                 PipeDepth = 10;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, PipeDepth, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, PipeDepth, "TestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID1, PipeId1));
+
+    /* Existing matching routes get the pipe right away */
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeMask(SB_UT_TLM_MID, Mask, PipeId2, 4));
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.NumMaskSubs, 1);
+    DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID1), PipeId2);
+    UtAssert_NOT_NULL(DestPtr);
+    UtAssert_BOOL_TRUE(DestPtr->IsMaskDest);
+    UtAssert_UINT32_EQ(DestPtr->MsgLim, 4);
+    UtAssert_INT32_EQ(DestPtr->Scope, CFE_SB_MSG_LOCAL);
+
+    /* Every other matching message ID gets a route right away too */
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 8);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID2, PipeId1));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_CMD_MID, PipeId1));
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID2), PipeId2));
+    UtAssert_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_CMD_MID), PipeId2));
+
+    /* A single message ID subscription takes over the destination without a duplicate event */
+    UT_ClearEventHistory();
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeLocal(SB_UT_TLM_MID1, PipeId2, 2));
+    CFE_UtAssert_EVENTNOTSENT(CFE_SB_DUP_SUBSCRIP_EID);
+    DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID1), PipeId2);
+    UtAssert_NOT_NULL(DestPtr);
+    UtAssert_BOOL_FALSE(DestPtr->IsMaskDest);
+    UtAssert_UINT32_EQ(DestPtr->MsgLim, 2);
+
+    /* A route that was removed along with the single message ID subscription gets the pipe back */
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeLocal(SB_UT_TLM_MID4, PipeId2, 2));
+    CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(SB_UT_TLM_MID4, PipeId2));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(SB_UT_TLM_MID4)));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID4, PipeId1));
+    DestPtr = CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID4), PipeId2);
+    UtAssert_NOT_NULL(DestPtr);
+    UtAssert_BOOL_TRUE(DestPtr->IsMaskDest);
+
+    /* A matching message ID with no other subscriber is delivered through its route */
+    RouteId = CFE_SBR_GetRouteId(MsgId);
+    UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(RouteId));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_EVENTNOTSENT(CFE_SB_SEND_NO_SUBS_EID);
+    DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId2);
+    UtAssert_NOT_NULL(DestPtr);
+    UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
+
+    /* Deleting the pipe drops its mask subscription */
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+    UtAssert_ZERO(CFE_SB_Global.NumMaskSubs);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId)));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+}
+
+/*
+** Test mask subscription response to bad arguments and a full table
+*/
+void Test_Subscribe_MaskErrors(void)
+{
+    CFE_SB_PipeId_t     PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_Atom_t Mask   = ~((CFE_SB_MsgId_Atom_t)0x7);
+    CFE_SB_PipeD_t *    PipeDscPtr;
+    CFE_ES_AppId_t      RealOwner;
+    uint16              PipeDepth = 10;
+    uint32              i;
+
+    UtAssert_INT32_EQ(CFE_SB_SubscribeMask(SB_UT_TLM_MID, Mask, SB_UT_PIPEID_2, 1), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUB_INV_PIPE_EID);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
+
+    UtAssert_INT32_EQ(CFE_SB_SubscribeMask(SB_UT_ALTERNATE_INVALID_MID, Mask, PipeId, 1), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUB_ARG_ERR_EID);
+
+    /* Change owner of pipe through memory corruption */
+    PipeDscPtr        = CFE_SB_LocatePipeDescByID(PipeId);
+    RealOwner         = PipeDscPtr->AppId;
+    PipeDscPtr->AppId = UT_SB_AppID_Modify(RealOwner, 1);
+    UtAssert_INT32_EQ(CFE_SB_SubscribeMask(SB_UT_TLM_MID, Mask, PipeId, 1), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUB_INV_CALLER_EID);
+    PipeDscPtr->AppId = RealOwner;
+
+    /* Bits outside of the mask do not make a different subscription */
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeMask(SB_UT_TLM_MID, Mask, PipeId, 1));
+    CFE_UtAssert_SUCCESS(CFE_SB_SubscribeMask(SB_UT_TLM_MID1, Mask, PipeId, 1));
+    CFE_UtAssert_EVENTSENT(CFE_SB_DUP_SUBSCRIP_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.NumMaskSubs, 1);
+
+    /* A mask matching more message IDs than the routing table holds fails and leaves no trace */
+    UtAssert_INT32_EQ(CFE_SB_SubscribeMask(SB_UT_CMD_MID, 0, PipeId, 1), CFE_SB_MAX_MSGS_MET);
+    CFE_UtAssert_EVENTSENT(CFE_SB_MAX_MSGS_MET_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.NumMaskSubs, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 8);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(SB_UT_CMD_MID)));
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID), PipeId));
+
+    for (i = 1; i < CFE_PLATFORM_SB_MAX_MASK_SUBS; ++i)
+    {
+        CFE_UtAssert_SETUP(
+            CFE_SB_SubscribeMask(CFE_SB_ValueToMsgId(SB_UT_TLM_MID_VALUE_BASE + (i * 8)), Mask, PipeId, 1));
+    }
+
+    UtAssert_INT32_EQ(CFE_SB_SubscribeMask(SB_UT_CMD_MID, Mask, PipeId, 1), CFE_SB_MAX_MASK_SUBS_MET);
+    CFE_UtAssert_EVENTSENT(CFE_SB_MAX_MASK_SUBS_MET_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.NumMaskSubs);
+}
+
+/*
+** Test decimation and rate limiting of a subscription
+*/
+void Test_Subscribe_DeliveryRate(void)
+{
+    CFE_SB_PipeId_t       PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t        MsgId  = SB_UT_TLM_MID;
+    CFE_SB_MsgId_t        MsgIdList[6];
+    CFE_MSG_Size_t        SizeList[6];
+    CFE_MSG_Type_t        TypeList[6];
+    SB_UT_Test_Tlm_t      TlmPkt;
+    CFE_SB_PipeD_t *      PipeDscPtr;
+    CFE_SB_DestinationD_t Dest;
+    CFE_ES_AppId_t        RealOwner;
+    uint32                i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    for (i = 0; i < 6; ++i)
+    {
+        MsgIdList[i] = MsgId;
+        SizeList[i]  = sizeof(TlmPkt);
+        TypeList[i]  = CFE_MSG_Type_Tlm;
+    }
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "TestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_DEFAULT_QOS, 8));
+
+    /* Only existing subscriptions of the caller's own pipes */
+    UtAssert_INT32_EQ(CFE_SB_SetDeliveryRate(SB_UT_TLM_MID1, PipeId, 3, 0), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_SetDeliveryRate(SB_UT_ALTERNATE_INVALID_MID, PipeId, 3, 0), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_SetDeliveryRate(MsgId, SB_UT_ALTERNATE_INVALID_PIPEID, 3, 0), CFE_SB_BAD_ARGUMENT);
+    PipeDscPtr        = CFE_SB_LocatePipeDescByID(PipeId);
+    RealOwner         = PipeDscPtr->AppId;
+    PipeDscPtr->AppId = UT_SB_AppID_Modify(RealOwner, 1);
+    UtAssert_INT32_EQ(CFE_SB_SetDeliveryRate(MsgId, PipeId, 3, 0), CFE_SB_BAD_ARGUMENT);
+    PipeDscPtr->AppId = RealOwner;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_SB_SetDeliveryRate(MsgId, PipeId, 3, 0), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Every third message is delivered, starting with the next one, the others never reach the pipe */
+    CFE_UtAssert_SUCCESS(CFE_SB_SetDeliveryRate(MsgId, PipeId, 3, 0));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), TypeList, sizeof(TypeList), false);
+    for (i = 0; i < 6; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+
+    UtAssert_STUB_COUNT(OS_QueuePut, 2);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 2);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MsgLimitErrorCounter);
+
+    /* Rate is turned into an interval that is rounded up */
+    CFE_UtAssert_SUCCESS(CFE_SB_SetDeliveryRate(MsgId, PipeId, 0, 3));
+    UtAssert_UINT32_EQ(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId)->MinInterval, 333334);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+    /* Minimum interval, including a wrap of the time */
+    memset(&Dest, 0, sizeof(Dest));
+    Dest.MinInterval  = 100;
+    Dest.LastDelivery = 900;
+    UtAssert_BOOL_TRUE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 1000));
+    UtAssert_BOOL_FALSE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 1050));
+    UtAssert_BOOL_TRUE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 1100));
+    UtAssert_UINT32_EQ(Dest.LastDelivery, 1100);
+    Dest.LastDelivery = 0xFFFFFFF0;
+    UtAssert_BOOL_FALSE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 0x100000050));
+    UtAssert_BOOL_TRUE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 0x100000060));
+    UtAssert_UINT32_EQ(Dest.LastDeliveryEpoch, 1);
+    UtAssert_UINT32_EQ(Dest.LastDelivery, 0x60);
+
+    /* A destination idle for a whole wrap of the low 32 bits is due again */
+    UtAssert_BOOL_TRUE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 0x200000070));
+    UtAssert_UINT32_EQ(Dest.LastDeliveryEpoch, 2);
+    UtAssert_BOOL_FALSE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 0x2000000D0));
+
+    /* With both, the interval only applies to what is left by the decimation */
+    Dest.Decimation        = 2;
+    Dest.LastDelivery      = 100;
+    Dest.LastDeliveryEpoch = 0;
+    UtAssert_BOOL_TRUE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 200));
+    UtAssert_BOOL_FALSE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 210));
+    UtAssert_BOOL_FALSE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 220));
+    UtAssert_BOOL_FALSE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 230));
+    UtAssert_BOOL_TRUE(CFE_SB_TransmitTxn_IsDeliveryDue(&Dest, 300));
+    UtAssert_UINT32_EQ(Dest.DecimationCount, 1);
+}
+
 /*
 ** Function for calling SB unsubscribe API test functions
 */
@@ -2589,6 +3191,7 @@ void Test_Unsubscribe_API(void)
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_NoMatch);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_InvalidPipe);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_InvalidPipeOwner);
+    SB_UT_ADD_SUBTEST(Test_Unsubscribe_Mask);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_FirstDestWithMany);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_MiddleDestWithMany);
     SB_UT_ADD_SUBTEST(Test_Unsubscribe_GetDestPtr);
@@ -2790,6 +3393,65 @@ void Test_Unsubscribe_InvalidPipeOwner(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test API to remove a mask subscription
+*/
+void Test_Unsubscribe_Mask(void)
+{
+    CFE_SB_PipeId_t     PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t     PipeId2 = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_Atom_t Mask    = ~((CFE_SB_MsgId_Atom_t)0x7);
+    CFE_SB_PipeD_t *    PipeDscPtr;
+    CFE_ES_AppId_t      RealOwner;
+    uint16              PipeDepth = 10;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, PipeDepth, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, PipeDepth, "TestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeMask(SB_UT_TLM_MID, Mask, PipeId1, 4));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeMask(SB_UT_TLM_MID, ~((CFE_SB_MsgId_Atom_t)0x1), PipeId1, 4));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID1, PipeId1));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID1, PipeId2));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID2, PipeId2));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID, PipeId2));
+
+    UtAssert_INT32_EQ(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID, Mask, SB_UT_PIPEID_3), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_UNSUB_INV_PIPE_EID);
+    UtAssert_INT32_EQ(CFE_SB_UnsubscribeMask(SB_UT_ALTERNATE_INVALID_MID, Mask, PipeId1), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_UNSUB_ARG_ERR_EID);
+
+    PipeDscPtr        = CFE_SB_LocatePipeDescByID(PipeId1);
+    RealOwner         = PipeDscPtr->AppId;
+    PipeDscPtr->AppId = UT_SB_AppID_Modify(RealOwner, 1);
+    UtAssert_INT32_EQ(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID, Mask, PipeId1), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_UNSUB_INV_CALLER_EID);
+    PipeDscPtr->AppId = RealOwner;
+
+    CFE_UtAssert_SUCCESS(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID1, Mask, PipeId1));
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUBSCRIPTION_REMOVED_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.NumMaskSubs, 1);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(SB_UT_TLM_MID3)));
+
+    /* Single message ID subscriptions stay, as do destinations still matched by another mask */
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID1), PipeId1));
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID), PipeId1));
+    UtAssert_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID2), PipeId1));
+    UtAssert_NOT_NULL(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(SB_UT_TLM_MID2), PipeId2));
+
+    UT_ClearEventHistory();
+    CFE_UtAssert_SUCCESS(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID, Mask, PipeId1));
+    CFE_UtAssert_EVENTSENT(CFE_SB_UNSUB_NO_SUBS_EID);
+
+    /* Removing the last destination of a route removes the route */
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(SB_UT_TLM_MID2)));
+    UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(SB_UT_TLM_MID)));
+    CFE_UtAssert_SUCCESS(CFE_SB_UnsubscribeMask(SB_UT_TLM_MID, ~((CFE_SB_MsgId_Atom_t)0x1), PipeId1));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(SB_UT_TLM_MID)));
+    UtAssert_ZERO(CFE_SB_Global.NumMaskSubs);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+}
+
 /*
 ** Test message unsubscription response to the first pipe destination when
 ** the message is subscribed to by multiple pipes
@@ -3066,7 +3728,10 @@ void Test_TransmitTxn_FindDestinations(void)
     CFE_SB_PipeId_t            PipeId = CFE_SB_INVALID_PIPE;
     CFE_SB_MsgId_t             MsgId  = SB_UT_TLM_MID;
     CFE_SBR_RouteId_t          RouteId;
+    CFE_SB_RouteId_Atom_t      RouteIdx;
     CFE_SB_DestinationD_t *    DestPtr;
+    CFE_SB_RouteSnapshot_t *   SnapshotPtr;
+    uint32                     GetAppIdCount;
 
     memset(&BufDsc, 0, sizeof(BufDsc));
     CFE_SB_TrackingListReset(&BufDsc.Link); /* so tracking list ops work */
@@ -3075,25 +3740,28 @@ void Test_TransmitTxn_FindDestinations(void)
     CFE_UtAssert_SETUP(CFE_SB_SubscribeFull(MsgId, PipeId, CFE_SB_DEFAULT_QOS, 2, CFE_SB_MSG_GLOBAL));
     PipeDscPtr                 = CFE_SB_LocatePipeDescByID(PipeId);
     RouteId                    = CFE_SBR_GetRouteId(MsgId);
+    RouteIdx                   = CFE_SBR_RouteIdToValue(RouteId);
     DestPtr                    = CFE_SB_GetDestPtr(RouteId, PipeId);
     Txn                        = CFE_SB_TransmitTxn_Init(&TxnBuf, &BufDsc.Content);
     PipeDscPtr->PeakQueueDepth = 1;
 
-    CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter = 0;
+    CFE_SB_Global.Counters.NoSubscribersCounter = 0;
 
     /* No subscriber case */
     Txn->RoutingMsgId = CFE_SB_INVALID_MSG_ID;
     UtAssert_VOIDCALL(CFE_SB_TransmitTxn_FindDestinations(Txn, &BufDsc));
-    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.NoSubscribersCounter, 1);
     UtAssert_UINT32_EQ(Txn->TransactionEventId, CFE_SB_SEND_NO_SUBS_EID);
     UtAssert_UINT32_EQ(BufDsc.UseCount, 0);
 
-    /* Nominal Case 1 */
+    /* Nominal Case 1, no destination has IGNOREMINE so the sender is not looked up */
     memset(&BufDsc, 0, sizeof(BufDsc));
     Txn = CFE_SB_TransmitTxn_Init(&TxnBuf, &BufDsc.Content);
     CFE_SB_TrackingListReset(&BufDsc.Link); /* so tracking list ops work */
     Txn->RoutingMsgId = MsgId;
+    GetAppIdCount     = UT_GetStubCount(UT_KEY(CFE_ES_GetAppID));
     UtAssert_VOIDCALL(CFE_SB_TransmitTxn_FindDestinations(Txn, &BufDsc));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_GetAppID)), GetAppIdCount);
     UtAssert_UINT32_EQ(Txn->NumPipes, 1);
     CFE_UtAssert_RESOURCEID_EQ(Txn->PipeSet[0].PipeId, PipeId);
     UtAssert_UINT32_EQ(Txn->PipeSet[0].PendingEventId, 0);
@@ -3149,11 +3817,15 @@ void Test_TransmitTxn_FindDestinations(void)
     UtAssert_UINT32_EQ(DestPtr->BuffCount, 0);
     DestPtr->Active = CFE_SB_ACTIVE;
 
-    /* Pipe "Ignore Mine" Option Case w/Matching AppID */
+    /* Pipe "Ignore Mine" Option Case w/Matching AppID, the snapshot must be rebuilt to see the option */
     Txn               = CFE_SB_TransmitTxn_Init(&TxnBuf, &BufDsc.Content);
     Txn->RoutingMsgId = MsgId;
     PipeDscPtr->Opts |= CFE_SB_PIPEOPTS_IGNOREMINE;
+    CFE_SB_PublishRouteSnapshot(RouteId);
+    UtAssert_BOOL_TRUE(CFE_SB_Global.RouteSnapshot[RouteIdx]->HasIgnoreMine);
+    GetAppIdCount = UT_GetStubCount(UT_KEY(CFE_ES_GetAppID));
     UtAssert_VOIDCALL(CFE_SB_TransmitTxn_FindDestinations(Txn, &BufDsc));
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_GetAppID)), GetAppIdCount + 1);
     UtAssert_ZERO(Txn->NumPipes);
     UtAssert_UINT32_EQ(BufDsc.UseCount, 0);
     UtAssert_UINT32_EQ(DestPtr->BuffCount, 0);
@@ -3168,14 +3840,19 @@ void Test_TransmitTxn_FindDestinations(void)
     UtAssert_UINT32_EQ(DestPtr->BuffCount, 1);
     CFE_ES_GetAppID(&PipeDscPtr->AppId);
     PipeDscPtr->Opts &= ~CFE_SB_PIPEOPTS_IGNOREMINE;
+    CFE_SB_PublishRouteSnapshot(RouteId);
 
     /* DestPtr List too long - this emulates a hypothetical bug in SBR allowing list to grow too long */
-    /* Hack to make it infinite length */
-    DestPtr->Next     = DestPtr;
-    Txn               = CFE_SB_TransmitTxn_Init(&TxnBuf, &BufDsc.Content);
-    Txn->RoutingMsgId = MsgId;
+    /* Hack to make it infinite length, and force the list itself to be read instead of the snapshot */
+    SnapshotPtr                           = CFE_SB_Global.RouteSnapshot[RouteIdx];
+    CFE_SB_Global.RouteSnapshot[RouteIdx] = &CFE_SB_Global.LockedRouteSnapshot;
+    DestPtr->Next                         = DestPtr;
+    Txn                                   = CFE_SB_TransmitTxn_Init(&TxnBuf, &BufDsc.Content);
+    Txn->RoutingMsgId                     = MsgId;
     UtAssert_VOIDCALL(CFE_SB_TransmitTxn_FindDestinations(Txn, &BufDsc));
     UtAssert_UINT32_EQ(Txn->NumPipes, CFE_PLATFORM_SB_MAX_DEST_PER_PKT);
+    DestPtr->Next                         = NULL;
+    CFE_SB_Global.RouteSnapshot[RouteIdx] = SnapshotPtr;
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
@@ -3443,29 +4120,29 @@ void Test_MessageTxn_ReportEvents(void)
 
     /* nominal */
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_ReportEvents(&Txn));
-    UtAssert_ZERO(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MsgSendErrorCounter);
 
     /* with an event at the transaction level, known to be an error */
     Txn.TransactionEventId = CFE_SB_MSG_TOO_BIG_EID;
     Txn.IsTransmit         = true;
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_ReportEvents(&Txn));
-    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.MsgSendErrorCounter, 1);
 
     /* with some undefined/unknown event at the transaction level, not an error */
     Txn.TransactionEventId = 0xFFFF;
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_ReportEvents(&Txn));
-    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.MsgSendErrorCounter, 1);
 
     /* with an event at the pipe level, known to be an error */
     Txn.TransactionEventId        = 0;
     Txn.PipeSet[0].PendingEventId = CFE_SB_Q_FULL_ERR_EID;
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_ReportEvents(&Txn));
-    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.MsgSendErrorCounter, 2);
 
     /* with some undefined/unknown event at the pipe level, not an error */
     Txn.PipeSet[0].PendingEventId = 0xFFFF;
     UtAssert_VOIDCALL(CFE_SB_MessageTxn_ReportEvents(&Txn));
-    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.MsgSendErrorCounter, 2);
 }
 
 /*
@@ -3482,8 +4159,10 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_PipeFull);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_MsgLimitExceeded);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_GetPoolBufErr);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgV);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_IncrementSeqCnt);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_NoIncrement);
+    SB_UT_ADD_SUBTEST(Test_TransmitBufferBatch);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_ZeroCopyBufferValidate);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_DisabledDestination);
 
@@ -3501,6 +4180,9 @@ void Test_TransmitMsg_API(void)
 
     SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer);
     SB_UT_ADD_SUBTEST(Test_ReleaseMessageBuffer);
+    SB_UT_ADD_SUBTEST(Test_CreateBufferPool);
+    SB_UT_ADD_SUBTEST(Test_AllocatePoolMessageBuffer);
+    SB_UT_ADD_SUBTEST(Test_DeleteBufferPool);
 }
 
 /*
@@ -3549,14 +4231,14 @@ void Test_TransmitMsg_MaxMsgSizePlusOne(void)
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
-    CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter = 0;
+    CFE_SB_Global.Counters.MsgSendErrorCounter = 0;
 
     UtAssert_INT32_EQ(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true), CFE_SB_MSG_TOO_BIG);
 
     CFE_UtAssert_EVENTCOUNT(1);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_MSG_TOO_BIG_EID);
-    UtAssert_INT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+    UtAssert_INT32_EQ(CFE_SB_Global.Counters.MsgSendErrorCounter, 1);
 }
 
 /*
@@ -3663,10 +4345,11 @@ void Test_TransmitMsg_UpdateHeader(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
-    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true)); /* increment to 3 */
-    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, 3);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true)); /* route was removed */
+    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, 2);
     UtAssert_STUB_COUNT(CFE_MSG_OriginationAction, 3);
-    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 3);
+    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 2);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_NO_SUBS_EID);
 
     CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId)); /* resubscribe so we can receive a msg */
 
@@ -3677,9 +4360,9 @@ void Test_TransmitMsg_UpdateHeader(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
     CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true)); /* increment to 4 */
     UtAssert_INT32_EQ(SeqCnt, SeqCntExpected);
-    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, 4);
+    UtAssert_STUB_COUNT(CFE_MSG_SetSequenceCount, 3);
     UtAssert_STUB_COUNT(CFE_MSG_OriginationAction, 4);
-    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 4);
+    UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 3);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
@@ -3838,45 +4521,121 @@ void Test_TransmitMsg_GetPoolBufErr(void)
 }
 
 /*
-** Test getting a pointer to a buffer for zero copy mode with buffer
-** allocation failures
+** Test sending a message assembled from fragments
 */
-void Test_AllocateMessageBuffer(void)
+void Test_TransmitMsgV(void)
 {
-    size_t MsgSize = 10;
-    uint32 MemUse;
+    CFE_SB_PipeId_t      PipeId     = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t       MsgId      = SB_UT_TLM_MID;
+    CFE_MSG_Size_t       Size       = sizeof(SB_UT_Test_Tlm_t);
+    CFE_MSG_Type_t       Type       = CFE_MSG_Type_Tlm;
+    CFE_SB_Buffer_t *    ReceivePtr = NULL;
+    SB_UT_Test_Tlm_t     TlmPkt;
+    CFE_SB_MsgFragment_t FragList[3];
 
-    /* Attempt to allocate a message buffer greater than the max size */
-    UtAssert_NULL(CFE_SB_AllocateMessageBuffer(CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1));
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+    TlmPkt.Tlm32Param1 = 0x12345678;
+    TlmPkt.Tlm8Param4  = 0xA5;
+
+    /* Header and first parameters, an empty fragment, then the rest of the payload */
+    FragList[0].DataPtr  = &TlmPkt;
+    FragList[0].DataSize = offsetof(SB_UT_Test_Tlm_t, Tlm8Param1);
+    FragList[1].DataPtr  = NULL;
+    FragList[1].DataSize = 0;
+    FragList[2].DataPtr  = &TlmPkt.Tlm8Param1;
+    FragList[2].DataSize = sizeof(TlmPkt) - offsetof(SB_UT_Test_Tlm_t, Tlm8Param1);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2, "TransmitMsgVPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-    /* Attempt to allocate a message buffer from a non-CFE context */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
-    UtAssert_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgV(NULL, 3, true), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgV(FragList, 0, true), CFE_SB_BAD_ARGUMENT);
+    FragList[0].DataSize = sizeof(CFE_MSG_Message_t) - 1;
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgV(FragList, 3, true), CFE_SB_BAD_ARGUMENT);
+    FragList[0].DataSize = offsetof(SB_UT_Test_Tlm_t, Tlm8Param1);
+    FragList[1].DataSize = 1;
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgV(FragList, 3, true), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
 
-    /* Have GetPoolBuf stub return error on its next call (buf descriptor
-     * allocation failed)
-     */
+    /* Total size too big */
+    FragList[1].DataPtr  = &TlmPkt;
+    FragList[1].DataSize = CFE_MISSION_SB_MAX_SB_MSG_SIZE;
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgV(FragList, 3, true), CFE_SB_MSG_TOO_BIG);
+    CFE_UtAssert_EVENTSENT(CFE_SB_MSG_TOO_BIG_EID);
+    FragList[1].DataSize = 0;
+
+    /* Buffer allocation failure */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
-    UtAssert_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgV(FragList, 3, true), CFE_SB_BUF_ALOC_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_GET_BUF_ERR_EID);
 
-    CFE_UtAssert_EVENTCOUNT(0);
+    /* Failures once the buffer is filled give the buffer back */
+    UT_SetDeferredRetcode(UT_KEY(CFE_MSG_SetSize), 1, CFE_MSG_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgV(FragList, 3, true), CFE_MSG_BAD_ARGUMENT);
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
 
-    /* Increase the peak memory and buffers in use above the expected values in
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgV(FragList, 3, true), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_INV_MSGID_EID);
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+
+    /* Success, the message arrives in one piece and its size is set once */
+    UT_ResetState(UT_KEY(CFE_MSG_SetSize));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgV(FragList, 3, true));
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
+    UtAssert_STUB_COUNT(CFE_MSG_OriginationAction, 1);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_MemCmp(ReceivePtr, &TlmPkt, sizeof(TlmPkt), "Assembled message content");
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test getting a pointer to a buffer for zero copy mode with buffer
+** allocation failures
+*/
+void Test_AllocateMessageBuffer(void)
+{
+    size_t MsgSize = 10;
+    uint32 MemUse;
+
+    /* Attempt to allocate a message buffer greater than the max size */
+    UtAssert_NULL(CFE_SB_AllocateMessageBuffer(CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1));
+
+    /* Attempt to allocate a message buffer from a non-CFE context */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
+
+    /* Have GetPoolBuf stub return error on its next call (buf descriptor
+     * allocation failed)
+     */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
+
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Increase the peak memory and buffers in use above the expected values in
      * order to exercise branch paths
      */
 
     /* predict memory use for a given descriptor (this needs to match what impl does) */
-    MemUse                                              = MsgSize + offsetof(CFE_SB_BufferD_t, Content);
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse           = 0;
-    CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse       = MemUse + 10;
-    CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse + 2;
+    MemUse = CFE_SB_MemPoolDefSize[CFE_SB_GetBufFreeListIndex(MsgSize + offsetof(CFE_SB_BufferD_t, Content))];
+
+    CFE_SB_Global.Counters.MemInUse           = 0;
+    CFE_SB_Global.Counters.PeakMemInUse       = MemUse + 10;
+    CFE_SB_Global.Counters.PeakSBBuffersInUse = CFE_SB_Global.Counters.SBBuffersInUse + 2;
     UtAssert_NOT_NULL(CFE_SB_AllocateMessageBuffer(MsgSize));
 
-    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse, MemUse + 10); /* unchanged */
-    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, MemUse);          /* predicted value */
+    UtAssert_INT32_EQ(CFE_SB_Global.Counters.PeakMemInUse, MemUse + 10); /* unchanged */
+    UtAssert_INT32_EQ(CFE_SB_Global.Counters.MemInUse, MemUse);          /* predicted value */
 
-    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakSBBuffersInUse,
-                      CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse + 1);
+    UtAssert_INT32_EQ(CFE_SB_Global.Counters.PeakSBBuffersInUse,
+                      CFE_SB_Global.Counters.SBBuffersInUse + 1);
 
     CFE_UtAssert_EVENTCOUNT(0);
 }
@@ -4023,6 +4782,73 @@ void Test_TransmitBuffer_NoIncrement(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test sending a set of zero copy buffers in one call
+*/
+void Test_TransmitBufferBatch(void)
+{
+    CFE_SB_Buffer_t *SendPtr[CFE_SB_TRANSMIT_BATCH_SIZE + 2];
+    CFE_SB_MsgId_t   MsgIdList[CFE_SB_TRANSMIT_BATCH_SIZE + 2];
+    CFE_MSG_Size_t   SizeList[CFE_SB_TRANSMIT_BATCH_SIZE + 2];
+    CFE_SB_PipeId_t  PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t  PipeId2 = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t   MsgId   = SB_UT_TLM_MID;
+    uint32           Count;
+    uint32           i;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, CFE_SB_TRANSMIT_BATCH_SIZE + 3, "BatchTestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, CFE_SB_TRANSMIT_BATCH_SIZE + 3, "BatchTestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId1, CFE_SB_DEFAULT_QOS, CFE_SB_TRANSMIT_BATCH_SIZE + 3));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId2, CFE_SB_DEFAULT_QOS, CFE_SB_TRANSMIT_BATCH_SIZE + 3));
+
+    for (i = 0; i < (CFE_SB_TRANSMIT_BATCH_SIZE + 2); ++i)
+    {
+        SendPtr[i]   = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+        MsgIdList[i] = MsgId;
+        SizeList[i]  = sizeof(SB_UT_Test_Tlm_t);
+        UtAssert_NOT_NULL(SendPtr[i]);
+    }
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(NULL, 1, true, &Count), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(SendPtr, 1, true, NULL), CFE_SB_BAD_ARGUMENT);
+
+    /* Nothing to send */
+    Count = 1;
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferBatch(SendPtr, 0, true, &Count));
+    UtAssert_ZERO(Count);
+
+    /* More than one batch worth of buffers, all written to both pipes */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBufferBatch(SendPtr, CFE_SB_TRANSMIT_BATCH_SIZE + 2, true, &Count));
+    UtAssert_UINT32_EQ(Count, CFE_SB_TRANSMIT_BATCH_SIZE + 2);
+    UtAssert_STUB_COUNT(OS_QueuePut, 2 * (CFE_SB_TRANSMIT_BATCH_SIZE + 2));
+    UtAssert_UINT32_EQ(CFE_SB_LocatePipeDescByID(PipeId1)->CurrentQueueDepth, CFE_SB_TRANSMIT_BATCH_SIZE + 2);
+    UtAssert_UINT32_EQ(CFE_SB_LocatePipeDescByID(PipeId2)->CurrentQueueDepth, CFE_SB_TRANSMIT_BATCH_SIZE + 2);
+
+    /* Stops at a buffer that fails validation, leaving it and the rest with the caller */
+    for (i = 0; i < 3; ++i)
+    {
+        SendPtr[i] = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+        UtAssert_NOT_NULL(SendPtr[i]);
+    }
+
+    MsgIdList[1] = CFE_SB_INVALID_MSG_ID;
+    UT_ResetState(UT_KEY(OS_QueuePut));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UtAssert_INT32_EQ(CFE_SB_TransmitBufferBatch(SendPtr, 3, true, &Count), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_STUB_COUNT(OS_QueuePut, 2);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_INV_MSGID_EID);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(SendPtr[1]));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(SendPtr[2]));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+}
+
 /*
 ** Test releasing a pointer to a buffer for zero copy mode
 */
@@ -4058,6 +4884,179 @@ void Test_ReleaseMessageBuffer(void)
     CFE_UtAssert_EVENTCOUNT(0);
 }
 
+/*
+** Test creating a producer buffer pool
+*/
+void Test_CreateBufferPool(void)
+{
+    CFE_SB_BufferPoolId_t PoolId;
+    CFE_SB_BufferPool_t * PoolPtr;
+    CFE_SB_BufferPoolId_t PoolIdList[CFE_PLATFORM_SB_MAX_BUFFER_POOLS];
+    uint32                i;
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferPool(NULL, 10, 1), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferPool(&PoolId, 10, 0), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferPool(&PoolId, CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1, 1), CFE_SB_BAD_ARGUMENT);
+
+    /* Not called from an app */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferPool(&PoolId, 10, 1), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Memory runs out part way through (when refilling the free list again), nothing is kept */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), CFE_PLATFORM_SB_BUF_CACHE_REFILL + 1, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferPool(&PoolId, 10, CFE_PLATFORM_SB_BUF_CACHE_REFILL + 1), CFE_SB_BUF_ALOC_ERR);
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+
+    /* Success, the buffers stay allocated for the life of the pool */
+    CFE_UtAssert_SUCCESS(CFE_SB_CreateBufferPool(&PoolId, 10, 4));
+    PoolPtr = CFE_SB_LocateBufferPoolByID(PoolId);
+    UtAssert_BOOL_TRUE(CFE_SB_BufferPoolIsMatch(PoolPtr, PoolId));
+    UtAssert_UINT32_EQ(PoolPtr->NumBuffers, 4);
+    UtAssert_UINT32_EQ(PoolPtr->NumFree, 4);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.SBBuffersInUse, 4);
+
+    /* Fill the table */
+    for (i = 1; i < CFE_PLATFORM_SB_MAX_BUFFER_POOLS; ++i)
+    {
+        CFE_UtAssert_SETUP(CFE_SB_CreateBufferPool(&PoolIdList[i], 10, 1));
+    }
+
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferPool(&PoolIdList[0], 10, 1), CFE_SB_MAX_BUFFER_POOLS_MET);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeleteBufferPool(PoolId));
+    for (i = 1; i < CFE_PLATFORM_SB_MAX_BUFFER_POOLS; ++i)
+    {
+        CFE_UtAssert_TEARDOWN(CFE_SB_DeleteBufferPool(PoolIdList[i]));
+    }
+
+    CFE_UtAssert_EVENTCOUNT(0);
+}
+
+/*
+** Test getting buffers from a producer pool and having them come back to it
+*/
+void Test_AllocatePoolMessageBuffer(void)
+{
+    CFE_SB_BufferPoolId_t PoolId;
+    CFE_SB_BufferPool_t * PoolPtr;
+    CFE_SB_Buffer_t *     BufPtr1;
+    CFE_SB_Buffer_t *     BufPtr2;
+    CFE_SB_Buffer_t *     ReceivePtr = NULL;
+    CFE_SB_PipeId_t       PipeId     = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t        MsgId      = SB_UT_TLM_MID;
+    CFE_MSG_Size_t        Size       = sizeof(SB_UT_Test_Tlm_t);
+    CFE_MSG_Type_t        Type       = CFE_MSG_Type_Tlm;
+    CFE_ES_AppId_t        AppId;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "PoolTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_CreateBufferPool(&PoolId, sizeof(SB_UT_Test_Tlm_t), 2));
+    PoolPtr = CFE_SB_LocateBufferPoolByID(PoolId);
+
+    /* Bad pool ID */
+    UtAssert_NULL(CFE_SB_AllocatePoolMessageBuffer(CFE_SB_INVALID_BUFFER_POOL));
+
+    /* Not called from an app */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_NULL(CFE_SB_AllocatePoolMessageBuffer(PoolId));
+
+    /* Only the owner may take buffers */
+    CFE_ES_GetAppID(&AppId);
+    UT_SetAppID(CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2)));
+    UtAssert_NULL(CFE_SB_AllocatePoolMessageBuffer(PoolId));
+    UT_SetAppID(AppId);
+
+    /* Take all buffers, then the pool is exhausted */
+    BufPtr1 = CFE_SB_AllocatePoolMessageBuffer(PoolId);
+    BufPtr2 = CFE_SB_AllocatePoolMessageBuffer(PoolId);
+    UtAssert_NOT_NULL(BufPtr1);
+    UtAssert_NOT_NULL(BufPtr2);
+    UtAssert_NULL(CFE_SB_AllocatePoolMessageBuffer(PoolId));
+    UtAssert_ZERO(PoolPtr->NumFree);
+
+    /* A buffer released unsent goes back to the pool */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr2));
+    UtAssert_UINT32_EQ(PoolPtr->NumFree, 1);
+
+    /* A transmitted buffer is delivered by reference and stays out of the pool while the receiver has it */
+    ((SB_UT_Test_Tlm_t *)BufPtr1)->Tlm8Param1 = 0xA5;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBuffer(BufPtr1, true));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_ADDRESS_EQ(ReceivePtr, BufPtr1);
+    UtAssert_UINT32_EQ(PoolPtr->NumFree, 1);
+
+    /* Once the receiver is done with it, the buffer goes back without a memory pool call */
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_UINT32_EQ(PoolPtr->NumFree, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.SBBuffersInUse, 2);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+
+    /* The content is left as the last user had it */
+    UtAssert_ADDRESS_EQ(CFE_SB_AllocatePoolMessageBuffer(PoolId), BufPtr1);
+    UtAssert_UINT32_EQ(((SB_UT_Test_Tlm_t *)BufPtr1)->Tlm8Param1, 0xA5);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr1));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeleteBufferPool(PoolId));
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_SUBSCRIPTION_RCVD_EID);
+}
+
+/*
+** Test deleting a producer buffer pool
+*/
+void Test_DeleteBufferPool(void)
+{
+    CFE_SB_BufferPoolId_t PoolId;
+    CFE_SB_BufferPool_t * PoolPtr;
+    CFE_SB_Buffer_t *     BufPtr;
+    CFE_ES_AppId_t        AppId;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreateBufferPool(&PoolId, 10, 2));
+    PoolPtr = CFE_SB_LocateBufferPoolByID(PoolId);
+
+    /* Bad pool ID */
+    UtAssert_INT32_EQ(CFE_SB_DeleteBufferPool(CFE_SB_INVALID_BUFFER_POOL), CFE_SB_BAD_ARGUMENT);
+
+    /* Not called from an app */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_SB_DeleteBufferPool(PoolId), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Only the owner may delete the pool */
+    CFE_ES_GetAppID(&AppId);
+    UT_SetAppID(CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2)));
+    UtAssert_INT32_EQ(CFE_SB_DeleteBufferPool(PoolId), CFE_SB_BAD_ARGUMENT);
+    UT_SetAppID(AppId);
+
+    /* Delete while a buffer is still in use, the slot is kept until it comes back */
+    BufPtr = CFE_SB_AllocatePoolMessageBuffer(PoolId);
+    UtAssert_NOT_NULL(BufPtr);
+    CFE_UtAssert_SUCCESS(CFE_SB_DeleteBufferPool(PoolId));
+    UtAssert_INT32_EQ(CFE_SB_DeleteBufferPool(PoolId), CFE_SB_BAD_ARGUMENT);
+    UtAssert_NULL(CFE_SB_AllocatePoolMessageBuffer(PoolId));
+    UtAssert_BOOL_TRUE(CFE_SB_BufferPoolIsUsed(PoolPtr));
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.SBBuffersInUse, 1);
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(BufPtr));
+    UtAssert_BOOL_FALSE(CFE_SB_BufferPoolIsUsed(PoolPtr));
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+
+    /* Pools are deleted along with the owning app, but not those of other apps */
+    CFE_UtAssert_SETUP(CFE_SB_CreateBufferPool(&PoolId, 10, 2));
+    UT_SetAppID(CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2)));
+    CFE_UtAssert_SETUP(CFE_SB_CreateBufferPool(&PoolId, 10, 1));
+    UT_SetAppID(AppId);
+    CFE_SB_CleanUpApp(AppId);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.SBBuffersInUse, 1);
+    CFE_SB_CleanUpApp(CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2)));
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+}
+
 /*
 ** Test send message response with the destination disabled
 */
@@ -4116,6 +5115,11 @@ void Test_ReceiveBuffer_API(void)
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeReadError);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PendForever);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidBufferPtr);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBufferBatch);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_RingPipe);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PriorityPipe);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_RingPipeWakeup);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeSet);
 }
 
 static void SB_UT_PipeIdModifyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
@@ -4172,7 +5176,7 @@ void Test_ReceiveBuffer_InvalidPipeId(void)
 
     CFE_UtAssert_EVENTCOUNT(1);
     CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 1);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.MsgReceiveErrorCounter, 1);
     UT_ClearEventHistory();
 
     /*
@@ -4191,8 +5195,8 @@ void Test_ReceiveBuffer_InvalidPipeId(void)
     UT_SetHandlerFunction(UT_KEY(OS_QueueGet), SB_UT_PipeIdModifyHandler, PipeDscPtr);
     UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_PIPE_RD_ERR);
     CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 1);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 1);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.MsgReceiveErrorCounter, 1);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.InternalErrorCounter, 1);
     UT_SetHandlerFunction(UT_KEY(OS_QueueGet), NULL, NULL);
 
     /* restore the PipeID so it can be deleted */
@@ -4218,8 +5222,8 @@ void Test_ReceiveBuffer_InvalidTimeout(void)
     CFE_UtAssert_EVENTCOUNT(2);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 1);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.MsgReceiveErrorCounter, 1);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.InternalErrorCounter, 0);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
@@ -4240,8 +5244,8 @@ void Test_ReceiveBuffer_Poll(void)
     CFE_UtAssert_EVENTCOUNT(1);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_PIPE_ADDED_EID);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.MsgReceiveErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.InternalErrorCounter, 0);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
@@ -4264,8 +5268,8 @@ void Test_ReceiveBuffer_Timeout(void)
     CFE_UtAssert_EVENTCOUNT(1);
 
     CFE_UtAssert_EVENTSENT(CFE_SB_PIPE_ADDED_EID);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.MsgReceiveErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.InternalErrorCounter, 0);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
@@ -4294,8 +5298,8 @@ void Test_ReceiveBuffer_PipeReadError(void)
     UT_SetHandlerFunction(UT_KEY(OS_QueueGet), SB_UT_QueueGetHandler, NULL);
     UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
     UT_SetHandlerFunction(UT_KEY(OS_QueueGet), NULL, NULL);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 3);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.MsgReceiveErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.InternalErrorCounter, 3);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
@@ -4335,8 +5339,8 @@ void Test_ReceiveBuffer_PendForever(void)
     /* Ensure that calling a second time with no message clears the LastBuffer reference */
     UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_NO_MESSAGE);
     UtAssert_NULL(PipeDscPtr->LastBuffer);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 0);
-    UtAssert_UINT8_EQ(CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.MsgReceiveErrorCounter, 0);
+    UtAssert_UINT8_EQ(CFE_SB_Global.Counters.InternalErrorCounter, 0);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
@@ -4380,20 +5384,23 @@ void Test_CleanupApp_API(void)
     CFE_SB_CleanUpApp(CFE_ES_APPID_UNDEFINED);
 
     /* This should have freed no buffers  */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.SBBuffersInUse, 3);
 
     /* Attempt again with a valid application ID */
     CFE_SB_CleanUpApp(AppID);
 
     /* This should have freed 2 out of the 3 buffers -
      * the ones which were gotten by this app. */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.SBBuffersInUse, 1);
 
     /* Clean up the second App */
     CFE_SB_CleanUpApp(AppID2);
 
     /* This should have freed the last buffer */
-    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 3);
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+
+    /* Freed buffers are kept for reuse rather than given back to the pool */
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
 
     CFE_UtAssert_EVENTCOUNT(2);
 
@@ -4421,6 +5428,487 @@ void Test_ReceiveBuffer_InvalidBufferPtr(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test receiving several messages in one call
+*/
+void Test_ReceiveBufferBatch(void)
+{
+    CFE_SB_Buffer_t *BufArray[4];
+    CFE_SB_MsgId_t   MsgIdList[3];
+    CFE_MSG_Size_t   SizeList[3];
+    CFE_MSG_Type_t   TypeList[3];
+    CFE_SB_PipeId_t  PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t   MsgId  = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_PipeD_t * PipeDscPtr;
+    uint32           Count;
+    uint32           i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    for (i = 0; i < 3; ++i)
+    {
+        MsgIdList[i] = MsgId;
+        SizeList[i]  = sizeof(TlmPkt);
+        TypeList[i]  = CFE_MSG_Type_Tlm;
+    }
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "RcvTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_DEFAULT_QOS, 10));
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(PipeId, NULL, 4, CFE_SB_POLL, &Count), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(PipeId, BufArray, 4, CFE_SB_POLL, NULL), CFE_SB_BAD_ARGUMENT);
+    Count = 1;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(PipeId, BufArray, 0, CFE_SB_POLL, &Count), CFE_SB_BAD_ARGUMENT);
+    UtAssert_ZERO(Count);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+
+    /* Nothing on the pipe */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(PipeId, BufArray, 4, CFE_SB_POLL, &Count), CFE_SB_NO_MESSAGE);
+    UtAssert_ZERO(Count);
+
+    /* All queued messages are returned in one call, and held by the pipe */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), TypeList, sizeof(TypeList), false);
+    for (i = 0; i < 3; ++i)
+    {
+        CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 3);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(PipeId, BufArray, 4, CFE_SB_PEND_FOREVER, &Count));
+    UtAssert_UINT32_EQ(Count, 3);
+    UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBuffer->Content, BufArray[0]);
+    UtAssert_UINT32_EQ(PipeDscPtr->NumBatchBuffers, 2);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->BatchBuffers[0]->Content, BufArray[1]);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->BatchBuffers[1]->Content, BufArray[2]);
+
+    /* The next receive releases all of them */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferBatch(PipeId, BufArray, 4, CFE_SB_POLL, &Count), CFE_SB_NO_MESSAGE);
+    UtAssert_ZERO(Count);
+    UtAssert_NULL(PipeDscPtr->LastBuffer);
+    UtAssert_ZERO(PipeDscPtr->NumBatchBuffers);
+
+    /* Limited by MaxCount, the rest stays on the pipe */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), TypeList, sizeof(TypeList), false);
+    for (i = 0; i < 3; ++i)
+    {
+        CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(PipeId, BufArray, 2, CFE_SB_POLL, &Count));
+    UtAssert_UINT32_EQ(Count, 2);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+
+    /* A single receive also releases the buffers from a batch */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&BufArray[0], PipeId, CFE_SB_POLL));
+    UtAssert_ZERO(PipeDscPtr->NumBatchBuffers);
+    UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+
+    /* Pipe deletion releases buffers still held from a batch */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), TypeList, sizeof(TypeList), false);
+    for (i = 0; i < 2; ++i)
+    {
+        CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(PipeId, BufArray, 4, CFE_SB_POLL, &Count));
+    UtAssert_UINT32_EQ(Count, 2);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+}
+
+/*
+** Test transmitting to and receiving from a ring buffer pipe
+*/
+void Test_ReceiveBuffer_RingPipe(void)
+{
+    CFE_SB_Buffer_t *  SBBufPtr;
+    CFE_SB_Buffer_t *  BufArray[2];
+    CFE_SB_MsgId_t     MsgIdList[4];
+    CFE_MSG_Size_t     SizeList[4];
+    CFE_MSG_Type_t     TypeList[4];
+    CFE_SB_PipeId_t    PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t     MsgId  = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t   TlmPkt;
+    CFE_SB_PipeD_t *   PipeDscPtr;
+    CFE_SB_PipeRing_t *RingPtr;
+    CFE_SB_BufferD_t * BufDscPtr;
+    uint32             Count;
+    uint32             i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    for (i = 0; i < 4; ++i)
+    {
+        MsgIdList[i] = MsgId;
+        SizeList[i]  = sizeof(TlmPkt);
+        TypeList[i]  = CFE_MSG_Type_Tlm;
+    }
+
+    /* Ring of 2 slots, with a message limit that allows more */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipeEx(&PipeId, 2, "RingPipe", CFE_SB_PIPEOPTS_RING));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    RingPtr    = PipeDscPtr->Ring;
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_DEFAULT_QOS, 4));
+
+    /* Empty ring */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, 100), CFE_SB_TIME_OUT);
+    UtAssert_UINT32_EQ(RingPtr->ReaderParked, 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+
+    /* Fill the ring, the first write also wakes the parked reader */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), TypeList, sizeof(TypeList), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_ZERO(RingPtr->ReaderParked);
+    UtAssert_STUB_COUNT(OS_QueuePut, 0);
+
+    /* One more does not fit */
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_FULL_ERR_EID);
+    UtAssert_INT32_EQ(CFE_SB_Global.Counters.PipeOverflowErrorCounter, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 2);
+
+    /* Both messages come out in order, also when received as a batch */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferBatch(PipeId, BufArray, 2, CFE_SB_POLL, &Count));
+    UtAssert_UINT32_EQ(Count, 2);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->LastBuffer->Content, BufArray[0]);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr->BatchBuffers[0]->Content, BufArray[1]);
+    UtAssert_ZERO(PipeDscPtr->CurrentQueueDepth);
+    UtAssert_STUB_COUNT(OS_QueueGet, 0);
+
+    /* Wraps around, and pipe deletion drops what is left in the ring */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), TypeList, sizeof(TypeList), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(RingPtr->ReadPos, 3);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+
+    /* Pipe no longer exists */
+    UtAssert_INT32_EQ(CFE_SB_PipeRing_Put(PipeId, NULL, false, 1), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(CFE_SB_PipeRing_Get(PipeId, &BufDscPtr, OS_CHECK), OS_ERR_INVALID_ID);
+    UtAssert_NULL(BufDscPtr);
+    UtAssert_INT32_EQ(CFE_SB_PipeRing_Put(SB_UT_ALTERNATE_INVALID_PIPEID, NULL, false, 1), OS_ERR_INVALID_ID);
+
+    /* A depth that is not a power of two still limits the pipe, even though the ring has more slots */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipeEx(&PipeId, 3, "RingPipe", CFE_SB_PIPEOPTS_RING));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    RingPtr    = PipeDscPtr->Ring;
+    UtAssert_UINT32_EQ(RingPtr->Mask + 1, 4);
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_DEFAULT_QOS, 4));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), TypeList, sizeof(TypeList), false);
+    for (i = 0; i < 4; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    }
+    UtAssert_INT32_EQ(CFE_SB_Global.Counters.PipeOverflowErrorCounter, 2);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 3);
+    UtAssert_UINT32_EQ(RingPtr->WritePos, 3);
+
+    /* The ring itself only fills up past that, then the extra entry is taken back out */
+    UtAssert_INT32_EQ(CFE_SB_PipeRing_Write(RingPtr, NULL), OS_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_PipeRing_Write(RingPtr, NULL), OS_QUEUE_FULL);
+    RingPtr->WritePos     = 3;
+    RingPtr->Slots[3].Seq = 3;
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+}
+
+/* Arguments of SB_UT_RingWaitWriteHandler */
+typedef struct
+{
+    CFE_SB_PipeRing_t *RingPtr;
+    SB_UT_Test_Tlm_t * TlmPktPtr;
+} SB_UT_RingWaitWrite_t;
+
+/* Writes to a ring pipe from inside the wait of its reader, as another task would, until a write is held back */
+static void SB_UT_RingWaitWriteHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    SB_UT_RingWaitWrite_t *WaitWritePtr = UserObj;
+    int32                  status       = OS_SEM_TIMEOUT;
+
+    if (WaitWritePtr->RingPtr->ParkedWrites == 0)
+    {
+        CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(WaitWritePtr->TlmPktPtr->TelemetryHeader), true));
+        status = OS_SUCCESS;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*
+** Test that a ring pipe with a wakeup threshold only wakes its reader for enough messages
+*/
+void Test_ReceiveBuffer_RingPipeWakeup(void)
+{
+    CFE_SB_Buffer_t *     SBBufPtr;
+    CFE_SB_MsgId_t        MsgIdList[4];
+    CFE_MSG_Size_t        SizeList[4];
+    CFE_MSG_Type_t        TypeList[4];
+    CFE_SB_PipeId_t       PipeId = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t        MsgId  = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t      TlmPkt;
+    CFE_SB_PipeD_t *      PipeDscPtr;
+    CFE_SB_PipeRing_t *   RingPtr;
+    SB_UT_RingWaitWrite_t WaitWrite;
+    uint32                i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    for (i = 0; i < 4; ++i)
+    {
+        MsgIdList[i] = MsgId;
+        SizeList[i]  = sizeof(TlmPkt);
+        TypeList[i]  = CFE_MSG_Type_Tlm;
+    }
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipeEx(&PipeId, 4, "RingPipe", CFE_SB_PIPEOPTS_RING));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    RingPtr    = PipeDscPtr->Ring;
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(MsgId, PipeId, CFE_SB_DEFAULT_QOS, 4));
+    CFE_UtAssert_SETUP(CFE_SB_SetPipeWakeup(PipeId, 2, 10000));
+
+    /* With nothing held back, the reader waits for the whole timeout without waking up in between */
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemTimedWait), OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, 25), CFE_SB_TIME_OUT);
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 1);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 1);
+    UtAssert_STUB_COUNT(OS_BinSemTake, 1);
+    UtAssert_UINT32_EQ(RingPtr->ReaderParked, 1);
+
+    /*
+     * The first write is held back, it only gives the semaphore so the reader can start
+     * the wakeup delay.  The second one reaches the threshold and unparks the reader.
+     */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), TypeList, sizeof(TypeList), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_UINT32_EQ(RingPtr->ReaderParked, 1);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_STUB_COUNT(OS_BinSemGive, 2);
+    UtAssert_ZERO(RingPtr->ReaderParked);
+
+    /* Held back messages are visible to a polling reader right away */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+
+    /* Woken by a held back write, the reader waits no longer than the wakeup delay for more */
+    WaitWrite.RingPtr   = RingPtr;
+    WaitWrite.TlmPktPtr = &TlmPkt;
+    UT_SetHandlerFunction(UT_KEY(OS_BinSemTimedWait), SB_UT_RingWaitWriteHandler, &WaitWrite);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, 25));
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 3);
+    UtAssert_ZERO(RingPtr->ReaderParked);
+
+    /* Once the timeout of the caller is used up as well, what was held back is still received */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, 5));
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 5);
+    UT_SetHandlerFunction(UT_KEY(OS_BinSemTimedWait), NULL, NULL);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test that the urgent lane of a priority pipe is received first
+*/
+void Test_ReceiveBuffer_PriorityPipe(void)
+{
+    CFE_SB_Buffer_t *  SBBufPtr;
+    CFE_SB_MsgId_t     MsgIdList[3];
+    CFE_MSG_Size_t     SizeList[3];
+    CFE_MSG_Type_t     TypeList[3];
+    CFE_SB_PipeId_t    PipeId   = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t     MsgId    = SB_UT_TLM_MID1;
+    CFE_SB_MsgId_t     UrgentId = SB_UT_TLM_MID2;
+    CFE_SB_Qos_t       Quality  = {CFE_SB_QosPriority_HIGH, CFE_SB_QosReliability_LOW};
+    SB_UT_Test_Tlm_t   TlmPkt;
+    CFE_SB_PipeD_t *   PipeDscPtr;
+    CFE_SB_PipeRing_t *RingPtr;
+    uint32             i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    MsgIdList[0] = MsgId;
+    MsgIdList[1] = MsgId;
+    MsgIdList[2] = UrgentId;
+    for (i = 0; i < 3; ++i)
+    {
+        SizeList[i] = sizeof(TlmPkt);
+        TypeList[i] = CFE_MSG_Type_Tlm;
+    }
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipeEx(&PipeId, 3, "PrioPipe", CFE_SB_PIPEOPTS_PRIORITY));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    RingPtr    = PipeDscPtr->Ring;
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_SubscribeEx(UrgentId, PipeId, Quality, 4));
+    UtAssert_BOOL_FALSE(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(MsgId), PipeId)->IsUrgent);
+    UtAssert_BOOL_TRUE(CFE_SB_GetDestPtr(CFE_SBR_GetRouteId(UrgentId), PipeId)->IsUrgent);
+
+    /* Waiting on an empty pipe parks the reader on both lanes */
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, 100), CFE_SB_TIME_OUT);
+    UtAssert_UINT32_EQ(RingPtr->ReaderParked, 1);
+    UtAssert_UINT32_EQ(RingPtr->UrgentLane->ReaderParked, 1);
+
+    /* The urgent message is sent last, and also wakes the parked reader */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), TypeList, sizeof(TypeList), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_STUB_COUNT(OS_BinSemGive, 2);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 3);
+
+    /* Urgent lane is drained first, then the normal lane in order */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    CFE_UtAssert_MSGID_EQ(PipeDscPtr->LastBuffer->MsgId, UrgentId);
+    UtAssert_ZERO(RingPtr->ReaderParked);
+    UtAssert_ZERO(RingPtr->UrgentLane->ReaderParked);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    CFE_UtAssert_MSGID_EQ(PipeDscPtr->LastBuffer->MsgId, MsgId);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    CFE_UtAssert_MSGID_EQ(PipeDscPtr->LastBuffer->MsgId, MsgId);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+}
+
+/*
+** Test receiving from the first ready pipe of a set of pipes
+*/
+void Test_ReceiveBuffer_PipeSet(void)
+{
+    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_SB_MsgId_t   MsgIdList[2];
+    CFE_MSG_Size_t   SizeList[2];
+    CFE_MSG_Type_t   TypeList[2];
+    CFE_SB_PipeId_t  PipeIds[CFE_PLATFORM_SB_MAX_PIPES_PER_SET + 1];
+    CFE_SB_PipeId_t  ReadyPipeId;
+    SB_UT_Test_Tlm_t TlmPkt;
+    CFE_SB_PipeD_t * PipeDscPtr1;
+    CFE_SB_PipeD_t * PipeDscPtr2;
+    uint32           i;
+
+    memset(&TlmPkt, 0, sizeof(TlmPkt));
+
+    /* The high priority pipe is a queue, the other one a ring */
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeIds[0], 4, "SetPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipeEx(&PipeIds[1], 4, "SetPipe2", CFE_SB_PIPEOPTS_RING));
+    PipeDscPtr1 = CFE_SB_LocatePipeDescByID(PipeIds[0]);
+    PipeDscPtr2 = CFE_SB_LocatePipeDescByID(PipeIds[1]);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID1, PipeIds[0]));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID2, PipeIds[1]));
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferFromSet(NULL, PipeIds, 2, CFE_SB_POLL, NULL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferFromSet(&SBBufPtr, NULL, 2, CFE_SB_POLL, NULL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferFromSet(&SBBufPtr, PipeIds, 0, CFE_SB_POLL, NULL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(
+        CFE_SB_ReceiveBufferFromSet(&SBBufPtr, PipeIds, CFE_PLATFORM_SB_MAX_PIPES_PER_SET + 1, CFE_SB_POLL, NULL),
+        CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    PipeIds[2] = PipeIds[0];
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferFromSet(&SBBufPtr, PipeIds, 3, CFE_SB_POLL, NULL), CFE_SB_BAD_ARGUMENT);
+    PipeIds[2] = SB_UT_ALTERNATE_INVALID_PIPEID;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferFromSet(&SBBufPtr, PipeIds, 3, CFE_SB_POLL, NULL), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+
+    /* Polling needs no waiter */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferFromSet(&SBBufPtr, PipeIds, 2, CFE_SB_POLL, NULL), CFE_SB_NO_MESSAGE);
+    UtAssert_NULL(SBBufPtr);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 1);
+
+    /* Waiting, the second wakeup is a timeout and the first one is spurious */
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 2, OS_SEM_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferFromSet(&SBBufPtr, PipeIds, 2, 100, NULL), CFE_SB_TIME_OUT);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 2);
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 2);
+    UtAssert_BOOL_FALSE(CFE_SB_Global.PipeSetWaiters[0].InUse);
+    UtAssert_ZERO(CFE_SB_Global.PipeSetWaiters[0].Parked);
+    UtAssert_ZERO(PipeDscPtr1->SetWaiter);
+    UtAssert_ZERO(PipeDscPtr2->SetWaiter);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferFromSet(&SBBufPtr, PipeIds, 2, CFE_SB_PEND_FOREVER, NULL),
+                      CFE_SB_PIPE_RD_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 2);
+
+    /* A pipe can only be part of one set that is waited on */
+    PipeDscPtr2->SetWaiter = CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBufferFromSet(&SBBufPtr, PipeIds, 2, CFE_SB_PEND_FOREVER, NULL),
+                      CFE_SB_PIPE_SET_BUSY);
+    UtAssert_UINT32_EQ(PipeDscPtr2->SetWaiter, CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS);
+    UtAssert_ZERO(PipeDscPtr1->SetWaiter);
+
+    /* A transmit wakes the parked waiter of the pipe */
+    CFE_SB_Global.PipeSetWaiters[CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS - 1].Parked = 1;
+    MsgIdList[0] = SB_UT_TLM_MID2;
+    MsgIdList[1] = SB_UT_TLM_MID1;
+    for (i = 0; i < 2; ++i)
+    {
+        SizeList[i] = sizeof(TlmPkt);
+        TypeList[i] = CFE_MSG_Type_Tlm;
+    }
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgIdList, sizeof(MsgIdList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), SizeList, sizeof(SizeList), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), TypeList, sizeof(TypeList), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+    UtAssert_ZERO(CFE_SB_Global.PipeSetWaiters[CFE_PLATFORM_SB_MAX_PIPE_SET_WAITERS - 1].Parked);
+    PipeDscPtr2->SetWaiter = 0;
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* The first pipe has priority, even though its message was sent last */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferFromSet(&SBBufPtr, PipeIds, 2, CFE_SB_PEND_FOREVER, &ReadyPipeId));
+    CFE_UtAssert_RESOURCEID_EQ(ReadyPipeId, PipeIds[0]);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr1->LastBuffer->Content, SBBufPtr);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBufferFromSet(&SBBufPtr, PipeIds, 2, CFE_SB_POLL, &ReadyPipeId));
+    CFE_UtAssert_RESOURCEID_EQ(ReadyPipeId, PipeIds[1]);
+    UtAssert_ADDRESS_EQ(&PipeDscPtr2->LastBuffer->Content, SBBufPtr);
+    UtAssert_NULL(PipeDscPtr1->LastBuffer);
+    UtAssert_STUB_COUNT(OS_BinSemTake, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeIds[0]));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeIds[1]));
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+}
+
 /*
 ** Test SB Utility APIs
 */
@@ -4787,6 +6275,8 @@ void Test_SB_SpecialCases(void)
     SB_UT_ADD_SUBTEST(Test_PutDestBlk_ErrLogic);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_Buffers);
     SB_UT_ADD_SUBTEST(Test_CFE_SB_BadPipeInfo);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_RouteSnapshot);
+    SB_UT_ADD_SUBTEST(Test_CFE_SB_RouteReclaim);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_UnsubResubPath);
     SB_UT_ADD_SUBTEST(Test_MessageString);
 }
@@ -4803,6 +6293,13 @@ void Test_UseCount_Rollover_Prevention(void)
     bd.UseCount = usecount_expected;
     UtAssert_VOIDCALL(CFE_SB_IncrBufUseCnt(&bd));
     UtAssert_UINT32_EQ(bd.UseCount, usecount_expected);
+
+    /* The count never goes below zero, and only dropping the last reference reports it */
+    bd.UseCount = 2;
+    UtAssert_BOOL_FALSE(CFE_SB_DropBufUseCnt(&bd));
+    UtAssert_BOOL_TRUE(CFE_SB_DropBufUseCnt(&bd));
+    UtAssert_BOOL_FALSE(CFE_SB_DropBufUseCnt(&bd));
+    UtAssert_ZERO(bd.UseCount);
 }
 
 /*
@@ -4873,40 +6370,71 @@ void Test_PutDestBlk_ErrLogic(void)
 */
 void Test_CFE_SB_Buffers(void)
 {
-    int32 ExpRtn;
+    int32  ExpRtn;
+    uint32 ListIdx;
+    uint32 GetPoolBufCount;
+    uint32 PutPoolBufCount;
 
     CFE_SB_BufferD_t *     bd;
     CFE_SB_DestinationD_t *destptr;
 
-    CFE_SB_Global.StatTlmMsg.Payload.MemInUse     = 0;
-    CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse = sizeof(CFE_SB_BufferD_t) * 4;
+    CFE_SB_Global.Counters.MemInUse     = 0;
+    CFE_SB_Global.Counters.PeakMemInUse = sizeof(CFE_SB_BufferD_t) * 4;
     bd                                            = CFE_SB_GetBufferFromPool(0);
 
-    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.PeakMemInUse, sizeof(CFE_SB_BufferD_t) * 4);
+    UtAssert_INT32_EQ(CFE_SB_Global.Counters.PeakMemInUse, sizeof(CFE_SB_BufferD_t) * 4);
 
     CFE_UtAssert_EVENTCOUNT(0);
 
+    /* The buffer fills a whole pool block, and the rest of the refill batch is kept for reuse */
+    ListIdx = CFE_SB_GetBufFreeListIndex(offsetof(CFE_SB_BufferD_t, Content));
+    UtAssert_UINT32_EQ(bd->AllocatedSize, CFE_SB_MemPoolDefSize[ListIdx]);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, CFE_PLATFORM_SB_BUF_CACHE_REFILL);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.FreeList[ListIdx].NumFree, CFE_PLATFORM_SB_BUF_CACHE_REFILL - 1);
+
+    /* Returning it puts it back on the free list, and the next allocation reuses it */
+    CFE_SB_ReturnBufferToPool(bd);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.FreeList[ListIdx].NumFree, CFE_PLATFORM_SB_BUF_CACHE_REFILL);
+    UtAssert_ADDRESS_EQ(CFE_SB_GetBufferFromPool(0), bd);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, CFE_PLATFORM_SB_BUF_CACHE_REFILL);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+
+    /* Buffers that are not a full block size never go on a free list */
+    UtAssert_UINT32_EQ(CFE_SB_GetBufFreeListIndex(CFE_PLATFORM_SB_MAX_BLOCK_SIZE + 1),
+                       CFE_PLATFORM_ES_POOL_MAX_BUCKETS);
+    bd->AllocatedSize                         = CFE_SB_MemPoolDefSize[ListIdx] - 1;
+    CFE_SB_Global.Counters.MemInUse = bd->AllocatedSize;
+    CFE_SB_ReturnBufferToPool(bd);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MemInUse);
+
+    /* Once the free list is full, buffers go back to the pool */
+    bd = CFE_SB_GetBufferFromPool(0);
+    UtAssert_NOT_NULL(bd);
+    CFE_SB_Global.Mem.FreeList[ListIdx].NumFree = CFE_PLATFORM_SB_BUF_CACHE_DEPTH;
+
     /*
      * If returning to the pool fails SB still isn't going to use the buffer anymore,
      * so it shouldn't be tracked as "in use" - it is lost.
      */
-    ExpRtn = CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse - 1;
+    ExpRtn = CFE_SB_Global.Counters.SBBuffersInUse - 1;
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
     CFE_SB_ReturnBufferToPool(bd);
-    UtAssert_INT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.SBBuffersInUse, ExpRtn);
+    UtAssert_INT32_EQ(CFE_SB_Global.Counters.SBBuffersInUse, ExpRtn);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
 
     CFE_UtAssert_EVENTCOUNT(0);
 
     bd->UseCount = 0;
     CFE_SB_DecrBufUseCnt(bd);
     UtAssert_INT32_EQ(bd->UseCount, 0);
-    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MemInUse);
 
     CFE_UtAssert_EVENTCOUNT(0);
 
     destptr = CFE_SB_GetDestinationBlk();
     UtAssert_NOT_NULL(destptr);
-    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, sizeof(*destptr));
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.MemInUse, sizeof(*destptr));
 
     /*
      * historical behavior has CFE_SB_PutDestinationBlk() return SUCCESS even if the underlying call fails,
@@ -4914,14 +6442,228 @@ void Test_CFE_SB_Buffers(void)
      */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, -1);
     CFE_UtAssert_SUCCESS(CFE_SB_PutDestinationBlk(destptr));
-    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MemInUse, sizeof(*destptr));
+    UtAssert_UINT32_EQ(CFE_SB_Global.Counters.MemInUse, sizeof(*destptr));
 
     /* normal case should reduce MemInUse */
     UT_SetDeferredRetcode(UT_KEY(CFE_ES_PutPoolBuf), 1, sizeof(*destptr));
     CFE_UtAssert_SUCCESS(CFE_SB_PutDestinationBlk(destptr));
-    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MemInUse);
+    UtAssert_ZERO(CFE_SB_Global.Counters.MemInUse);
 
     CFE_UtAssert_EVENTCOUNT(0);
+
+    /* A free list that cannot be refilled means the pool has no block of that size left */
+    CFE_SB_InitBuffers();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    UtAssert_NULL(CFE_SB_GetBufferFromPool(0));
+    UtAssert_ZERO(CFE_SB_Global.Mem.FreeList[ListIdx].NumFree);
+    UtAssert_ZERO(CFE_SB_Global.Counters.SBBuffersInUse);
+
+    /* Large block sizes keep fewer buffers, up to the byte limit */
+    CFE_SB_InitBuffers();
+    UtAssert_UINT32_LTEQ(CFE_SB_Global.Mem.FreeList[0].MaxFree * CFE_SB_MemPoolDefSize[0],
+                         CFE_PLATFORM_SB_BUF_CACHE_BYTES);
+    UtAssert_UINT32_LTEQ(CFE_SB_Global.Mem.FreeList[ListIdx].MaxFree, CFE_PLATFORM_SB_BUF_CACHE_DEPTH);
+
+    /* A list that keeps no buffers refills just the one requested, and gives it back to the pool */
+    CFE_SB_Global.Mem.FreeList[ListIdx].MaxFree = 0;
+    GetPoolBufCount                             = UT_GetStubCount(UT_KEY(CFE_ES_GetPoolBuf));
+    PutPoolBufCount                             = UT_GetStubCount(UT_KEY(CFE_ES_PutPoolBuf));
+    bd                                          = CFE_SB_GetBufferFromPool(0);
+    UtAssert_NOT_NULL(bd);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_GetPoolBuf)), GetPoolBufCount + 1);
+    UtAssert_ZERO(CFE_SB_Global.Mem.FreeList[ListIdx].NumFree);
+    CFE_SB_ReturnBufferToPool(bd);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_ES_PutPoolBuf)), PutPoolBufCount + 1);
+    UtAssert_ZERO(CFE_SB_Global.Mem.FreeList[ListIdx].NumFree);
+    CFE_SB_InitBuffers();
+
+    /* A partial refill still provides a buffer */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, -1);
+    bd = CFE_SB_GetBufferFromPool(0);
+    UtAssert_NOT_NULL(bd);
+    UtAssert_ZERO(CFE_SB_Global.Mem.FreeList[ListIdx].NumFree);
+
+    /* Without the lock held, the lock is only taken to return the buffer after the last reference */
+    ExpRtn = CFE_SB_Global.Counters.SBBuffersInUse - 1;
+    CFE_SB_IncrBufUseCnt(bd);
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    CFE_SB_DecrBufUseCntUnlocked(bd);
+    UtAssert_UINT32_EQ(bd->UseCount, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    CFE_SB_DecrBufUseCntUnlocked(bd);
+    UtAssert_ZERO(bd->UseCount);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_INT32_EQ(CFE_SB_Global.Counters.SBBuffersInUse, ExpRtn);
+    UtAssert_UINT32_EQ(CFE_SB_Global.Mem.FreeList[ListIdx].NumFree, 1);
+}
+
+/*
+** Test publishing and release of route destination snapshots
+*/
+void Test_CFE_SB_RouteSnapshot(void)
+{
+    CFE_SB_TransmitTxn_State_t    TxnBuf;
+    CFE_SB_MessageTxn_State_t *   Txn;
+    CFE_SB_BufferD_t              BufDsc;
+    CFE_SB_PipeId_t               PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t               PipeId2 = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t                MsgId   = SB_UT_TLM_MID;
+    CFE_SBR_RouteId_t             RouteId;
+    CFE_SB_DestinationD_t *       DestPtr1;
+    const CFE_SB_RouteSnapshot_t *SnapshotPtr;
+    uint32                        RouteEpoch1;
+    uint32                        RouteEpoch2;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, 4, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, 4, "TestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId1));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId2));
+    RouteId  = CFE_SBR_GetRouteId(MsgId);
+    DestPtr1 = CFE_SB_GetDestPtr(RouteId, PipeId1);
+
+    /* Snapshot holds both destinations, in list order */
+    SnapshotPtr = CFE_SB_GetRouteSnapshot(RouteId);
+    UtAssert_NOT_NULL(SnapshotPtr);
+    UtAssert_UINT32_EQ(SnapshotPtr->NumDests, 2);
+    UtAssert_ADDRESS_EQ(SnapshotPtr->Dests[0].DestPtr, CFE_SB_GetDestPtr(RouteId, PipeId2));
+    UtAssert_ADDRESS_EQ(SnapshotPtr->Dests[1].DestPtr, DestPtr1);
+
+    /* Each entry carries what is needed to deliver to the pipe */
+    UtAssert_ADDRESS_EQ(SnapshotPtr->Dests[1].PipeDscPtr, CFE_SB_LocatePipeDescByID(PipeId1));
+    UtAssert_BOOL_TRUE(CFE_RESOURCEID_TEST_EQUAL(SnapshotPtr->Dests[1].PipeId, PipeId1));
+    UtAssert_BOOL_TRUE(OS_ObjectIdEqual(SnapshotPtr->Dests[1].SysQueueId,
+                                        CFE_SB_LocatePipeDescByID(PipeId1)->SysQueueId));
+    UtAssert_BOOL_FALSE(SnapshotPtr->Dests[1].UseRing);
+
+    /* Buffer counts are undone through the snapshot, pipes not on the route are ignored */
+    DestPtr1->BuffCount = 1;
+    UtAssert_VOIDCALL(CFE_SB_DecrRouteDestBuffCount(RouteId, CFE_SB_INVALID_PIPE));
+    UtAssert_UINT32_EQ(DestPtr1->BuffCount, 1);
+    UtAssert_VOIDCALL(CFE_SB_DecrRouteDestBuffCount(RouteId, PipeId1));
+    UtAssert_ZERO(DestPtr1->BuffCount);
+
+    /*
+     * Unsubscribe while a transmitter is reading, nothing may be released.  The old
+     * snapshot is retired in the epoch of the transmitter, which then ends, and the
+     * destination in the next one.
+     */
+    UT_ResetState(UT_KEY(CFE_ES_PutPoolBuf));
+    RouteEpoch1 = CFE_SB_RouteReadBegin();
+    CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(MsgId, PipeId1));
+    UtAssert_ADDRESS_EQ(CFE_SB_Global.RetiredSnapshots[RouteEpoch1 & 1], SnapshotPtr);
+    UtAssert_ADDRESS_EQ(CFE_SB_Global.RetiredDests[(RouteEpoch1 + 1) & 1], DestPtr1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.RouteEpoch, RouteEpoch1 + 1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+    SnapshotPtr = CFE_SB_GetRouteSnapshot(RouteId);
+    UtAssert_UINT32_EQ(SnapshotPtr->NumDests, 1);
+    UtAssert_ADDRESS_EQ(SnapshotPtr->Dests[0].DestPtr, CFE_SB_GetDestPtr(RouteId, PipeId2));
+
+    /* A transmitter starting later does not hold up the release of what the first one may be reading */
+    RouteEpoch2 = CFE_SB_RouteReadBegin();
+    UtAssert_UINT32_EQ(RouteEpoch2, RouteEpoch1 + 1);
+    CFE_SB_RouteReadEnd(RouteEpoch1);
+    UtAssert_VOIDCALL(CFE_SB_ReleaseRetiredRouteData());
+    UtAssert_NULL(CFE_SB_Global.RetiredSnapshots[RouteEpoch1 & 1]);
+    UtAssert_ADDRESS_EQ(CFE_SB_Global.RetiredDests[RouteEpoch2 & 1], DestPtr1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+
+    /* Once that transmitter is done as well, the destination is released */
+    CFE_SB_RouteReadEnd(RouteEpoch2);
+    UtAssert_VOIDCALL(CFE_SB_ReleaseRetiredRouteData());
+    UtAssert_NULL(CFE_SB_Global.RetiredSnapshots[0]);
+    UtAssert_NULL(CFE_SB_Global.RetiredSnapshots[1]);
+    UtAssert_NULL(CFE_SB_Global.RetiredDests[0]);
+    UtAssert_NULL(CFE_SB_Global.RetiredDests[1]);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+
+    /* Snapshot allocation failure falls back to reading the list while locked */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, -1);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId1));
+    UtAssert_ADDRESS_EQ(CFE_SB_GetRouteSnapshot(RouteId), &CFE_SB_Global.LockedRouteSnapshot);
+
+    memset(&BufDsc, 0, sizeof(BufDsc));
+    CFE_SB_TrackingListReset(&BufDsc.Link); /* so tracking list ops work */
+    Txn               = CFE_SB_TransmitTxn_Init(&TxnBuf, &BufDsc.Content);
+    Txn->RoutingMsgId = MsgId;
+    UtAssert_VOIDCALL(CFE_SB_TransmitTxn_FindDestinations(Txn, &BufDsc));
+    UtAssert_UINT32_EQ(Txn->NumPipes, 2);
+    UtAssert_UINT32_EQ(BufDsc.UseCount, 2);
+
+    /* Without a snapshot, buffer counts are undone by reading the list while locked */
+    DestPtr1 = CFE_SB_GetDestPtr(RouteId, PipeId1);
+    UtAssert_UINT32_EQ(DestPtr1->BuffCount, 1);
+    UtAssert_VOIDCALL(CFE_SB_DecrRouteDestBuffCount(RouteId, CFE_SB_INVALID_PIPE));
+    UtAssert_VOIDCALL(CFE_SB_DecrRouteDestBuffCount(RouteId, PipeId1));
+    UtAssert_ZERO(DestPtr1->BuffCount);
+
+    /* No snapshot once there are no destinations */
+    CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(MsgId, PipeId1));
+    CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(MsgId, PipeId2));
+    UtAssert_NULL(CFE_SB_GetRouteSnapshot(RouteId));
+    UtAssert_VOIDCALL(CFE_SB_DecrRouteDestBuffCount(RouteId, PipeId1));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+}
+
+/*
+** Test removal and reuse of routes once their last destination is gone
+*/
+void Test_CFE_SB_RouteReclaim(void)
+{
+    CFE_SB_PipeId_t   PipeId1 = CFE_SB_INVALID_PIPE;
+    CFE_SB_PipeId_t   PipeId2 = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t    MsgId1  = SB_UT_TLM_MID1;
+    CFE_SB_MsgId_t    MsgId2  = SB_UT_TLM_MID2;
+    CFE_SBR_RouteId_t RouteId;
+    uint32            RouteEpoch;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId1, 4, "TestPipe1"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId2, 4, "TestPipe2"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId1, PipeId1));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId1, PipeId2));
+    RouteId = CFE_SBR_GetRouteId(MsgId1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 1);
+
+    /* Route is kept while it still has a destination */
+    CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(MsgId1, PipeId1));
+    UtAssert_UINT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(MsgId1)), CFE_SBR_RouteIdToValue(RouteId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 1);
+
+    /* Route is removed along with its last destination, and reused by the next new message ID */
+    CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(MsgId1, PipeId2));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId1)));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId2, PipeId1));
+    UtAssert_UINT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(MsgId2)), CFE_SBR_RouteIdToValue(RouteId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 1);
+
+    /* A route removed while a transmitter is reading is not reused until the transmitter is done */
+    RouteEpoch = CFE_SB_RouteReadBegin();
+    CFE_UtAssert_SETUP(CFE_SB_Unsubscribe(MsgId2, PipeId1));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId1, PipeId1));
+    UtAssert_BOOL_FALSE(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(MsgId1)) == CFE_SBR_RouteIdToValue(RouteId));
+    CFE_SB_RouteReadEnd(RouteEpoch);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId2, PipeId1));
+    UtAssert_UINT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(MsgId2)), CFE_SBR_RouteIdToValue(RouteId));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 2);
+
+    /* Deleting the pipe removes the routes it was the only destination of */
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId1, PipeId2));
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId1));
+    UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId1)));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId2)));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 1);
+
+    /* A route added for a subscription that then fails is not kept */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 1, -1);
+    UtAssert_INT32_EQ(CFE_SB_Subscribe(MsgId2, PipeId2), CFE_SB_BUF_ALOC_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_DEST_BLK_ERR_EID);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(MsgId2)));
+    UtAssert_UINT32_EQ(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse, 1);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId2));
+    UtAssert_ZERO(CFE_SB_Global.StatTlmMsg.Payload.MsgIdsInUse);
 }
 
 /*
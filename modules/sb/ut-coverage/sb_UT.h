@@ -531,6 +531,23 @@ void Test_GetPipeOpts_BadPtr(void);
 ******************************************************************************/
 void Test_GetPipeOpts(void);
 
+/*****************************************************************************/
+/**
+** \brief Test setting the wakeup threshold of a pipe
+**
+** \par Description
+**        This function tests the set pipe wakeup API, including invalid
+**        arguments, pipes that are not ring pipes, the reported events and
+**        error counter, and delay rounding.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SetPipeWakeup(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB get pipe name by id API test functions
@@ -697,6 +714,42 @@ void Test_SB_Cmds_PipeInfoAlreadyPending(void);
 ******************************************************************************/
 void Test_SB_Cmds_PipeInfoDataGetter(void);
 
+/*****************************************************************************/
+/**
+** \brief Test write pipe latency command
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_PipeLatencyDef(void);
+
+/*****************************************************************************/
+/**
+** \brief Test pipe latency recording and data getter
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_PipeLatencyDataGetter(void);
+
+/*****************************************************************************/
+/**
+** \brief Test reset pipe latency command
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_Cmds_ResetPipeLatency(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test background file writer event handler
@@ -1213,6 +1266,38 @@ void Test_CreatePipe_EmptyPipeName(void);
 ******************************************************************************/
 void Test_CreatePipe_PipeName_NullPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test create pipe with the ring buffer option
+**
+** \par Description
+**        This function tests creating a ring buffer pipe, including failure
+**        to create the wakeup semaphore or to allocate the ring.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CreatePipe_Ring(void);
+
+/*****************************************************************************/
+/**
+** \brief Test create pipe with the priority option
+**
+** \par Description
+**        This function tests creating a pipe with an urgent lane, including
+**        failure to allocate the ring of the urgent lane.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CreatePipe_Priority(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test create pipe response to a pipe name longer than allowed
@@ -1574,6 +1659,54 @@ void Test_Subscribe_SubscriptionReporting(void);
 ******************************************************************************/
 void Test_Subscribe_InvalidPipeOwner(void);
 
+/*****************************************************************************/
+/**
+** \brief Test API to subscribe to a masked set of message IDs
+**
+** \par Description
+**        This function tests subscribing a pipe to all message IDs matching
+**        a value under a mask, for existing and new routes.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_Mask(void);
+
+/*****************************************************************************/
+/**
+** \brief Test mask subscription response to bad arguments and a full table
+**
+** \par Description
+**        This function tests the mask subscription error paths.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_MaskErrors(void);
+
+/*****************************************************************************/
+/**
+** \brief Test the delivery rate of a subscription
+**
+** \par Description
+**        This function tests that decimated and rate limited messages are
+**        not written to the pipe, and the arguments of the set delivery
+**        rate API.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Subscribe_DeliveryRate(void);
+
 /*****************************************************************************/
 /**
 ** \brief Function for calling SB unsubscribe API test functions
@@ -1720,6 +1853,22 @@ void Test_Unsubscribe_InvalidPipe(void);
 ******************************************************************************/
 void Test_Unsubscribe_InvalidPipeOwner(void);
 
+/*****************************************************************************/
+/**
+** \brief Test API to remove a mask subscription
+**
+** \par Description
+**        This function tests removing a mask subscription and the
+**        destinations and routes it added.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Unsubscribe_Mask(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test message unsubscription response to the first pipe destination
@@ -1947,6 +2096,22 @@ void Test_TransmitMsg_MsgLimitExceeded(void);
 ******************************************************************************/
 void Test_TransmitMsg_GetPoolBufErr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test sending a message assembled from fragments
+**
+** \par Description
+**        This function tests sending a message given as a list of
+**        fragments, including argument checks and error paths.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgV(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test getting a pointer to a buffer for zero copy mode with buffer
@@ -2013,6 +2178,23 @@ void Test_TransmitMsg_ZeroCopyBufferValidate(void);
 ******************************************************************************/
 void Test_TransmitBuffer_NoIncrement(void);
 
+/*****************************************************************************/
+/**
+** \brief Test sending a set of messages in zero copy mode
+**
+** \par Description
+**        This function tests sending several zero copy buffers in one call,
+**        including a set larger than one internal batch, and stopping at a
+**        buffer that fails validation.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitBufferBatch(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing a pointer to a buffer for zero copy mode
@@ -2029,6 +2211,54 @@ void Test_TransmitBuffer_NoIncrement(void);
 ******************************************************************************/
 void Test_ReleaseMessageBuffer(void);
 
+/*****************************************************************************/
+/**
+** \brief Test creating a producer buffer pool
+**
+** \par Description
+**        This function tests creating a producer buffer pool, including
+**        argument checks, allocation failure and a full pool table.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CreateBufferPool(void);
+
+/*****************************************************************************/
+/**
+** \brief Test getting buffers from a producer pool
+**
+** \par Description
+**        This function tests taking buffers from a producer pool and that
+**        they return to the pool when released or delivered.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_AllocatePoolMessageBuffer(void);
+
+/*****************************************************************************/
+/**
+** \brief Test deleting a producer buffer pool
+**
+** \par Description
+**        This function tests deleting a producer buffer pool, both directly
+**        and when the owning app is cleaned up.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_DeleteBufferPool(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send message response with the destination disabled
@@ -2221,6 +2451,88 @@ void Test_ReceiveBuffer_PendForever(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_InvalidBufferPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test receiving several messages in one call
+**
+** \par Description
+**        This function tests receiving a batch of messages, including the
+**        release of the held buffers on the next receive and on pipe deletion.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBufferBatch(void);
+
+/*****************************************************************************/
+/**
+** \brief Test transmitting to and receiving from a ring buffer pipe
+**
+** \par Description
+**        This function tests message delivery through a ring buffer pipe,
+**        including waiting on an empty ring, a full ring and pipe deletion.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_RingPipe(void);
+
+/*****************************************************************************/
+/**
+** \brief Test that the urgent lane of a priority pipe is received first
+**
+** \par Description
+**        This function tests that messages of high priority subscriptions
+**        are received ahead of older messages on the normal lane.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_PriorityPipe(void);
+
+/*****************************************************************************/
+/**
+** \brief Test that a wakeup threshold holds back the wakeup of a ring pipe reader
+**
+** \par Description
+**        This function tests that the reader of a ring pipe with a wakeup
+**        threshold is only woken once enough messages have been written,
+**        and waits no longer than the wakeup delay for them once the first
+**        one is held back.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_RingPipeWakeup(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving from the first ready pipe of a set of pipes
+**
+** \par Description
+**        This function tests CFE_SB_ReceiveBufferFromSet, including the
+**        priority order of the pipes and waking of the waiting task.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffer_PipeSet(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing zero copy buffers for all pipes owned by a
@@ -2441,6 +2753,40 @@ void Test_CFE_SB_Buffers(void);
 ******************************************************************************/
 void Test_CFE_SB_BadPipeInfo(void);
 
+/*****************************************************************************/
+/**
+** \brief Test route destination snapshots
+**
+** \par Description
+**        This function tests publishing of route snapshots on subscribe and
+**        unsubscribe, deferred release while a transmitter is reading, and
+**        the locked fallback when a snapshot cannot be allocated.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_SB_RouteSnapshot(void);
+
+/*****************************************************************************/
+/**
+** \brief Test removal and reuse of routes
+**
+** \par Description
+**        This function tests that a route is removed along with its last
+**        destination, and that it is only reused once no transmitter can
+**        still be using it.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CFE_SB_RouteReclaim(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test ReceiveBuffer function unsubscribe/resubscribe path
@@ -99,3 +99,35 @@ CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
 
     return routeid;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SBR_SetRouteId(MsgId, CFE_SBR_INVALID_ROUTE_ID);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_GetMapStats(CFE_SBR_MapStats_t *StatsPtr)
+{
+    uint32 mapidx;
+
+    memset(StatsPtr, 0, sizeof(*StatsPtr));
+
+    /* Every message ID has its own entry, so only the number of entries is of interest */
+    for (mapidx = 0; mapidx < CFE_SBR_MSG_MAP_SIZE; mapidx++)
+    {
+        if (CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[mapidx]))
+        {
+            StatsPtr->NumEntries++;
+        }
+    }
+}
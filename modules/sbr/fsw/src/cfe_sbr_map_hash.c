@@ -21,7 +21,18 @@
  *
  * Notes:
  *   These functions manipulate/access global variables and need
- *   to be protected by the SB Shared data lock.
+ *   to be protected by the SB Shared data lock.  The exception is
+ *   CFE_SBR_GetRouteId(), which is also used on the transmit path
+ *   without the lock.
+ *
+ *   Removed routes leave a placeholder, as entries cannot move under
+ *   those lookups.  Placeholders at the end of a run of entries are
+ *   dropped right away.  Once too many remain, the map is rehashed into
+ *   a spare copy, which is then put in use by lookups.  Each copy has a
+ *   sequence count that is odd while the copy is being rehashed into.
+ *   A lookup that still uses a copy from before it was replaced sees the
+ *   count change and tries again on the copy now in use, so lookups
+ *   never wait for a rehash to finish.
  *
  */
 
@@ -32,6 +43,7 @@
 #include "common_types.h"
 #include "cfe_sbr.h"
 #include "cfe_sbr_priv.h"
+#include "cfe_core_atomic.h"
 #include "cfe_sb.h"
 
 #include <string.h>
@@ -65,12 +77,45 @@
  */
 #define CFE_SBR_HASH_MAGIC (0x45d9f3b)
 
+/**
+ * \brief Placeholder left in the map where a route was removed
+ *
+ * Lookups step over it like any other entry that does not match, so the
+ * entries after it remain reachable without being moved.  Lookups run
+ * concurrently without the lock, and a moved entry could be missed.
+ * The slot is reused by the next route that probes it.
+ */
+#define CFE_SBR_REMOVED_ROUTE_ID CFE_SBR_ValueToRouteId(CFE_PLATFORM_SB_MAX_MSG_IDS)
+
+/* Verify the placeholder can be distinguished from valid route ids */
+#if (CFE_PLATFORM_SB_MAX_MSG_IDS >= 0xFFFF)
+#error CFE_PLATFORM_SB_MAX_MSG_IDS must be less than 0xFFFF to leave room for the removed route placeholder
+#endif
+
+/**
+ * \brief Number of removed route placeholders that triggers a rehash
+ *
+ * Placeholders lengthen the probes of lookups that pass them, and of
+ * lookups for message ids without a route in particular.  Half the
+ * maximum number of routes keeps over half of the map open.
+ */
+#define CFE_SBR_REMOVED_ROUTE_LIMIT (CFE_PLATFORM_SB_MAX_MSG_IDS / 2)
+
 /******************************************************************************
  * Shared data
  */
 
-/** \brief Message map shared data */
-CFE_SBR_RouteId_t CFE_SBR_MSGMAP[CFE_SBR_MSG_MAP_SIZE];
+/** \brief Message map shared data, the copy in use by lookups and the spare copy for the next rehash */
+CFE_SBR_RouteId_t CFE_SBR_MSGMAP[2][CFE_SBR_MSG_MAP_SIZE];
+
+/** \brief Index of the message map copy in use by lookups */
+uint32 CFE_SBR_MSGMAP_ACTIVE;
+
+/** \brief Number of removed route placeholders in the message map */
+uint32 CFE_SBR_MSGMAP_REMOVED;
+
+/** \brief Incremented before and after each rehash into a message map copy */
+uint32 CFE_SBR_MSGMAP_SEQUENCE[2];
 
 /*----------------------------------------------------------------
  *
@@ -98,6 +143,65 @@ CFE_SB_MsgId_Atom_t CFE_SBR_MsgIdHash(CFE_SB_MsgId_t MsgId)
     return hash;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Checks if the route id is the removed route placeholder
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_SBR_IsRemovedRouteId(CFE_SBR_RouteId_t RouteId)
+{
+    return CFE_SBR_RouteIdToValue(RouteId) == CFE_SBR_RouteIdToValue(CFE_SBR_REMOVED_ROUTE_ID);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Rebuilds the map in the spare copy without the removed route
+ * placeholders, then puts that copy in use by lookups
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_RehashMap(void)
+{
+    CFE_SBR_RouteId_t * oldmap;
+    CFE_SBR_RouteId_t * newmap;
+    CFE_SB_MsgId_Atom_t mapidx;
+    CFE_SB_MsgId_Atom_t hash;
+    uint32              newidx;
+
+    newidx = CFE_SBR_MSGMAP_ACTIVE ^ 1;
+    oldmap = CFE_SBR_MSGMAP[CFE_SBR_MSGMAP_ACTIVE];
+    newmap = CFE_SBR_MSGMAP[newidx];
+
+    /* Lookups that still use the spare copy from before it was replaced will try again */
+    CFE_ATOMIC_ADD_FETCH(&CFE_SBR_MSGMAP_SEQUENCE[newidx], 1);
+    CFE_ATOMIC_FENCE();
+
+    memset(newmap, 0, sizeof(CFE_SBR_MSGMAP[newidx]));
+
+    for (mapidx = 0; mapidx < CFE_SBR_MSG_MAP_SIZE; mapidx++)
+    {
+        if (CFE_SBR_IsValidRouteId(oldmap[mapidx]))
+        {
+            hash = CFE_SBR_MsgIdHash(CFE_SBR_GetMsgId(oldmap[mapidx]));
+            while (CFE_SBR_IsValidRouteId(newmap[hash]))
+            {
+                /* Increment or loop to start of array */
+                hash = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            }
+
+            newmap[hash] = oldmap[mapidx];
+        }
+    }
+    CFE_SBR_MSGMAP_REMOVED = 0;
+
+    CFE_ATOMIC_FENCE();
+    CFE_ATOMIC_ADD_FETCH(&CFE_SBR_MSGMAP_SEQUENCE[newidx], 1);
+    CFE_ATOMIC_STORE(&CFE_SBR_MSGMAP_ACTIVE, newidx);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -108,6 +212,9 @@ void CFE_SBR_Init_Map(void)
 {
     /* Clear the shared data */
     memset(&CFE_SBR_MSGMAP, 0, sizeof(CFE_SBR_MSGMAP));
+    memset(&CFE_SBR_MSGMAP_SEQUENCE, 0, sizeof(CFE_SBR_MSGMAP_SEQUENCE));
+    CFE_SBR_MSGMAP_ACTIVE  = 0;
+    CFE_SBR_MSGMAP_REMOVED = 0;
 }
 
 /*----------------------------------------------------------------
@@ -118,26 +225,33 @@ void CFE_SBR_Init_Map(void)
  *-----------------------------------------------------------------*/
 uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
 {
+    CFE_SBR_RouteId_t * map;
     CFE_SB_MsgId_Atom_t hash;
     uint32              collisions = 0;
 
     if (CFE_SB_IsValidMsgId(MsgId))
     {
+        map  = CFE_SBR_MSGMAP[CFE_SBR_MSGMAP_ACTIVE];
         hash = CFE_SBR_MsgIdHash(MsgId);
 
         /*
-         * Increment from original hash to find the next open slot.
+         * Increment from original hash to find the next open or removed slot.
          * Since map is larger than possible routes this will
          * never deadlock
          */
-        while (CFE_SBR_IsValidRouteId(CFE_SBR_MSGMAP[hash]))
+        while (CFE_SBR_IsValidRouteId(map[hash]))
         {
             /* Increment or loop to start of array */
             hash = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
             collisions++;
         }
 
-        CFE_SBR_MSGMAP[hash] = RouteId;
+        if (CFE_SBR_IsRemovedRouteId(map[hash]) && CFE_SBR_MSGMAP_REMOVED > 0)
+        {
+            CFE_SBR_MSGMAP_REMOVED--;
+        }
+
+        map[hash] = RouteId;
     }
 
     return collisions;
@@ -150,26 +264,140 @@ uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
  *-----------------------------------------------------------------*/
 CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
 {
-    CFE_SB_MsgId_Atom_t hash;
-    CFE_SBR_RouteId_t   routeid = CFE_SBR_INVALID_ROUTE_ID;
+    const CFE_SBR_RouteId_t *map;
+    CFE_SB_MsgId_Atom_t      hash;
+    CFE_SBR_RouteId_t        routeid = CFE_SBR_INVALID_ROUTE_ID;
+    uint32                   mapidx;
+    uint32                   probes;
+    uint32                   sequence;
+    bool                     isconsistent = false;
 
     if (CFE_SB_IsValidMsgId(MsgId))
     {
-        hash    = CFE_SBR_MsgIdHash(MsgId);
-        routeid = CFE_SBR_MSGMAP[hash];
+        while (!isconsistent)
+        {
+            mapidx   = CFE_ATOMIC_LOAD(&CFE_SBR_MSGMAP_ACTIVE);
+            map      = CFE_SBR_MSGMAP[mapidx];
+            sequence = CFE_ATOMIC_LOAD(&CFE_SBR_MSGMAP_SEQUENCE[mapidx]);
+            routeid  = CFE_SBR_INVALID_ROUTE_ID;
+
+            /* A copy being rehashed into is only in use by lookups that found it before it was replaced */
+            if ((sequence & 1) == 0)
+            {
+                hash    = CFE_SBR_MsgIdHash(MsgId);
+                routeid = map[hash];
+                probes  = 0;
+
+                /*
+                 * Increment from original hash to find matching route, stepping
+                 * over removed routes.  Removed routes may take up every open slot,
+                 * so the number of probes is limited to the size of the map
+                 */
+                while ((CFE_SBR_IsValidRouteId(routeid) && !CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid), MsgId)) ||
+                       CFE_SBR_IsRemovedRouteId(routeid))
+                {
+                    probes++;
+                    if (probes >= CFE_SBR_MSG_MAP_SIZE)
+                    {
+                        routeid = CFE_SBR_INVALID_ROUTE_ID;
+                        break;
+                    }
+
+                    /* Increment or loop to start of array */
+                    hash    = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+                    routeid = map[hash];
+                }
+
+                /* If a rehash into the copy started meanwhile, what was found may be wrong, try again */
+                CFE_ATOMIC_FENCE();
+                isconsistent = (CFE_ATOMIC_LOAD(&CFE_SBR_MSGMAP_SEQUENCE[mapidx]) == sequence);
+            }
+        }
+    }
+
+    return routeid;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SBR_RouteId_t * map;
+    CFE_SB_MsgId_Atom_t hash;
+    CFE_SB_MsgId_Atom_t nextidx;
+    CFE_SBR_RouteId_t   routeid;
+
+    routeid = CFE_SBR_GetRouteId(MsgId);
+
+    if (CFE_SBR_IsValidRouteId(routeid))
+    {
+        map = CFE_SBR_MSGMAP[CFE_SBR_MSGMAP_ACTIVE];
+
+        /* Find the slot holding the route, it is known to be there */
+        hash = CFE_SBR_MsgIdHash(MsgId);
+        while (CFE_SBR_RouteIdToValue(map[hash]) != CFE_SBR_RouteIdToValue(routeid))
+        {
+            hash = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+        }
+
+        map[hash] = CFE_SBR_REMOVED_ROUTE_ID;
+        CFE_SBR_MSGMAP_REMOVED++;
 
         /*
-         * Increment from original hash to find matching route.
-         * Since map is larger than possible routes this will
-         * never deadlock
+         * Placeholders just before an open slot are not needed, a lookup would stop at the
+         * open slot anyway.  Clearing them does not move any entry, so it is safe for lookups.
          */
-        while (CFE_SBR_IsValidRouteId(routeid) && !CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid), MsgId))
+        nextidx = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+        while (!CFE_SBR_IsValidRouteId(map[nextidx]) && !CFE_SBR_IsRemovedRouteId(map[nextidx]) &&
+               CFE_SBR_IsRemovedRouteId(map[hash]))
         {
-            /* Increment or loop to start of array */
-            hash    = (hash + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
-            routeid = CFE_SBR_MSGMAP[hash];
+            map[hash] = CFE_SBR_INVALID_ROUTE_ID;
+            CFE_SBR_MSGMAP_REMOVED--;
+
+            nextidx = hash;
+            hash    = (hash - 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+        }
+
+        if (CFE_SBR_MSGMAP_REMOVED > CFE_SBR_REMOVED_ROUTE_LIMIT)
+        {
+            CFE_SBR_RehashMap();
         }
     }
+}
 
-    return routeid;
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_GetMapStats(CFE_SBR_MapStats_t *StatsPtr)
+{
+    const CFE_SBR_RouteId_t *map;
+    CFE_SB_MsgId_Atom_t      mapidx;
+    uint32                   probelen;
+
+    memset(StatsPtr, 0, sizeof(*StatsPtr));
+
+    map = CFE_SBR_MSGMAP[CFE_SBR_MSGMAP_ACTIVE];
+
+    for (mapidx = 0; mapidx < CFE_SBR_MSG_MAP_SIZE; mapidx++)
+    {
+        if (CFE_SBR_IsValidRouteId(map[mapidx]))
+        {
+            /* Distance from the slot the message id hashes to, allowing for the wrap */
+            probelen = (mapidx - CFE_SBR_MsgIdHash(CFE_SBR_GetMsgId(map[mapidx]))) &
+                       (CFE_SBR_MSG_MAP_SIZE - 1);
+
+            StatsPtr->NumEntries++;
+            StatsPtr->TotalProbeLength += probelen;
+            if (probelen > StatsPtr->MaxProbeLength)
+            {
+                StatsPtr->MaxProbeLength = probelen;
+            }
+        }
+    }
 }
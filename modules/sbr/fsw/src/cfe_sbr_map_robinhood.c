@@ -0,0 +1,500 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,719-1, and identified as “core Flight System: Bootes”
+ *
+ * Copyright (c) 2020 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/******************************************************************************
+ * Robin Hood hash routing map implementation
+ *
+ * Notes:
+ *   These functions manipulate/access global variables and need
+ *   to be protected by the SB Shared data lock.  The exception is
+ *   CFE_SBR_GetRouteId(), which is also used on the transmit path
+ *   without the lock.
+ *
+ *   Entries are kept in the order of the slot their message id hashes
+ *   to, so an entry that has probed further than the entry in a slot
+ *   takes that slot over.  This keeps probe lengths short and even, and
+ *   a lookup can stop as soon as it reaches an entry that is closer to
+ *   its hashed slot than the message id being looked up would be.
+ *   Removing an entry shifts the entries following it back by one slot
+ *   rather than leaving a placeholder, so probe lengths do not grow as
+ *   routes come and go.
+ *
+ *   Since entries move, lookups without the lock cannot use the map
+ *   while it is being updated.  Two copies of the map are kept, updates
+ *   are made to the copy not in use by lookups, and then that copy is
+ *   put in use.  The copy being updated only needs the slots changed by
+ *   the previous update brought over, which is a single run of slots.
+ *
+ *   Each copy has a sequence count that is odd while the copy is being
+ *   updated.  A lookup that still uses a copy from before it was replaced
+ *   sees the count change and tries again on the copy now in use, so
+ *   updates never wait for lookups while holding the lock.
+ */
+
+/*
+ * Include Files
+ */
+
+#include "common_types.h"
+#include "cfe_sbr.h"
+#include "cfe_sbr_priv.h"
+#include "cfe_core_atomic.h"
+#include "cfe_sb.h"
+
+#include <string.h>
+
+/*
+ * Macro Definitions
+ */
+
+/**
+ * \brief Message map size
+ *
+ * For Robin Hood mapping, map size is a multiple of maximum number of routes.
+ * Probe lengths stay short at a higher load than with linear probing, so
+ * 2 is enough to keep the average probe length near 1 when the routes fill
+ * up.  Note the multiple must be a factor of 2 to use the efficient shift
+ * logic, and can't be bigger than what can be indexed by CFE_SB_MsgId_Atom_t
+ */
+#define CFE_SBR_MSG_MAP_SIZE (2 * CFE_PLATFORM_SB_MAX_MSG_IDS)
+
+/* Verify power of two */
+#if ((CFE_SBR_MSG_MAP_SIZE & (CFE_SBR_MSG_MAP_SIZE - 1)) != 0)
+#error CFE_SBR_MSG_MAP_SIZE must be a power of 2 for hash algorithm to work
+#endif
+
+/** \brief Hash algorithm magic number
+ *
+ * Ref:
+ * https://stackoverflow.com/questions/664014/what-integer-hash-function-are-good-that-accepts-an-integer-hash-key/12996028#12996028
+ */
+#define CFE_SBR_HASH_MAGIC (0x45d9f3b)
+
+/******************************************************************************
+ * Type Definitions
+ */
+
+/** \brief Message map slot */
+typedef struct
+{
+    CFE_SB_MsgId_t    MsgId;       /**< \brief Message ID of the entry */
+    CFE_SBR_RouteId_t RouteId;     /**< \brief Route ID of the entry, invalid if the slot is empty */
+    uint16            ProbeLength; /**< \brief Number of slots the entry is past its hashed slot */
+} CFE_SBR_MapSlot_t;
+
+/** \brief Copy of the message map */
+typedef struct
+{
+    CFE_SBR_MapSlot_t Slots[CFE_SBR_MSG_MAP_SIZE]; /**< \brief Map slots */
+    uint32            MaxProbeLength;              /**< \brief No entry is further than this past its hashed slot */
+    uint32            Sequence;                    /**< \brief Incremented before and after each update of this copy */
+} CFE_SBR_MapCopy_t;
+
+/** \brief Module data */
+typedef struct
+{
+    CFE_SBR_MapCopy_t Copy[2];     /**< \brief Copy in use by lookups, and the copy to make the next update to */
+    uint32            ActiveIdx;   /**< \brief Index of the copy in use by lookups */
+    uint32            UpdateStart; /**< \brief First slot changed by the last update */
+    uint32            UpdateCount; /**< \brief Number of slots changed by the last update, the other copy lacks these */
+} cfe_sbr_map_data_t;
+
+/******************************************************************************
+ * Shared data
+ */
+
+/** \brief Message map shared data */
+cfe_sbr_map_data_t CFE_SBR_MAPDATA;
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Hashes the message id
+ *
+ * Note: algorithm designed for a 32 bit int, changing the size of
+ * CFE_SB_MsgId_Atom_t may require an update to this implementation
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_MsgId_Atom_t CFE_SBR_MsgIdHash(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SB_MsgId_Atom_t hash;
+
+    hash = CFE_SB_MsgIdToValue(MsgId);
+
+    hash = ((hash >> 16) ^ hash) * CFE_SBR_HASH_MAGIC;
+    hash = ((hash >> 16) ^ hash) * CFE_SBR_HASH_MAGIC;
+    hash = (hash >> 16) ^ hash;
+
+    /* Reduce to fit in map */
+    hash &= CFE_SBR_MSG_MAP_SIZE - 1;
+
+    return hash;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Finds the slot holding the message id in a copy of the map,
+ * returns CFE_SBR_MSG_MAP_SIZE if there is none
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_FindMapSlot(const CFE_SBR_MapCopy_t *CopyPtr, CFE_SB_MsgId_t MsgId)
+{
+    const CFE_SBR_MapSlot_t *slotptr;
+    uint32                   slotidx;
+    uint32                   probelen = 0;
+    uint32                   foundidx = CFE_SBR_MSG_MAP_SIZE;
+
+    slotidx = CFE_SBR_MsgIdHash(MsgId);
+    slotptr = &CopyPtr->Slots[slotidx];
+
+    /*
+     * Stop at an empty slot, or at an entry that is closer to its hashed
+     * slot than the message id would be, since the message id would have
+     * taken that slot over.  No entry is past the maximum probe length.
+     */
+    while (foundidx == CFE_SBR_MSG_MAP_SIZE && probelen <= CopyPtr->MaxProbeLength &&
+           CFE_SBR_IsValidRouteId(slotptr->RouteId) && slotptr->ProbeLength >= probelen)
+    {
+        if (CFE_SB_MsgId_Equal(slotptr->MsgId, MsgId))
+        {
+            foundidx = slotidx;
+        }
+        else
+        {
+            /* Increment or loop to start of array */
+            slotidx = (slotidx + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+            slotptr = &CopyPtr->Slots[slotidx];
+            probelen++;
+        }
+    }
+
+    return foundidx;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Records the run of slots changed by an update, from the first
+ * to the last slot inclusive, allowing for the wrap
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_SetMapUpdateRun(uint32 FirstIdx, uint32 LastIdx)
+{
+    CFE_SBR_MAPDATA.UpdateStart = FirstIdx;
+    CFE_SBR_MAPDATA.UpdateCount = ((LastIdx - FirstIdx) & (CFE_SBR_MSG_MAP_SIZE - 1)) + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Adds a message id that is not yet in the map to a copy of the map,
+ * returns the number of slots it was placed past its hashed slot
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_InsertMapSlot(CFE_SBR_MapCopy_t *CopyPtr, CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
+{
+    CFE_SBR_MapSlot_t entry;
+    CFE_SBR_MapSlot_t displaced;
+    uint32            firstidx;
+    uint32            slotidx;
+    uint32            collisions = 0;
+    bool              isplaced   = false;
+
+    entry.MsgId       = MsgId;
+    entry.RouteId     = RouteId;
+    entry.ProbeLength = 0;
+
+    firstidx = CFE_SBR_MsgIdHash(MsgId);
+    slotidx  = firstidx;
+
+    /*
+     * Increment from original hash to find the next open slot, taking over
+     * any slot from an entry that is closer to its own hashed slot and then
+     * carrying on with that entry.  Since map is larger than possible routes
+     * this will never deadlock
+     */
+    while (CFE_SBR_IsValidRouteId(CopyPtr->Slots[slotidx].RouteId))
+    {
+        if (CopyPtr->Slots[slotidx].ProbeLength < entry.ProbeLength)
+        {
+            if (!isplaced)
+            {
+                collisions = entry.ProbeLength;
+                isplaced   = true;
+            }
+
+            if (entry.ProbeLength > CopyPtr->MaxProbeLength)
+            {
+                CopyPtr->MaxProbeLength = entry.ProbeLength;
+            }
+
+            displaced               = CopyPtr->Slots[slotidx];
+            CopyPtr->Slots[slotidx] = entry;
+            entry                   = displaced;
+        }
+
+        /* Increment or loop to start of array */
+        slotidx = (slotidx + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+        entry.ProbeLength++;
+    }
+
+    if (!isplaced)
+    {
+        collisions = entry.ProbeLength;
+    }
+
+    if (entry.ProbeLength > CopyPtr->MaxProbeLength)
+    {
+        CopyPtr->MaxProbeLength = entry.ProbeLength;
+    }
+
+    CopyPtr->Slots[slotidx] = entry;
+
+    CFE_SBR_SetMapUpdateRun(firstidx, slotidx);
+
+    return collisions;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Removes the entry in the given slot from a copy of the map
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_RemoveMapSlot(CFE_SBR_MapCopy_t *CopyPtr, uint32 SlotIdx)
+{
+    uint32 firstidx;
+    uint32 nextidx;
+
+    firstidx = SlotIdx;
+    nextidx  = (SlotIdx + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+
+    /* Shift back the following entries, up to an empty slot or an entry already in its hashed slot */
+    while (CFE_SBR_IsValidRouteId(CopyPtr->Slots[nextidx].RouteId) && CopyPtr->Slots[nextidx].ProbeLength > 0)
+    {
+        CopyPtr->Slots[SlotIdx] = CopyPtr->Slots[nextidx];
+        CopyPtr->Slots[SlotIdx].ProbeLength--;
+
+        SlotIdx = nextidx;
+        nextidx = (nextidx + 1) & (CFE_SBR_MSG_MAP_SIZE - 1);
+    }
+
+    CopyPtr->Slots[SlotIdx].MsgId       = CFE_SB_INVALID_MSG_ID;
+    CopyPtr->Slots[SlotIdx].RouteId     = CFE_SBR_INVALID_ROUTE_ID;
+    CopyPtr->Slots[SlotIdx].ProbeLength = 0;
+
+    CFE_SBR_SetMapUpdateRun(firstidx, SlotIdx);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Gets the copy of the map to update, which starts out
+ * the same as the copy in use by lookups
+ *
+ *-----------------------------------------------------------------*/
+CFE_SBR_MapCopy_t *CFE_SBR_BeginMapUpdate(void)
+{
+    CFE_SBR_MapCopy_t *activeptr;
+    CFE_SBR_MapCopy_t *spareptr;
+    uint32             slotidx;
+    uint32             i;
+
+    activeptr = &CFE_SBR_MAPDATA.Copy[CFE_ATOMIC_LOAD(&CFE_SBR_MAPDATA.ActiveIdx)];
+    spareptr  = &CFE_SBR_MAPDATA.Copy[1 - CFE_ATOMIC_LOAD(&CFE_SBR_MAPDATA.ActiveIdx)];
+
+    /* Any remaining lookups found the copy before it was replaced, they will try again */
+    CFE_ATOMIC_ADD_FETCH(&spareptr->Sequence, 1);
+    CFE_ATOMIC_FENCE();
+
+    /* The copies only differ by the slots changed in the last update */
+    for (i = 0; i < CFE_SBR_MAPDATA.UpdateCount; i++)
+    {
+        slotidx                  = (CFE_SBR_MAPDATA.UpdateStart + i) & (CFE_SBR_MSG_MAP_SIZE - 1);
+        spareptr->Slots[slotidx] = activeptr->Slots[slotidx];
+    }
+    spareptr->MaxProbeLength = activeptr->MaxProbeLength;
+
+    CFE_SBR_MAPDATA.UpdateCount = 0;
+
+    return spareptr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Puts the updated copy of the map in use by lookups
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_FinishMapUpdate(CFE_SBR_MapCopy_t *CopyPtr)
+{
+    CFE_ATOMIC_FENCE();
+    CFE_ATOMIC_ADD_FETCH(&CopyPtr->Sequence, 1);
+
+    CFE_ATOMIC_STORE(&CFE_SBR_MAPDATA.ActiveIdx, (uint32)(CopyPtr - CFE_SBR_MAPDATA.Copy));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_Init_Map(void)
+{
+    uint32 copyidx;
+    uint32 slotidx;
+
+    /* Clear the shared data */
+    memset(&CFE_SBR_MAPDATA, 0, sizeof(CFE_SBR_MAPDATA));
+
+    for (copyidx = 0; copyidx < 2; copyidx++)
+    {
+        for (slotidx = 0; slotidx < CFE_SBR_MSG_MAP_SIZE; slotidx++)
+        {
+            CFE_SBR_MAPDATA.Copy[copyidx].Slots[slotidx].MsgId = CFE_SB_INVALID_MSG_ID;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId)
+{
+    CFE_SBR_MapCopy_t *copyptr;
+    uint32             slotidx;
+    uint32             collisions = 0;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        copyptr = CFE_SBR_BeginMapUpdate();
+        slotidx = CFE_SBR_FindMapSlot(copyptr, MsgId);
+
+        if (slotidx == CFE_SBR_MSG_MAP_SIZE)
+        {
+            if (CFE_SBR_IsValidRouteId(RouteId))
+            {
+                collisions = CFE_SBR_InsertMapSlot(copyptr, MsgId, RouteId);
+            }
+        }
+        else if (CFE_SBR_IsValidRouteId(RouteId))
+        {
+            copyptr->Slots[slotidx].RouteId = RouteId;
+            CFE_SBR_SetMapUpdateRun(slotidx, slotidx);
+        }
+        else
+        {
+            CFE_SBR_RemoveMapSlot(copyptr, slotidx);
+        }
+
+        CFE_SBR_FinishMapUpdate(copyptr);
+    }
+
+    return collisions;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SBR_SetRouteId(MsgId, CFE_SBR_INVALID_ROUTE_ID);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+CFE_SBR_RouteId_t CFE_SBR_GetRouteId(CFE_SB_MsgId_t MsgId)
+{
+    CFE_SBR_MapCopy_t *copyptr;
+    CFE_SBR_RouteId_t  routeid = CFE_SBR_INVALID_ROUTE_ID;
+    uint32             sequence;
+    uint32             slotidx;
+    bool               isconsistent = false;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        while (!isconsistent)
+        {
+            copyptr  = &CFE_SBR_MAPDATA.Copy[CFE_ATOMIC_LOAD(&CFE_SBR_MAPDATA.ActiveIdx)];
+            sequence = CFE_ATOMIC_LOAD(&copyptr->Sequence);
+            routeid  = CFE_SBR_INVALID_ROUTE_ID;
+
+            /* A copy being updated is only in use by lookups that found it before it was replaced */
+            if ((sequence & 1) == 0)
+            {
+                slotidx = CFE_SBR_FindMapSlot(copyptr, MsgId);
+                if (slotidx != CFE_SBR_MSG_MAP_SIZE)
+                {
+                    routeid = copyptr->Slots[slotidx].RouteId;
+                }
+
+                /* If an update of the copy started meanwhile, what was found may be wrong, try again */
+                CFE_ATOMIC_FENCE();
+                isconsistent = (CFE_ATOMIC_LOAD(&copyptr->Sequence) == sequence);
+            }
+        }
+    }
+
+    return routeid;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_GetMapStats(CFE_SBR_MapStats_t *StatsPtr)
+{
+    const CFE_SBR_MapCopy_t *copyptr;
+    uint32                   slotidx;
+
+    memset(StatsPtr, 0, sizeof(*StatsPtr));
+
+    copyptr = &CFE_SBR_MAPDATA.Copy[CFE_ATOMIC_LOAD(&CFE_SBR_MAPDATA.ActiveIdx)];
+
+    for (slotidx = 0; slotidx < CFE_SBR_MSG_MAP_SIZE; slotidx++)
+    {
+        if (CFE_SBR_IsValidRouteId(copyptr->Slots[slotidx].RouteId))
+        {
+            StatsPtr->NumEntries++;
+            StatsPtr->TotalProbeLength += copyptr->Slots[slotidx].ProbeLength;
+            if (copyptr->Slots[slotidx].ProbeLength > StatsPtr->MaxProbeLength)
+            {
+                StatsPtr->MaxProbeLength = copyptr->Slots[slotidx].ProbeLength;
+            }
+        }
+    }
+}
@@ -58,4 +58,15 @@ void CFE_SBR_Init_Map(void);
  */
 uint32 CFE_SBR_SetRouteId(CFE_SB_MsgId_t MsgId, CFE_SBR_RouteId_t RouteId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Removes the route ID associated with the given message ID
+ *
+ * After this call CFE_SBR_GetRouteId() returns an invalid route ID for the
+ * message ID.  Does nothing if the message ID has no route ID.
+ *
+ * \param[in] MsgId Message id to remove from the map
+ */
+void CFE_SBR_ClearRouteId(CFE_SB_MsgId_t MsgId);
+
 #endif /* CFE_SBR_PRIV_H */
@@ -23,7 +23,12 @@
  *
  * Notes:
  *   These functions manipulate/access global variables and need
- *   to be protected by the SB Shared data lock.
+ *   to be protected by the SB Shared data lock.  The exceptions are
+ *   CFE_SBR_GetRouteId(), CFE_SBR_GetMsgId() and the sequence counter
+ *   access, which are also used on the transmit path without the lock.
+ *
+ *   Removed routes are held back from reuse for two releases, since the
+ *   transmit path may still be using the route ID of a removed route.
  */
 
 /*
@@ -33,6 +38,7 @@
 #include "common_types.h"
 #include "cfe_sbr.h"
 #include "cfe_sbr_priv.h"
+#include "cfe_core_atomic.h"
 #include <string.h>
 
 #include "cfe_sb.h"
@@ -48,13 +54,18 @@ typedef struct
     CFE_SB_DestinationD_t * ListHeadPtr; /**< \brief Destination list head */
     CFE_SB_MsgId_t          MsgId;       /**< \brief Message ID associated with route */
     CFE_MSG_SequenceCount_t SeqCnt;      /**< \brief Message sequence counter */
+    CFE_SBR_RouteId_t       NextFree;    /**< \brief Next route on the removed or free list */
+    bool                    InUse;       /**< \brief Route is mapped to its message ID */
 } CFE_SBR_RouteEntry_t;
 
 /** \brief Module data */
 typedef struct
 {
     CFE_SBR_RouteEntry_t  RoutingTbl[CFE_PLATFORM_SB_MAX_MSG_IDS]; /**< \brief Routing table */
-    CFE_SB_RouteId_Atom_t RouteIdxTop;                             /**< \brief First unused entry in RoutingTbl */
+    CFE_SB_RouteId_Atom_t RouteIdxTop;                             /**< \brief First never used entry in RoutingTbl */
+    CFE_SBR_RouteId_t     RemovedHead;                             /**< \brief Routes removed since the last release */
+    CFE_SBR_RouteId_t     PrevRemovedHead;                         /**< \brief Routes removed before the last release */
+    CFE_SBR_RouteId_t     FreeHead;                                /**< \brief Released routes, ready for reuse */
 } cfe_sbr_route_data_t;
 
 /******************************************************************************
@@ -93,16 +104,34 @@ void CFE_SBR_Init(void)
  *-----------------------------------------------------------------*/
 CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
 {
-    CFE_SBR_RouteId_t routeid    = CFE_SBR_INVALID_ROUTE_ID;
-    uint32            collisions = 0;
+    CFE_SBR_RouteEntry_t *entryptr;
+    CFE_SBR_RouteId_t     routeid    = CFE_SBR_INVALID_ROUTE_ID;
+    uint32                collisions = 0;
+
+    if (CFE_SB_IsValidMsgId(MsgId))
+    {
+        /* Reuse a released route first, so the table only grows when all routes are in use */
+        if (CFE_SBR_IsValidRouteId(CFE_SBR_RDATA.FreeHead))
+        {
+            routeid                = CFE_SBR_RDATA.FreeHead;
+            CFE_SBR_RDATA.FreeHead = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(routeid)].NextFree;
+        }
+        else if (CFE_SBR_RDATA.RouteIdxTop < CFE_PLATFORM_SB_MAX_MSG_IDS)
+        {
+            routeid = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
+            CFE_SBR_RDATA.RouteIdxTop++;
+        }
+    }
 
-    if (CFE_SB_IsValidMsgId(MsgId) && (CFE_SBR_RDATA.RouteIdxTop < CFE_PLATFORM_SB_MAX_MSG_IDS))
+    if (CFE_SBR_IsValidRouteId(routeid))
     {
-        routeid    = CFE_SBR_ValueToRouteId(CFE_SBR_RDATA.RouteIdxTop);
-        collisions = CFE_SBR_SetRouteId(MsgId, routeid);
+        entryptr = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(routeid)];
 
-        CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RDATA.RouteIdxTop].MsgId = MsgId;
-        CFE_SBR_RDATA.RouteIdxTop++;
+        /* Fill in the route before mapping it, lookups may run concurrently without the lock */
+        entryptr->MsgId    = MsgId;
+        entryptr->NextFree = CFE_SBR_INVALID_ROUTE_ID;
+        entryptr->InUse    = true;
+        collisions         = CFE_SBR_SetRouteId(MsgId, routeid);
     }
 
     if (CollisionsPtr != NULL)
@@ -113,6 +142,63 @@ CFE_SBR_RouteId_t CFE_SBR_AddRoute(CFE_SB_MsgId_t MsgId, uint32 *CollisionsPtr)
     return routeid;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_RemoveRoute(CFE_SBR_RouteId_t RouteId)
+{
+    CFE_SBR_RouteEntry_t *entryptr;
+
+    if (CFE_SBR_IsValidRouteId(RouteId))
+    {
+        entryptr = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)];
+
+        if (entryptr->InUse)
+        {
+            /* Unmap first so no new lookup finds the route, the message ID is kept for lookups in progress */
+            CFE_SBR_ClearRouteId(entryptr->MsgId);
+
+            entryptr->ListHeadPtr = NULL;
+            entryptr->InUse       = false;
+            entryptr->NextFree    = CFE_SBR_RDATA.RemovedHead;
+
+            CFE_SBR_RDATA.RemovedHead = RouteId;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SBR_ReleaseRemovedRoutes(void)
+{
+    CFE_SBR_RouteEntry_t *entryptr;
+    CFE_SBR_RouteId_t     routeid;
+
+    while (CFE_SBR_IsValidRouteId(CFE_SBR_RDATA.PrevRemovedHead))
+    {
+        routeid  = CFE_SBR_RDATA.PrevRemovedHead;
+        entryptr = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(routeid)];
+
+        CFE_SBR_RDATA.PrevRemovedHead = entryptr->NextFree;
+
+        /* Start the reused route out the same as a route that was never used */
+        entryptr->MsgId = CFE_SB_INVALID_MSG_ID;
+        CFE_ATOMIC_STORE(&entryptr->SeqCnt, 0);
+        entryptr->NextFree = CFE_SBR_RDATA.FreeHead;
+
+        CFE_SBR_RDATA.FreeHead = routeid;
+    }
+
+    /* Routes removed since the last release are held back until the next one */
+    CFE_SBR_RDATA.PrevRemovedHead = CFE_SBR_RDATA.RemovedHead;
+    CFE_SBR_RDATA.RemovedHead     = CFE_SBR_INVALID_ROUTE_ID;
+}
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -165,15 +251,25 @@ void CFE_SBR_SetDestListHeadPtr(CFE_SBR_RouteId_t RouteId, CFE_SB_DestinationD_t
  * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-void CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId)
+CFE_MSG_SequenceCount_t CFE_SBR_IncrementSequenceCounter(CFE_SBR_RouteId_t RouteId)
 {
     CFE_MSG_SequenceCount_t *cnt;
+    CFE_MSG_SequenceCount_t  seqcnt  = 0;
+    CFE_MSG_SequenceCount_t  nextcnt = 0;
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        cnt  = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
-        *cnt = CFE_MSG_GetNextSequenceCount(*cnt);
+        cnt    = &CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
+        seqcnt = CFE_ATOMIC_LOAD(cnt);
+
+        /* Retry if another transmitter updated the counter in the meantime */
+        do
+        {
+            nextcnt = CFE_MSG_GetNextSequenceCount(seqcnt);
+        } while (!CFE_ATOMIC_COMPARE_EXCHANGE(cnt, &seqcnt, nextcnt));
     }
+
+    return nextcnt;
 }
 
 /*----------------------------------------------------------------
@@ -187,7 +283,7 @@ CFE_MSG_SequenceCount_t CFE_SBR_GetSequenceCounter(CFE_SBR_RouteId_t RouteId)
 
     if (CFE_SBR_IsValidRouteId(RouteId))
     {
-        seqcnt = CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt;
+        seqcnt = CFE_ATOMIC_LOAD(&CFE_SBR_RDATA.RoutingTbl[CFE_SBR_RouteIdToValue(RouteId)].SeqCnt);
     }
 
     return seqcnt;
@@ -221,6 +317,10 @@ void CFE_SBR_ForEachRouteId(CFE_SBR_CallbackPtr_t CallbackPtr, void *ArgPtr, CFE
 
     for (routeidx = startidx; routeidx < endidx; routeidx++)
     {
-        (*CallbackPtr)(CFE_SBR_ValueToRouteId(routeidx), ArgPtr);
+        /* Removed routes are skipped, the callback may also remove the route it is given */
+        if (CFE_SBR_RDATA.RoutingTbl[routeidx].InUse)
+        {
+            (*CallbackPtr)(CFE_SBR_ValueToRouteId(routeidx), ArgPtr);
+        }
     }
 }
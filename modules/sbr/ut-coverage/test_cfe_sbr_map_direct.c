@@ -41,6 +41,7 @@ void Test_SBR_Map_Direct(void)
     CFE_SB_MsgId_Atom_t msgid_limit;
     CFE_SBR_RouteId_t   routeid;
     CFE_SB_MsgId_t      msgid;
+    CFE_SBR_MapStats_t  stats;
     uint32              count;
     uint32              i;
 
@@ -119,6 +120,18 @@ void Test_SBR_Map_Direct(void)
     UtAssert_INT32_EQ(CFE_SBR_GetRouteId(msgid).RouteId, routeid.RouteId);
     UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid)));
 
+    UtPrintf("Set again, then remove and check again");
+    routeid = CFE_SBR_ValueToRouteId(0);
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid, routeid), 0);
+    CFE_SBR_GetMapStats(&stats);
+    UtAssert_UINT32_EQ(stats.NumEntries, 1);
+    UtAssert_UINT32_EQ(stats.MaxProbeLength, 0);
+    UtAssert_UINT32_EQ(stats.TotalProbeLength, 0);
+    UtAssert_VOIDCALL(CFE_SBR_ClearRouteId(msgid));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid)));
+    CFE_SBR_GetMapStats(&stats);
+    UtAssert_UINT32_EQ(stats.NumEntries, 0);
+
     /* Performance check, 0xFFFFFF on 3.2GHz linux box is around 8-9 seconds */
     count = 0;
     for (i = 0; i <= 0xFFFF; i++)
@@ -59,6 +59,7 @@ void Test_SBR_Map_Hash(void)
     CFE_SB_MsgId_Atom_t msgid_limit;
     CFE_SBR_RouteId_t   routeid[3];
     CFE_SB_MsgId_t      msgid[3];
+    CFE_SBR_MapStats_t  stats;
     uint32              count;
     uint32              collisions;
 
@@ -112,6 +113,65 @@ void Test_SBR_Map_Hash(void)
     UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[1])), CFE_SBR_RouteIdToValue(routeid[1]));
     UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[2])), CFE_SBR_RouteIdToValue(routeid[2]));
 
+    CFE_SBR_GetMapStats(&stats);
+    UtAssert_UINT32_EQ(stats.NumEntries, 3);
+    UtAssert_UINT32_EQ(stats.MaxProbeLength, 2);
+    UtAssert_UINT32_EQ(stats.TotalProbeLength, 2);
+
+    UtPrintf("Remove a route and check the entry past it is still found");
+    UtAssert_VOIDCALL(CFE_SBR_ClearRouteId(msgid[0]));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[0])));
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[2])), CFE_SBR_RouteIdToValue(routeid[2]));
+    UtAssert_VOIDCALL(CFE_SBR_ClearRouteId(msgid[0]));
+
+    CFE_SBR_GetMapStats(&stats);
+    UtAssert_UINT32_EQ(stats.NumEntries, 2);
+
+    UtPrintf("Put the route back in the slot it was removed from");
+    UtAssert_INT32_EQ(CFE_SBR_SetRouteId(msgid[0], routeid[0]), 0);
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[0])), CFE_SBR_RouteIdToValue(routeid[0]));
+
+    UtPrintf("Remove the routes of a run from the start, and check the map is rehashed");
+    UtAssert_VOIDCALL(CFE_SBR_ClearRouteId(msgid[0]));
+    for (msgidx = 0; msgidx <= CFE_PLATFORM_SB_MAX_MSG_IDS / 2; msgidx++)
+    {
+        CFE_SBR_AddRoute(Test_SBR_Unhash(2 * CFE_PLATFORM_SB_MAX_MSG_IDS + msgidx), &collisions);
+        UtAssert_INT32_EQ(collisions, 0);
+    }
+    for (msgidx = 0; msgidx < CFE_PLATFORM_SB_MAX_MSG_IDS / 2 - 1; msgidx++)
+    {
+        CFE_SBR_ClearRouteId(Test_SBR_Unhash(2 * CFE_PLATFORM_SB_MAX_MSG_IDS + msgidx));
+    }
+
+    /* The removed routes stay as placeholders since the last route of the run follows them */
+    CFE_SBR_GetMapStats(&stats);
+    UtAssert_UINT32_EQ(stats.NumEntries, 4);
+    UtAssert_UINT32_EQ(stats.TotalProbeLength, 2);
+
+    /* One more goes over the limit, and the route past the removed first route moves back */
+    CFE_SBR_ClearRouteId(Test_SBR_Unhash(2 * CFE_PLATFORM_SB_MAX_MSG_IDS + CFE_PLATFORM_SB_MAX_MSG_IDS / 2 - 1));
+    CFE_SBR_GetMapStats(&stats);
+    UtAssert_UINT32_EQ(stats.NumEntries, 3);
+    UtAssert_UINT32_EQ(stats.MaxProbeLength, 1);
+    UtAssert_UINT32_EQ(stats.TotalProbeLength, 1);
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[1])), CFE_SBR_RouteIdToValue(routeid[1]));
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[2])), CFE_SBR_RouteIdToValue(routeid[2]));
+    UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(
+        CFE_SBR_GetRouteId(Test_SBR_Unhash(2 * CFE_PLATFORM_SB_MAX_MSG_IDS + CFE_PLATFORM_SB_MAX_MSG_IDS / 2))));
+
+    UtPrintf("Remove the last route of a run, which leaves no placeholder");
+    CFE_SBR_ClearRouteId(msgid[2]);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[2])));
+    UtAssert_INT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[1])), CFE_SBR_RouteIdToValue(routeid[1]));
+
+    UtPrintf("Fill the map with removed routes and check lookups still end");
+    for (msgidx = 0; msgidx < 4 * CFE_PLATFORM_SB_MAX_MSG_IDS; msgidx++)
+    {
+        CFE_SBR_SetRouteId(Test_SBR_Unhash(msgidx), CFE_SBR_ValueToRouteId(CFE_PLATFORM_SB_MAX_MSG_IDS));
+    }
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(Test_SBR_Unhash(1))));
+    CFE_SBR_Init_Map();
+
     /* Performance check, 0xFFFFFF on 3.2GHz linux box is around 8-9 seconds */
     count = 0;
     for (msgidx = 0; msgidx <= 0xFFFF; msgidx++)
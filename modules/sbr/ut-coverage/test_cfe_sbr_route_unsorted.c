@@ -128,7 +128,7 @@ void Test_SBR_Route_Unsort_GetSet(void)
         UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[i]), NULL);
         UtAssert_INT32_EQ(CFE_SBR_GetSequenceCounter(routeid[i]), 0);
         UtAssert_VOIDCALL(CFE_SBR_SetDestListHeadPtr(routeid[i], NULL));
-        UtAssert_VOIDCALL(CFE_SBR_IncrementSequenceCounter(routeid[i]));
+        UtAssert_INT32_EQ(CFE_SBR_IncrementSequenceCounter(routeid[i]), 0);
     }
 
     /*
@@ -170,13 +170,13 @@ void Test_SBR_Route_Unsort_GetSet(void)
     for (i = 0; i < 3; i++)
     {
         UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(msgid[i], CFE_SBR_GetMsgId(routeid[i])));
-        CFE_SBR_IncrementSequenceCounter(routeid[0]);
+        UtAssert_UINT32_EQ(CFE_SBR_IncrementSequenceCounter(routeid[0]), seqcntexpected[0]);
     }
     UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 3);
 
     /* Increment route 1 once and set dest pointers */
     UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), seqcntexpected[1]);
-    CFE_SBR_IncrementSequenceCounter(routeid[1]);
+    UtAssert_UINT32_EQ(CFE_SBR_IncrementSequenceCounter(routeid[1]), seqcntexpected[1]);
     UtAssert_STUB_COUNT(CFE_MSG_GetNextSequenceCount, 4);
     CFE_SBR_SetDestListHeadPtr(routeid[1], &dest[1]);
     CFE_SBR_SetDestListHeadPtr(routeid[2], &dest[0]);
@@ -190,6 +190,85 @@ void Test_SBR_Route_Unsort_GetSet(void)
     UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[2]), &dest[0]);
 }
 
+void Test_SBR_Route_Unsort_Remove(void)
+{
+    CFE_SBR_RouteId_t     routeid[2];
+    CFE_SBR_RouteId_t     lastrouteid;
+    CFE_SB_MsgId_t        msgid[2];
+    CFE_SB_DestinationD_t dest;
+    uint32                count;
+
+    UtPrintf("Initialize map and route");
+    CFE_SBR_Init();
+
+    UtPrintf("Invalid route ID checks");
+    UtAssert_VOIDCALL(CFE_SBR_RemoveRoute(CFE_SBR_INVALID_ROUTE_ID));
+    UtAssert_VOIDCALL(CFE_SBR_RemoveRoute(CFE_SBR_ValueToRouteId(CFE_PLATFORM_SB_MAX_MSG_IDS)));
+    UtAssert_VOIDCALL(CFE_SBR_ReleaseRemovedRoutes());
+
+    /*
+     * Force valid msgid responses
+     * Note from here on msgids must be in the valid range since validation is forced true
+     * and if the underlying map implementation is direct it needs to be a valid array index
+     */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), true);
+
+    msgid[0]   = CFE_SB_ValueToMsgId(1);
+    msgid[1]   = CFE_SB_ValueToMsgId(2);
+    routeid[0] = CFE_SBR_AddRoute(msgid[0], NULL);
+    routeid[1] = CFE_SBR_AddRoute(msgid[1], NULL);
+    CFE_SBR_SetDestListHeadPtr(routeid[0], &dest);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_MSG_GetNextSequenceCount), 1);
+    UtAssert_UINT32_EQ(CFE_SBR_IncrementSequenceCounter(routeid[0]), 1);
+
+    UtPrintf("Removed route is unmapped and skipped, but not reused until released");
+    UtAssert_VOIDCALL(CFE_SBR_RemoveRoute(routeid[0]));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_GetRouteId(msgid[0])));
+    UtAssert_ADDRESS_EQ(CFE_SBR_GetDestListHeadPtr(routeid[0]), NULL);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid[0]), msgid[0]));
+    count = 0;
+    CFE_SBR_ForEachRouteId(Test_SBR_Callback, &count, NULL);
+    UtAssert_UINT32_EQ(count, 1);
+
+    /* Removing again does nothing */
+    UtAssert_VOIDCALL(CFE_SBR_RemoveRoute(routeid[0]));
+
+    lastrouteid = CFE_SBR_AddRoute(msgid[0], NULL);
+    UtAssert_BOOL_TRUE(CFE_SBR_IsValidRouteId(lastrouteid));
+    UtAssert_BOOL_FALSE(CFE_SBR_RouteIdToValue(lastrouteid) == CFE_SBR_RouteIdToValue(routeid[0]));
+    UtAssert_VOIDCALL(CFE_SBR_RemoveRoute(lastrouteid));
+
+    UtPrintf("Removed route is held back for one more release");
+    UtAssert_VOIDCALL(CFE_SBR_ReleaseRemovedRoutes());
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid[0]), msgid[0]));
+    UtAssert_NONZERO(CFE_SBR_GetSequenceCounter(routeid[0]));
+
+    UtPrintf("Released route starts out unused and is reused first");
+    UtAssert_VOIDCALL(CFE_SBR_ReleaseRemovedRoutes());
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(CFE_SBR_GetMsgId(routeid[0]), CFE_SB_INVALID_MSG_ID));
+    UtAssert_ZERO(CFE_SBR_GetSequenceCounter(routeid[0]));
+    UtAssert_UINT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_AddRoute(msgid[0], NULL)),
+                       CFE_SBR_RouteIdToValue(routeid[0]));
+    UtAssert_UINT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(3), NULL)),
+                       CFE_SBR_RouteIdToValue(lastrouteid));
+    UtAssert_UINT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[0])), CFE_SBR_RouteIdToValue(routeid[0]));
+
+    UtPrintf("Released route is reused once the table is full");
+    count = 4;
+    while (CFE_SBR_IsValidRouteId(CFE_SBR_AddRoute(CFE_SB_ValueToMsgId(count), NULL)))
+    {
+        count++;
+    }
+    UtAssert_VOIDCALL(CFE_SBR_RemoveRoute(routeid[1]));
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_AddRoute(msgid[1], NULL)));
+    UtAssert_VOIDCALL(CFE_SBR_ReleaseRemovedRoutes());
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(CFE_SBR_AddRoute(msgid[1], NULL)));
+    UtAssert_VOIDCALL(CFE_SBR_ReleaseRemovedRoutes());
+    UtAssert_UINT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_AddRoute(msgid[1], NULL)),
+                       CFE_SBR_RouteIdToValue(routeid[1]));
+    UtAssert_UINT32_EQ(CFE_SBR_RouteIdToValue(CFE_SBR_GetRouteId(msgid[1])), CFE_SBR_RouteIdToValue(routeid[1]));
+}
+
 /* Main unit test routine */
 void UtTest_Setup(void)
 {
@@ -198,4 +277,5 @@ void UtTest_Setup(void)
 
     UT_ADD_TEST(Test_SBR_Route_Unsort_General);
     UT_ADD_TEST(Test_SBR_Route_Unsort_GetSet);
+    UT_ADD_TEST(Test_SBR_Route_Unsort_Remove);
 }